@@ -20,8 +20,9 @@
   // Parsing buffers.
   namespace escrido
   {
-    extern CDocumentation oDocumentation;  // The documentation content object.
-    extern CContentUnit   oParseContUnit;  // The content unit that is written to while lexing/parsing.
+    extern CDocumentation* pParseDocumentation; // The documentation that is parsed into.
+    extern bool            fParseOutput;        // Flag whether new pages are reported on the console.
+    extern CContentUnit    oParseContUnit;      // The content unit that is written to while lexing/parsing.
   }
 
   // Character position an line number counter.
@@ -38,18 +39,20 @@
 %union
 {
   char  cChar;
-  char* szString;
+  const char* szString; // Tag name, page type name or headline (owned by the scanner).
+  unsigned int nTagIdx; // Tag index (see escrido::GetTagIdx()).
   void* pPointer;    // Pointer to a CContentUnit class.
 }
 
 /*%type<pPointer> doc_page doc_page_head*/
-%type<szString> TAG_PAGE_OPEN TAG
+%type<szString> TAG_PAGE_OPEN TAG_UNKNOWN HEADLINE
+%type<nTagIdx> TAG
 
 %token PREC_LO
 %token END_OF_FILE
 %token BLANK TAB LB
 %token <cChar> TEXT_CHAR
-%token TAG_PAGE_OPEN TAG
+%token TAG_PAGE_OPEN TAG TAG_UNKNOWN HEADLINE
 %token PREC_HI
 
 %%
@@ -65,13 +68,13 @@ input_document:
         | input_document TAB                     { oParseContUnit.AppendTab(); }
         | input_document LB                      { oParseContUnit.AppendLineBreak(); }
         | input_document TEXT_CHAR               { oParseContUnit.AppendChar( $2 ); }
-        | input_document TAG                     { oParseContUnit.AppendTag( $2 );
-                                                   free( $2 ); }
+        | input_document TAG                     { oParseContUnit.AppendTag( $2 ); }
+        | input_document TAG_UNKNOWN             { oParseContUnit.AppendTag( $2 ); }
         | input_document page_head               { oParseContUnit.ResetContent(); }
         | input_document END_OF_FILE             { if( !oParseContUnit.Empty() )
                                                    {
                                                      oParseContUnit.CloseWrite();
-                                                     oDocumentation.PushContentUnit( oParseContUnit );
+                                                     pParseDocumentation->PushContentUnit( oParseContUnit );
                                                      oParseContUnit.ResetContent();
                                                    }
                                                    return 0; }
@@ -86,13 +89,10 @@ page_head_open:
           TAG_PAGE_OPEN                          { if( !oParseContUnit.Empty() )
                                                    {
                                                      oParseContUnit.CloseWrite();
-                                                     oDocumentation.PushContentUnit( oParseContUnit );
+                                                     pParseDocumentation->PushContentUnit( oParseContUnit );
                                                    }
-                                                   oDocumentation.NewDocPage( $1 );
-                                                   free( $1 ); }
-        | page_head_open BLANK                   { oDocumentation.Back()->AppendHeadlineChar( ' ' ); }
-        | page_head_open TAB                     { oDocumentation.Back()->AppendHeadlineChar( ' ' ); }
-        | page_head_open TEXT_CHAR               { oDocumentation.Back()->AppendHeadlineChar( $2 ); }
+                                                   pParseDocumentation->NewDocPage( $1, fParseOutput ); }
+        | page_head_open HEADLINE                { pParseDocumentation->AppendHeadline( $2 ); }
         ;
 
 %%
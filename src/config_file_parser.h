@@ -24,6 +24,8 @@
 namespace config_file_parser
 {
   size_t ParseConfigFile( const std::string& sConfigFile_i );
+  bool ParseConfigOption( const std::string& sOption_i, std::string& sLine_i );
+  bool IsVariantOption( const std::string& sOption_i );
   const std::string StripOption( std::string& sLine_i );
   const std::string StripValue( std::string& sLine_i );
 }
@@ -79,120 +81,207 @@ inline size_t config_file_parser::ParseConfigFile( const std::string& sConfigFil
     // Strip OPTION
     const std::string sOption = StripOption( sLine );
 
-    // Compare against known option names
-    if( sOption == "TEMPLATE_DIR" )
+    // A variant declaration: all following options belong to this variant.
+    if( sOption == "VARIANT" )
     {
-      std::string sDir = StripValue( sLine );
-      if( !sDir.empty() )
-        escrido::sTemplateDir = sDir;
+      std::string sName = StripValue( sLine );
+      if( sName.empty() )
+        return nResult;
+      escrido::oaOutputVariants.resize( escrido::oaOutputVariants.size() + 1 );
+      escrido::oaOutputVariants.back().sName = sName;
     }
     else
-    if( sOption == "INCLUDE" )
+    if( !escrido::oaOutputVariants.empty() )
     {
-      escrido::saIncludePaths.clear();
-      std::string sPath = StripValue( sLine );
-      while( !sPath.empty() )
-      {
-        escrido::saIncludePaths.push_back( sPath );
-        sPath = StripValue( sLine );
-      }
-    }
-    else
-    if( sOption == "NAMESPACE" )
-    {
-      escrido::saNamespaces.clear();
-      std::string sNamespace = StripValue( sLine );
-      while( !sNamespace.empty() )
-      {
-        escrido::saNamespaces.push_back( sNamespace );
-        sNamespace = StripValue( sLine );
-      }
-    }
-    else
-    if( sOption == "EXCLUDE_GROUPS" )
-    {
-      escrido::saExludeGroups.clear();
-      std::string sGroup = StripValue( sLine );
-      while( !sGroup.empty() )
-      {
-        escrido::saExludeGroups.push_back( sGroup );
-        sGroup = StripValue( sLine );
-      }
-    }
-    else
-    if( sOption == "INTERNAL_TAGS" )
-    {
-      escrido::fInternalTags = ( StripValue( sLine ) != "NO" );
-    }
-    else
-    if( sOption == "RELABEL" )
-    {
-      std::string sTerm = StripValue( sLine );
-      std::string sReplace = StripValue( sLine );
-      escrido::asRelabel.emplace_back( sTerm, sReplace );
-    }
-    else
-    if( sOption == "GENERATE_WEBDOC" )
-    {
-      escrido::fWDOutput = ( StripValue( sLine ) == "YES" );
-    }
-    else
-    if( sOption == "WEBDOC_OUT_DIR" )
-    {
-      std::string sDir = StripValue( sLine );
-      if( !sDir.empty() )
-        escrido::sWDOutputDir = sDir;
+      // Store the option for the variant. It is evaluated when the variant
+      // is written.
+      if( !IsVariantOption( sOption ) )
+        return nResult;
+      escrido::oaOutputVariants.back().asOptions.emplace_back( sOption, sLine );
     }
     else
-    if( sOption == "WEBDOC_FILE_ENDING" )
+    if( !ParseConfigOption( sOption, sLine ) )
     {
-      std::string sEnding = StripValue( sLine );
-      if( !sEnding.empty() )
-        escrido::sWDOutputPostfix = sEnding;
-    }
-    else
-    if( sOption == "GENERATE_SEARCH_INDEX" )
-    {
-      escrido::fSearchIndex = ( StripValue( sLine ) == "YES" );
+      // Unknown OPTION
+      return nResult;
     }
-    else
-    if( sOption == "SEARCH_INDEX_ENDCODING" )
+  }
+
+  // Close file after reading.
+  oFile.close();
+
+  return std::string::npos;
+}
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Evaluates a single option of the configuration file and sets
+///             the respective global settings.
+///
+/// \param[in]  sOption_i
+///             The option name.
+/// \param[in]  sLine_i
+///             The remaining line with the option value(s).
+///
+/// \return     true on success, false if the option is unknown.
+// *****************************************************************************
+
+inline bool config_file_parser::ParseConfigOption( const std::string& sOption_i, std::string& sLine_i )
+{
+  if( sOption_i == "TEMPLATE_DIR" )
+  {
+    std::string sDir = StripValue( sLine_i );
+    if( !sDir.empty() )
+      escrido::sTemplateDir = sDir;
+  }
+  else
+  if( sOption_i == "INCLUDE" )
+  {
+    escrido::saIncludePaths.clear();
+    std::string sPath = StripValue( sLine_i );
+    while( !sPath.empty() )
     {
-      if( StripValue( sLine ) == "JS" )
-        escrido::fSearchIdxEncode = escrido::search_index_encoding::JS;
-      else
-        escrido::fSearchIdxEncode = escrido::search_index_encoding::JSON;
+      escrido::saIncludePaths.push_back( sPath );
+      sPath = StripValue( sLine_i );
     }
-    else
-    if( sOption == "SEARCH_INDEX_FILE" )
+  }
+  else
+  if( sOption_i == "EXCLUDE" )
+  {
+    escrido::saExcludePaths.clear();
+    std::string sPath = StripValue( sLine_i );
+    while( !sPath.empty() )
     {
-      std::string sFileName = StripValue( sLine );
-      if( !sFileName.empty() )
-        escrido::sSeachIndexFile = sFileName;
+      escrido::saExcludePaths.push_back( sPath );
+      sPath = StripValue( sLine_i );
     }
-    else
-    if( sOption == "GENERATE_LATEX" )
+  }
+  else
+  if( sOption_i == "SCAN_THREADS" )
+  {
+    std::string sThreadN = StripValue( sLine_i );
+    if( !sThreadN.empty() && !escrido::ParseThreadNumber( sThreadN.c_str(), escrido::nScanThreads ) )
+      return false;
+  }
+  else
+  if( sOption_i == "PARSE_CACHE" )
+  {
+    escrido::sParseCacheFile = StripValue( sLine_i );
+  }
+  else
+  if( sOption_i == "NAMESPACE" )
+  {
+    escrido::saNamespaces.clear();
+    std::string sNamespace = StripValue( sLine_i );
+    while( !sNamespace.empty() )
     {
-      escrido::fLOutput = ( StripValue( sLine ) == "YES" );
+      escrido::saNamespaces.push_back( sNamespace );
+      sNamespace = StripValue( sLine_i );
     }
-    else
-    if( sOption == "LATEX_OUT_DIR" )
+  }
+  else
+  if( sOption_i == "EXCLUDE_GROUPS" )
+  {
+    escrido::saExludeGroups.clear();
+    std::string sGroup = StripValue( sLine_i );
+    while( !sGroup.empty() )
     {
-      std::string sDir = StripValue( sLine );
-      if( !sDir.empty() )
-        escrido::sLOutputDir = sDir;
+      escrido::saExludeGroups.push_back( sGroup );
+      sGroup = StripValue( sLine_i );
     }
+  }
+  else
+  if( sOption_i == "INTERNAL_TAGS" )
+  {
+    escrido::fInternalTags = ( StripValue( sLine_i ) != "NO" );
+  }
+  else
+  if( sOption_i == "RELABEL" )
+  {
+    std::string sTerm = StripValue( sLine_i );
+    std::string sReplace = StripValue( sLine_i );
+    escrido::asRelabel.emplace_back( sTerm, sReplace );
+  }
+  else
+  if( sOption_i == "GENERATE_WEBDOC" )
+  {
+    escrido::fWDOutput = ( StripValue( sLine_i ) == "YES" );
+  }
+  else
+  if( sOption_i == "WEBDOC_OUT_DIR" )
+  {
+    std::string sDir = StripValue( sLine_i );
+    if( !sDir.empty() )
+      escrido::sWDOutputDir = sDir;
+  }
+  else
+  if( sOption_i == "WEBDOC_FILE_ENDING" )
+  {
+    std::string sEnding = StripValue( sLine_i );
+    if( !sEnding.empty() )
+      escrido::sWDOutputPostfix = sEnding;
+  }
+  else
+  if( sOption_i == "GENERATE_SEARCH_INDEX" )
+  {
+    escrido::fSearchIndex = ( StripValue( sLine_i ) == "YES" );
+  }
+  else
+  if( sOption_i == "SEARCH_INDEX_ENDCODING" )
+  {
+    if( StripValue( sLine_i ) == "JS" )
+      escrido::fSearchIdxEncode = escrido::search_index_encoding::JS;
     else
-    {
-      // Unknown OPTION
-      return nResult;
-    }
+      escrido::fSearchIdxEncode = escrido::search_index_encoding::JSON;
+  }
+  else
+  if( sOption_i == "SEARCH_INDEX_FILE" )
+  {
+    std::string sFileName = StripValue( sLine_i );
+    if( !sFileName.empty() )
+      escrido::sSeachIndexFile = sFileName;
+  }
+  else
+  if( sOption_i == "GENERATE_LATEX" )
+  {
+    escrido::fLOutput = ( StripValue( sLine_i ) == "YES" );
   }
+  else
+  if( sOption_i == "LATEX_OUT_DIR" )
+  {
+    std::string sDir = StripValue( sLine_i );
+    if( !sDir.empty() )
+      escrido::sLOutputDir = sDir;
+  }
+  else
+    return false;
 
-  // Close file after reading.
-  oFile.close();
+  return true;
+}
 
-  return std::string::npos;
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Checks whether an option may be used inside of an output
+///             variant, i.e. whether it concerns the output only.
+// *****************************************************************************
+
+inline bool config_file_parser::IsVariantOption( const std::string& sOption_i )
+{
+  return sOption_i == "TEMPLATE_DIR" ||
+         sOption_i == "NAMESPACE" ||
+         sOption_i == "EXCLUDE_GROUPS" ||
+         sOption_i == "INTERNAL_TAGS" ||
+         sOption_i == "RELABEL" ||
+         sOption_i == "GENERATE_WEBDOC" ||
+         sOption_i == "WEBDOC_OUT_DIR" ||
+         sOption_i == "WEBDOC_FILE_ENDING" ||
+         sOption_i == "GENERATE_SEARCH_INDEX" ||
+         sOption_i == "SEARCH_INDEX_ENDCODING" ||
+         sOption_i == "SEARCH_INDEX_FILE" ||
+         sOption_i == "GENERATE_LATEX" ||
+         sOption_i == "LATEX_OUT_DIR";
 }
 
 // -----------------------------------------------------------------------------
@@ -16,6 +16,164 @@
 #include <string.h>         // strlen()
 #include <iostream>         // cin, cout, cerr, endl
 #include <fstream>          // std::ofstream
+#include <algorithm>        // std::search
+
+#include "binstream.h"
+
+// -----------------------------------------------------------------------------
+
+// LOCAL FUNCTIONS
+
+// -----------------------------------------------------------------------------
+
+namespace
+{
+  /// Returns the first position from a position on that is not a blank space
+  /// (or the length of the text).
+  size_t SkipBlanks( const strview::CStrView& sText_i, size_t nPos_i )
+  {
+    while( nPos_i < sText_i.size() && sText_i[nPos_i] == ' ' )
+      ++nPos_i;
+    return nPos_i;
+  }
+
+  /// Returns the first position from a position on that is a blank space (or
+  /// the length of the text).
+  size_t FindBlank( const strview::CStrView& sText_i, size_t nPos_i )
+  {
+    while( nPos_i < sText_i.size() && sText_i[nPos_i] != ' ' )
+      ++nPos_i;
+    return nPos_i;
+  }
+
+  /// Appends a text HTML escaped to a string or an output buffer (characters
+  /// that need no escaping are copied in runs).
+  template <class TOut>
+  void AppendHTMLEscaped( const strview::CStrView& sText_i, TOut& oOut_io )
+  {
+    size_t nCopyStart = 0;
+    for( size_t c = 0; c < sText_i.size(); c++ )
+    {
+      const char* szReplacement;
+      switch( sText_i[c] )
+      {
+        case '<':
+          szReplacement = "&lt;";
+          break;
+
+        case '>':
+          szReplacement = "&gt;";
+          break;
+
+        case '&':
+          szReplacement = "&amp;";
+          break;
+
+        case ' ':
+          szReplacement = "&nbsp;";
+          break;
+
+        default:
+          continue;
+      }
+
+      oOut_io.append( sText_i.data() + nCopyStart, c - nCopyStart );
+      oOut_io.append( szReplacement );
+      nCopyStart = c + 1;
+    }
+    oOut_io.append( sText_i.data() + nCopyStart, sText_i.size() - nCopyStart );
+  }
+
+  /// Appends a text LaTeX escaped to a string or an output buffer (characters
+  /// that need no escaping are copied in runs).
+  template <class TOut>
+  void AppendLaTeXEscaped( const strview::CStrView& sText_i, TOut& oOut_io )
+  {
+    size_t nCopyStart = 0;
+    for( size_t c = 0; c < sText_i.size(); c++ )
+    {
+      const char* szReplacement;
+      switch( sText_i[c] )
+      {
+        case '\\':
+          szReplacement = "\\\\";
+          break;
+
+        case '$':
+          szReplacement = "\\$";
+          break;
+
+        case '%':
+          szReplacement = "\\%";
+          break;
+
+        case '_':
+          szReplacement = "\\_";
+          break;
+
+        case '{':
+          szReplacement = "\\{";
+          break;
+
+        case '}':
+          szReplacement = "\\}";
+          break;
+
+        case '[':
+          szReplacement = "{[}";
+          break;
+
+        case ']':
+          szReplacement = "{]}";
+          break;
+
+        case '&':
+          szReplacement = "\\&";
+          break;
+
+        case '#':
+          szReplacement = "\\#";
+          break;
+
+        case '^':
+          szReplacement = "{\\textasciicircum}"; //"\\^";
+          break;
+
+        // Symbol '´':
+        // (use numeric form to be cross-architecture compatible)
+        case '\xB4':
+          szReplacement = "'";
+          break;
+
+        // Symbol '°':
+        // (use numeric form to be cross-architecture compatible)
+        case '\xBA':
+          szReplacement = "{\\textdegree}";
+          break;
+
+        case '|':
+          szReplacement = "{\\textbar}";
+          break;
+
+        case '<':
+          szReplacement = "{\\textless}";
+          break;
+
+        case '>':
+          szReplacement = "{\\textgreater}";
+          break;
+
+        default:
+          continue;
+      }
+
+      oOut_io.append( sText_i.data() + nCopyStart, c - nCopyStart );
+      oOut_io.append( szReplacement );
+      nCopyStart = c + 1;
+    }
+    oOut_io.append( sText_i.data() + nCopyStart, sText_i.size() - nCopyStart );
+  }
+}
 
 // -----------------------------------------------------------------------------
 
@@ -23,24 +181,37 @@
 
 // -----------------------------------------------------------------------------
 
-escrido::SWriteInfo::SWriteInfo( const std::vector <std::pair<std::string, std::string>>& oRelabelList_i ):
-  oRelabelList ( oRelabelList_i )
-{}
+escrido::SWriteInfo::SWriteInfo( const CRefTable& oRefTable_i,
+                                 const std::vector <std::pair<std::string, std::string>>& oRelabelList_i ):
+  oRefTable       ( oRefTable_i ),
+  oRelabelList    ( oRelabelList_i ),
+  fProgress       ( true ),
+  pLaTeXConverter ( &CLaTeXConverter::GetDefault() )
+{
+  // Resolve the terms of the built-in labels once. The relabel list is walked
+  // backwards, so the first replacement registered for a label is kept.
+  for( unsigned int l = 0; l < nLabelTypeN; ++l )
+    aszLabel[l] = aszLabelList[l];
+
+  for( size_t r = oRelabelList.size(); r-- > 0; )
+    for( unsigned int l = 0; l < nLabelTypeN; ++l )
+      if( oRelabelList[r].first == aszLabelList[l] )
+      {
+        aszLabel[l] = oRelabelList[r].second.c_str();
+        break;
+      }
+}
 
 // .............................................................................
 
 // *****************************************************************************
-/// \brief      Returns the label text or a registered replacement, if this
-///             exists.
+/// \brief      Returns the term of a built-in label, i.e. its default text or
+///             a registered replacement, if this exists.
 // *****************************************************************************
 
-const char* escrido::SWriteInfo::Label( const char* szLabel_i ) const
+const char* escrido::SWriteInfo::Label( label_type fLabel_i ) const
 {
-  for( size_t l = 0; l < oRelabelList.size(); ++l )
-    if( oRelabelList[l].first == szLabel_i )
-      return oRelabelList[l].second.c_str();
-
-  return szLabel_i;
+  return aszLabel[static_cast<unsigned int>( fLabel_i )];
 }
 
 // .............................................................................
@@ -84,16 +255,49 @@ const escrido::SWriteInfo escrido::SWriteInfo::operator--( int ) const
 
 // -----------------------------------------------------------------------------
 
+escrido::CContentChunk::SResolvedRef::SResolvedRef():
+  nRefStamp ( 0 ),
+  nRefIdx   ( std::string::npos )
+{}
+
+// .............................................................................
+
 escrido::CContentChunk::CContentChunk():
   fType           ( cont_chunk_type::UNDEFINED ),
-  fSkipFirstWhite ( skip_first_white::OFF )
+  fSkipFirstWhite ( skip_first_white::OFF ),
+  nTextPos        ( 0 ),
+  nTextLen        ( 0 ),
+  nRefSlot        ( 0 )
 {}
 
 // .............................................................................
 
 escrido::CContentChunk::CContentChunk( const cont_chunk_type fType_i ):
   fType           ( fType_i ),
-  fSkipFirstWhite ( skip_first_white::OFF )
+  fSkipFirstWhite ( skip_first_white::OFF ),
+  nTextPos        ( 0 ),
+  nTextLen        ( 0 ),
+  nRefSlot        ( 0 )
+{}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Constructs a REF or LINK chunk.
+///
+/// \param[in]  fType_i
+///             The chunk type.
+/// \param[in]  nRefSlot_i
+///             Index of the resolved reference in the side table of the block
+///             (see CTagBlock::oaRefList).
+// *****************************************************************************
+
+escrido::CContentChunk::CContentChunk( const cont_chunk_type fType_i, const uint32_t nRefSlot_i ):
+  fType           ( fType_i ),
+  fSkipFirstWhite ( skip_first_white::OFF ),
+  nTextPos        ( 0 ),
+  nTextLen        ( 0 ),
+  nRefSlot        ( nRefSlot_i )
 {}
 
 // .............................................................................
@@ -105,9 +309,10 @@ cont_chunk_type escrido::CContentChunk::GetType() const
 
 // .............................................................................
 
-std::string& escrido::CContentChunk::GetContent()
+/// Returns the text of the chunk.
+strview::CStrView escrido::CContentChunk::GetContent( const CTagBlock& oTagBlock_i ) const
 {
-  return sContent;
+  return strview::CStrView( oTagBlock_i.sText.data() + nTextPos, nTextLen );
 }
 
 // .............................................................................
@@ -119,14 +324,24 @@ void escrido::CContentChunk::SetSkipFirstWhiteMode( skip_first_white fSkipFirstW
 
 // .............................................................................
 
-std::string escrido::CContentChunk::GetPlainText() const
+// *****************************************************************************
+/// \brief      Returns the text of the chunk without first and last blank
+///             spaces.
+///
+/// \see        escrido::All()
+///
+/// \return     A view into the text buffer of the block (valid as long as the
+///             block is not changed).
+// *****************************************************************************
+
+strview::CStrView escrido::CContentChunk::GetPlainText( const CTagBlock& oTagBlock_i ) const
 {
   if( fType == cont_chunk_type::NEW_LINE )
-    return "\n";
+    return strview::CStrView( "\n", 1 );
 
-  std::string sReturn;
-  All( sContent, sReturn );
-  return sReturn;
+  strview::CStrView sAll;
+  All( this->GetContent( oTagBlock_i ), sAll );
+  return sAll;
 }
 
 // .............................................................................
@@ -138,15 +353,15 @@ std::string escrido::CContentChunk::GetPlainText() const
 /// \see        escrido::FirstWord()
 /// \see        escrido::MakeIdentifier()
 ///
-/// \return     The first word (w/o any blank space) or an empty string, if no
+/// \return     The first word (w/o any blank space) or an empty view, if no
 ///             first word exists.
 // *****************************************************************************
 
-std::string escrido::CContentChunk::GetPlainFirstWord() const
+strview::CStrView escrido::CContentChunk::GetPlainFirstWord( const CTagBlock& oTagBlock_i ) const
 {
-  std::string sReturn;
-  FirstWord( sContent, sReturn );
-  return sReturn;
+  strview::CStrView sFirstWord;
+  FirstWord( this->GetContent( oTagBlock_i ), sFirstWord );
+  return sFirstWord;
 }
 
 // .............................................................................
@@ -160,13 +375,14 @@ std::string escrido::CContentChunk::GetPlainFirstWord() const
 /// \see        escrido::MakeIdentifier()
 ///
 /// \return     The first word (w/o any blank space) or quote (w/o start and end
-///             quotation marks) or an empty string, if no first word or quote
+///             quotation marks) or an empty view, if no first word or quote
 ///             exists.
 // *****************************************************************************
 
-std::string escrido::CContentChunk::GetPlainFirstWordOrQuote() const
+strview::CStrView escrido::CContentChunk::GetPlainFirstWordOrQuote( const CTagBlock& oTagBlock_i ) const
 {
-  std::string sReturn;
+  const strview::CStrView sContent = this->GetContent( oTagBlock_i );
+  strview::CStrView sReturn;
   if( !FirstQuote( sContent, sReturn ) )
     FirstWord( sContent, sReturn );
   return sReturn;
@@ -181,14 +397,14 @@ std::string escrido::CContentChunk::GetPlainFirstWordOrQuote() const
 /// \see        escrido::AllButFirstWord()
 /// \see        escrido::MakeIdentifier()
 ///
-/// \return     The string after the first word and proceeding blank spaces or
-///             an empty string if no such string exists.
+/// \return     The text after the first word and proceeding blank spaces or
+///             an empty view if no such text exists.
 // *****************************************************************************
 
-std::string escrido::CContentChunk::GetPlainAllButFirstWord() const
+strview::CStrView escrido::CContentChunk::GetPlainAllButFirstWord( const CTagBlock& oTagBlock_i ) const
 {
-  std::string sReturn;
-  AllButFirstWord( sContent, sReturn );
+  strview::CStrView sReturn;
+  AllButFirstWord( this->GetContent( oTagBlock_i ), sReturn );
   return sReturn;
 }
 
@@ -201,20 +417,32 @@ std::string escrido::CContentChunk::GetPlainAllButFirstWord() const
 /// \see        escrido::FirstLine()
 /// \see        escrido::MakeIdentifier()
 ///
-/// \return     The first line or an empty string, if no
+/// \return     The first line or an empty view, if no
 ///             first word exists.
 // *****************************************************************************
 
-std::string escrido::CContentChunk::GetPlainFirstLine() const
+strview::CStrView escrido::CContentChunk::GetPlainFirstLine( const CTagBlock& oTagBlock_i ) const
 {
-  std::string sReturn;
-  FirstLine( sContent, sReturn );
+  strview::CStrView sReturn;
+  FirstLine( this->GetContent( oTagBlock_i ), sReturn );
   return sReturn;
 }
 
 // .............................................................................
 
-void escrido::CContentChunk::AppendChar( const char cChar_i )
+// *****************************************************************************
+/// \brief      Appends a character to the text of the chunk.
+///
+/// \details    The chunk has to be the last chunk of its block, since its text
+///             is extended at the end of the text buffer of the block.
+///
+/// \param[in]  sText_io
+///             The text buffer of the block.
+/// \param[in]  cChar_i
+///             The character.
+// *****************************************************************************
+
+void escrido::CContentChunk::AppendChar( std::string& sText_io, const char cChar_i )
 {
   // Check "skip first whitespace" mode.
   if( fSkipFirstWhite == skip_first_white::INIT )
@@ -227,142 +455,205 @@ void escrido::CContentChunk::AppendChar( const char cChar_i )
   // In HTML mode: skip multiple blank spaces.
   if( fType == cont_chunk_type::HTML_TEXT )
     if( cChar_i == ' ' )
-      if( !sContent.empty() )
-        if( sContent.back() == ' ' )
+      if( nTextLen != 0 )
+        if( sText_io.back() == ' ' )
           return;
 
-  sContent.push_back( cChar_i );
+  // The text of a chunk starts where the buffer ends on its first character.
+  if( nTextLen == 0 )
+    nTextPos = static_cast<uint32_t>( sText_io.size() );
+
+  sText_io.push_back( cChar_i );
+  nTextLen++;
+}
+
+// .............................................................................
+
+/// Removes one blank or tab at the end of the text of the chunk (which has to
+/// be the last chunk of its block).
+void escrido::CContentChunk::RemoveLastBlank( std::string& sText_io )
+{
+  if( nTextLen != 0 )
+    if( sText_io.back() == ' ' || sText_io.back() == '\t' )
+    {
+      sText_io.pop_back();
+      nTextLen--;
+    }
 }
 
 // .............................................................................
 
-void escrido::CContentChunk::WriteHTML( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+// *****************************************************************************
+/// \brief      Resolves the reference of a REF chunk against a reference table
+///             and splits the target and the display text of REF and LINK
+///             chunks, so the output methods only have to emit them.
+///
+/// \details    The result is valid as long as the reference table is not
+///             changed (see CRefTable::GetStamp()). The output methods
+///             resolve the chunk themselves if this is not the case.
+///
+/// \param[in]  oTagBlock_i
+///             The tag block of the chunk.
+/// \param[in]  oRefTable_i
+///             The reference table.
+///
+/// \return     'false' for a REF chunk whose target does not exist, 'true'
+///             otherwise.
+// *****************************************************************************
+
+bool escrido::CContentChunk::ResolveRef( const CTagBlock& oTagBlock_i, const CRefTable& oRefTable_i ) const
+{
+  if( fType != cont_chunk_type::REF && fType != cont_chunk_type::LINK )
+    return true;
+
+  SResolvedRef& oRef = oTagBlock_i.oaRefList[nRefSlot];
+  oRef.nRefStamp = oRefTable_i.GetStamp();
+
+  if( fType == cont_chunk_type::REF )
+  {
+    oRef.sRefTarget = MakeIdentifier( this->GetPlainFirstWord( oTagBlock_i ) );
+    if( !oRefTable_i.GetRefIdx( oRef.sRefTarget, oRef.nRefIdx ) )
+      oRef.nRefIdx = std::string::npos;
+
+    // Explicit text, the text of the referenced element or the raw content.
+    // (The strings of the slot are assigned in place to reuse their buffers.)
+    strview::CStrView sRefText = this->GetPlainAllButFirstWord( oTagBlock_i );
+    if( sRefText.empty() )
+      sRefText = ( oRef.nRefIdx != std::string::npos ? strview::CStrView( oRefTable_i.GetText( oRef.nRefIdx ) ) : this->GetContent( oTagBlock_i ) );
+    oRef.sRefText.assign( sRefText.data(), sRefText.size() );
+
+    return oRef.nRefIdx != std::string::npos;
+  }
+
+  const strview::CStrView sRefTarget = this->GetPlainFirstWord( oTagBlock_i );
+  const strview::CStrView sRefText = this->GetPlainAllButFirstWord( oTagBlock_i );
+  oRef.sRefTarget.assign( sRefTarget.data(), sRefTarget.size() );
+  oRef.sRefText.assign( sRefText.data(), sRefText.size() );
+  return true;
+}
+
+// .............................................................................
+
+/// Returns the reference identifier (REF) or URL (LINK) found by
+/// ResolveRef().
+const std::string& escrido::CContentChunk::GetRefTarget( const CTagBlock& oTagBlock_i ) const
+{
+  return oTagBlock_i.oaRefList[nRefSlot].sRefTarget;
+}
+
+// .............................................................................
+
+void escrido::CContentChunk::WriteHTML( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   switch( fType )
   {
     case cont_chunk_type::HTML_TEXT:
-      oOutStrm_i << sContent;
+      oOutBuf_i.append( oTagBlock_i.sText.data() + nTextPos, nTextLen );
       break;
 
     case cont_chunk_type::PLAIN_TEXT:
     {
       // Do HTML escaping of plain text.
-      oOutStrm_i << HTMLEscape( sContent );
+      HTMLEscape( this->GetContent( oTagBlock_i ), oOutBuf_i );
       break;
     }
 
     case cont_chunk_type::NEW_LINE:
-      oOutStrm_i << "<br>";
+      oOutBuf_i << "<br>";
       break;
 
     case cont_chunk_type::START_PARAGRAPH:
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<p>";
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<p>";
       break;
 
     case cont_chunk_type::END_PARAGRAPH:
-      oOutStrm_i << "</p>" << std::endl;
+      oOutBuf_i << "</p>" << '\n';
       --oWriteInfo_i;
       break;
 
     case cont_chunk_type::START_TABLE:
-      WriteHTMLTagLine( "<table>", oOutStrm_i, oWriteInfo_i++ );
-      WriteHTMLTagLine( "<tr>", oOutStrm_i, oWriteInfo_i++ );
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<td>";
+      WriteHTMLTagLine( "<table>", oOutBuf_i, oWriteInfo_i++ );
+      WriteHTMLTagLine( "<tr>", oOutBuf_i, oWriteInfo_i++ );
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<td>";
       break;
 
     case cont_chunk_type::END_TABLE:
-      oOutStrm_i << "</td>" << std::endl;
+      oOutBuf_i << "</td>" << '\n';
       --oWriteInfo_i;
-      WriteHTMLTagLine( "</tr>", oOutStrm_i, --oWriteInfo_i );
-      WriteHTMLTagLine( "</table>", oOutStrm_i, --oWriteInfo_i );
+      WriteHTMLTagLine( "</tr>", oOutBuf_i, --oWriteInfo_i );
+      WriteHTMLTagLine( "</table>", oOutBuf_i, --oWriteInfo_i );
       break;
 
     case cont_chunk_type::NEW_TABLE_CELL:
-      oOutStrm_i << "</td>" << std::endl;
+      oOutBuf_i << "</td>" << '\n';
       --oWriteInfo_i;
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<td>";
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<td>";
       break;
 
     case cont_chunk_type::NEW_TABLE_ROW:
-      oOutStrm_i << "</td>" << std::endl;
+      oOutBuf_i << "</td>" << '\n';
       --oWriteInfo_i;
-      WriteHTMLTagLine( "</tr>", oOutStrm_i, --oWriteInfo_i );
-      WriteHTMLTagLine( "<tr>", oOutStrm_i, oWriteInfo_i++ );
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<td>";
+      WriteHTMLTagLine( "</tr>", oOutBuf_i, --oWriteInfo_i );
+      WriteHTMLTagLine( "<tr>", oOutBuf_i, oWriteInfo_i++ );
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<td>";
       break;
 
     case cont_chunk_type::START_UL:
-      WriteHTMLTagLine( "<ul>", oOutStrm_i, oWriteInfo_i++ );
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<li>";
+      WriteHTMLTagLine( "<ul>", oOutBuf_i, oWriteInfo_i++ );
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<li>";
       break;
 
     case cont_chunk_type::END_UL:
-      oOutStrm_i << "</li>" << std::endl;
+      oOutBuf_i << "</li>" << '\n';
       --oWriteInfo_i;
-      WriteHTMLTagLine( "</ul>", oOutStrm_i, --oWriteInfo_i );
+      WriteHTMLTagLine( "</ul>", oOutBuf_i, --oWriteInfo_i );
       break;
 
     case cont_chunk_type::UL_ITEM:
-      oOutStrm_i << "</li>" << std::endl;
-      WriteHTMLIndents( oOutStrm_i, --oWriteInfo_i ) << "<li>";
+      oOutBuf_i << "</li>" << '\n';
+      WriteHTMLIndents( oOutBuf_i, --oWriteInfo_i ) << "<li>";
       ++oWriteInfo_i;
       break;
 
     case cont_chunk_type::REF:
     {
-      size_t nRefIdx;
-      bool fHasRef = oWriteInfo_i.oRefTable.GetRefIdx( MakeIdentifier( this->GetPlainFirstWord() ), nRefIdx );
-      if( fHasRef )
-        oOutStrm_i << "<a href=\"" + oWriteInfo_i.oRefTable.GetLink( nRefIdx ) + "\">";
+      const SResolvedRef& oRef = oTagBlock_i.oaRefList[nRefSlot];
+      if( oRef.nRefStamp != oWriteInfo_i.oRefTable.GetStamp() )
+        this->ResolveRef( oTagBlock_i, oWriteInfo_i.oRefTable );
 
-      std::string sText = this->GetPlainAllButFirstWord();
-      if( !sText.empty() )
-        oOutStrm_i << sText;
+      if( oRef.nRefIdx != std::string::npos )
+        oOutBuf_i << "<a href=\"" << oWriteInfo_i.oRefTable.GetLink( oRef.nRefIdx ) << "\">" << oRef.sRefText << "</a>";
       else
-      {
-        if( fHasRef )
-          oOutStrm_i << oWriteInfo_i.oRefTable.GetText( nRefIdx );
-        else
-          oOutStrm_i << sContent;
-      }
-
-      if( fHasRef )
-        oOutStrm_i << "</a>";
+        oOutBuf_i << oRef.sRefText;
       break;
     }
 
     case cont_chunk_type::START_CODE:
-      oOutStrm_i << "<span class=\"code\">";
+      oOutBuf_i << "<span class=\"code\">";
       break;
 
     case cont_chunk_type::END_CODE:
-      oOutStrm_i << "</span>";
+      oOutBuf_i << "</span>";
       break;
 
     case cont_chunk_type::LINK:
     {
-      std::string sHREF = this->GetPlainFirstWord();
-      if( !sHREF.empty() )
-      {
-        oOutStrm_i << "<a href=\"" << sHREF << "\" target=\"_blank\">";
+      const SResolvedRef& oRef = oTagBlock_i.oaRefList[nRefSlot];
+      if( oRef.nRefStamp != oWriteInfo_i.oRefTable.GetStamp() )
+        this->ResolveRef( oTagBlock_i, oWriteInfo_i.oRefTable );
 
-        std::string sText = this->GetPlainAllButFirstWord();
-        if( sText.empty() )
-          oOutStrm_i << sHREF;
-        else
-          oOutStrm_i << sText;
-
-        oOutStrm_i << "</a>";
-      }
+      if( !oRef.sRefTarget.empty() )
+        oOutBuf_i << "<a href=\"" << oRef.sRefTarget << "\" target=\"_blank\">"
+                  << ( oRef.sRefText.empty() ? oRef.sRefTarget : oRef.sRefText ) << "</a>";
       break;
     }
 
     case cont_chunk_type::START_VERBATIM:
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<pre>";
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<pre>";
       break;
 
     case cont_chunk_type::END_VERBATIM:
-      oOutStrm_i << "</pre>" << std::endl;
+      oOutBuf_i << "</pre>" << '\n';
       --oWriteInfo_i;
       break;
   }
@@ -379,23 +670,23 @@ void escrido::CContentChunk::WriteHTML( std::ostream& oOutStrm_i, const SWriteIn
 /// \return     True if one or more characters were written, false otherwise.
 // *****************************************************************************
 
-bool escrido::CContentChunk::WriteHTMLFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+bool escrido::CContentChunk::WriteHTMLFirstWord( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   // Get first word.
-  std::string sFirstWord;
-  if( !FirstWord( sContent, sFirstWord ) )
+  strview::CStrView sFirstWord;
+  if( !FirstWord( this->GetContent( oTagBlock_i ), sFirstWord ) )
     return false;
 
   // Chunk dependend writing of the word.
   switch( fType )
   {
     case cont_chunk_type::HTML_TEXT:
-      oOutStrm_i << sFirstWord;
+      oOutBuf_i << sFirstWord;
       return true;
 
     case cont_chunk_type::PLAIN_TEXT:
       // Do HTML escaping.
-      oOutStrm_i << HTMLEscape( sFirstWord );
+      HTMLEscape( sFirstWord, oOutBuf_i );
       return true;
 
     default:
@@ -414,23 +705,23 @@ bool escrido::CContentChunk::WriteHTMLFirstWord( std::ostream& oOutStrm_i, const
 /// \return     True if one or more characters were written, false otherwise.
 // *****************************************************************************
 
-bool escrido::CContentChunk::WriteHTMLAllButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+bool escrido::CContentChunk::WriteHTMLAllButFirstWord( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   // Get all-but-first-word.
-  std::string sAllButFirstWord;
-  if( !AllButFirstWord( sContent, sAllButFirstWord ) )
+  strview::CStrView sAllButFirstWord;
+  if( !AllButFirstWord( this->GetContent( oTagBlock_i ), sAllButFirstWord ) )
     return false;
 
   // Chunk dependend writing of the word.
   switch( fType )
   {
     case cont_chunk_type::HTML_TEXT:
-      oOutStrm_i << sAllButFirstWord;
+      oOutBuf_i << sAllButFirstWord;
       return true;
 
     case cont_chunk_type::PLAIN_TEXT:
       // Do HTML escaping.
-      oOutStrm_i << HTMLEscape( sAllButFirstWord );
+      HTMLEscape( sAllButFirstWord, oOutBuf_i );
       return true;
 
     default:
@@ -449,10 +740,11 @@ bool escrido::CContentChunk::WriteHTMLAllButFirstWord( std::ostream& oOutStrm_i,
 /// \return     True if one or more characters were written, false otherwise.
 // *****************************************************************************
 
-bool escrido::CContentChunk::WriteHTMLAllButFirstWordOrQuote( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+bool escrido::CContentChunk::WriteHTMLAllButFirstWordOrQuote( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   // Get all-but-first-word-or-quote.
-  std::string sAllButFirstWordOrQuote;
+  const strview::CStrView sContent = this->GetContent( oTagBlock_i );
+  strview::CStrView sAllButFirstWordOrQuote;
   if( !AllButFirstQuote( sContent, sAllButFirstWordOrQuote ) )
     if( !AllButFirstWord( sContent, sAllButFirstWordOrQuote ) )
       return false;
@@ -461,12 +753,12 @@ bool escrido::CContentChunk::WriteHTMLAllButFirstWordOrQuote( std::ostream& oOut
   switch( fType )
   {
     case cont_chunk_type::HTML_TEXT:
-      oOutStrm_i << sAllButFirstWordOrQuote;
+      oOutBuf_i << sAllButFirstWordOrQuote;
       return true;
 
     case cont_chunk_type::PLAIN_TEXT:
       // Do HTML escaping.
-      oOutStrm_i << HTMLEscape( sAllButFirstWordOrQuote );
+      HTMLEscape( sAllButFirstWordOrQuote, oOutBuf_i );
       return true;
 
     default:
@@ -476,30 +768,30 @@ bool escrido::CContentChunk::WriteHTMLAllButFirstWordOrQuote( std::ostream& oOut
 
 // .............................................................................
 
-void escrido::CContentChunk::WriteLaTeX( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CContentChunk::WriteLaTeX( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   switch( fType )
   {
     case cont_chunk_type::HTML_TEXT:
-      oOutStrm_i << ConvertHTML2LaTeX( sContent );
+      oWriteInfo_i.pLaTeXConverter->Convert( oTagBlock_i.sText.data() + nTextPos, nTextLen, oOutBuf_i );
       break;
 
     case cont_chunk_type::PLAIN_TEXT:
     {
       // Do LaTeX escaping of plain text.
-      oOutStrm_i << LaTeXEscape( sContent );
+      LaTeXEscape( this->GetContent( oTagBlock_i ), oOutBuf_i );
       break;
     }
 
     case cont_chunk_type::NEW_LINE:
-      oOutStrm_i << "\n";
+      oOutBuf_i << "\n";
       break;
 
     case cont_chunk_type::START_PARAGRAPH:
       break;
 
     case cont_chunk_type::END_PARAGRAPH:
-      oOutStrm_i << std::endl << std::endl;
+      oOutBuf_i << '\n' << '\n';
       break;
 
     case cont_chunk_type::START_TABLE:
@@ -523,102 +815,107 @@ void escrido::CContentChunk::WriteLaTeX( std::ostream& oOutStrm_i, const SWriteI
           if( pNextContentChunk->fType == cont_chunk_type::NEW_TABLE_CELL )
             nColN++;
 
-          pNextContentChunk = oWriteInfo_i.pTagBlock->GetNextContentChunk( pNextContentChunk );
+          pNextContentChunk = oTagBlock_i.GetNextContentChunk( pNextContentChunk );
         }
       }
 
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "\\noindent\\parbox{\\textwidth}{%" << std::endl;
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\tymin=" << 1.0 / ( nMaxColN + 1 ) << "\\textwidth%" << std::endl;
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\centering%" << std::endl;
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\begin{tabulary}{\\textwidth}{";
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "\\noindent\\parbox{\\textwidth}{%" << '\n';
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\tymin=" << 1.0 / ( nMaxColN + 1 ) << "\\textwidth%" << '\n';
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\centering%" << '\n';
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\begin{tabulary}{\\textwidth}{";
       for( int i = 0; i < nMaxColN; i++ )
-        oOutStrm_i << "L";
-      oOutStrm_i << "}" << std::endl;
+        oOutBuf_i << "L";
+      oOutBuf_i << "}" << '\n';
       ++oWriteInfo_i;
       break;
     }
 
     case cont_chunk_type::END_TABLE:
-      oOutStrm_i << std::endl;
-      WriteHTMLIndents( oOutStrm_i, --oWriteInfo_i ) << "\\end{tabulary}" << std::endl;
-      WriteHTMLIndents( oOutStrm_i, --oWriteInfo_i ) << "}" << std::endl;
+      oOutBuf_i << '\n';
+      WriteHTMLIndents( oOutBuf_i, --oWriteInfo_i ) << "\\end{tabulary}" << '\n';
+      WriteHTMLIndents( oOutBuf_i, --oWriteInfo_i ) << "}" << '\n';
       break;
 
     case cont_chunk_type::NEW_TABLE_CELL:
-      oOutStrm_i << " & ";
+      oOutBuf_i << " & ";
       break;
 
     case cont_chunk_type::NEW_TABLE_ROW:
-      oOutStrm_i << " \\\\" << std::endl;
+      oOutBuf_i << " \\\\" << '\n';
       break;
 
     case cont_chunk_type::START_UL:
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "\\noindent\\parbox{\\textwidth}{%" << std::endl;
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "\\begin{itemize}" << std::endl;
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\item ";
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "\\noindent\\parbox{\\textwidth}{%" << '\n';
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "\\begin{itemize}" << '\n';
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\item ";
       break;
 
     case cont_chunk_type::END_UL:
-      oOutStrm_i << std::endl;
-      WriteHTMLIndents( oOutStrm_i, --oWriteInfo_i ) << "\\end{itemize}" << std::endl;
-      WriteHTMLIndents( oOutStrm_i, --oWriteInfo_i ) << "}" << std::endl;
+      oOutBuf_i << '\n';
+      WriteHTMLIndents( oOutBuf_i, --oWriteInfo_i ) << "\\end{itemize}" << '\n';
+      WriteHTMLIndents( oOutBuf_i, --oWriteInfo_i ) << "}" << '\n';
       break;
 
     case cont_chunk_type::UL_ITEM:
-      oOutStrm_i << std::endl;
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\item ";
+      oOutBuf_i << '\n';
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\item ";
       break;
 
     case cont_chunk_type::REF:
     {
-      size_t nRefIdx;
-      bool fHasRef = oWriteInfo_i.oRefTable.GetRefIdx( MakeIdentifier( this->GetPlainFirstWord() ), nRefIdx );
-      if( fHasRef )
-        oOutStrm_i << "\\robusthyperref{" << MakeIdentifier( this->GetPlainFirstWord() ) << "}{";
+      const SResolvedRef& oRef = oTagBlock_i.oaRefList[nRefSlot];
+      if( oRef.nRefStamp != oWriteInfo_i.oRefTable.GetStamp() )
+        this->ResolveRef( oTagBlock_i, oWriteInfo_i.oRefTable );
 
-      std::string sText = this->GetPlainAllButFirstWord();
-      if( !sText.empty() )
-        oOutStrm_i << ConvertHTML2LaTeX( sText );
+      if( oRef.nRefIdx != std::string::npos )
+      {
+        oOutBuf_i << "\\robusthyperref{" << oRef.sRefTarget << "}{";
+        ConvertHTML2LaTeX( oRef.sRefText, oOutBuf_i, oWriteInfo_i );
+        oOutBuf_i << "}";
+      }
       else
-        if( fHasRef )
-          oOutStrm_i << ConvertHTML2LaTeX( oWriteInfo_i.oRefTable.GetText( nRefIdx ) );
-        else
-          oOutStrm_i << ConvertHTML2LaTeX( sContent );
-
-      if( fHasRef )
-        oOutStrm_i << "}";
+        ConvertHTML2LaTeX( oRef.sRefText, oOutBuf_i, oWriteInfo_i );
       break;
     }
 
     case cont_chunk_type::START_CODE:
-      oOutStrm_i << "\\code{";
+      oOutBuf_i << "\\code{";
       break;
 
     case cont_chunk_type::END_CODE:
-      oOutStrm_i << "}";
+      oOutBuf_i << "}";
       break;
 
     case cont_chunk_type::LINK:
     {
-      std::string sHREF = this->GetPlainFirstWord();
-      if( !sHREF.empty() )
+      const SResolvedRef& oRef = oTagBlock_i.oaRefList[nRefSlot];
+      if( oRef.nRefStamp != oWriteInfo_i.oRefTable.GetStamp() )
+        this->ResolveRef( oTagBlock_i, oWriteInfo_i.oRefTable );
+
+      if( !oRef.sRefTarget.empty() )
       {
-        oOutStrm_i << "\\url{" << ConvertHTML2LaTeX( sHREF ) << "}";
+        oOutBuf_i << "\\url{";
+        ConvertHTML2LaTeX( oRef.sRefTarget, oOutBuf_i, oWriteInfo_i );
+        oOutBuf_i << "}";
 
-        std::string sText = ConvertHTML2LaTeX( this->GetPlainAllButFirstWord() );
+        std::string sText = oWriteInfo_i.pLaTeXConverter->Convert( oRef.sRefText );
         if( !sText.empty() )
-          oOutStrm_i << "{"<< ConvertHTML2LaTeX( sText ) << "}";
+        {
+          oOutBuf_i << "{";
+          ConvertHTML2LaTeX( sText, oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "}";
+        }
       }
       break;
     }
 
     case cont_chunk_type::START_VERBATIM:
-      oOutStrm_i << "\\begin{verbatim}" << std::endl;
+      oOutBuf_i << "\\begin{verbatim}" << '\n';
       break;
 
     case cont_chunk_type::END_VERBATIM:
-      oOutStrm_i << std::endl;
-      oOutStrm_i << "\\end{verbatim}" << std::endl;
+      oOutBuf_i << '\n';
+      oOutBuf_i << "\\end{verbatim}" << '\n';
       break;
   }
 }
@@ -634,23 +931,23 @@ void escrido::CContentChunk::WriteLaTeX( std::ostream& oOutStrm_i, const SWriteI
 /// \return     True if one or more characters were written, false otherwise.
 // *****************************************************************************
 
-bool escrido::CContentChunk::WriteLaTeXFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+bool escrido::CContentChunk::WriteLaTeXFirstWord( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   // Get first word.
-  std::string sFirstWord;
-  if( !FirstWord( sContent, sFirstWord ) )
+  strview::CStrView sFirstWord;
+  if( !FirstWord( this->GetContent( oTagBlock_i ), sFirstWord ) )
     return false;
 
   // Chunk dependend writing of the word.
   switch( fType )
   {
     case cont_chunk_type::HTML_TEXT:
-      oOutStrm_i << ConvertHTML2LaTeX( sFirstWord );
+      ConvertHTML2LaTeX( sFirstWord, oOutBuf_i, oWriteInfo_i );
       return true;
 
     case cont_chunk_type::PLAIN_TEXT:
       // Do LaTeX escaping.
-      oOutStrm_i << LaTeXEscape( sFirstWord );
+      LaTeXEscape( sFirstWord, oOutBuf_i );
       return true;
 
     default:
@@ -669,23 +966,23 @@ bool escrido::CContentChunk::WriteLaTeXFirstWord( std::ostream& oOutStrm_i, cons
 /// \return     True if one or more characters were written, false otherwise.
 // *****************************************************************************
 
-bool escrido::CContentChunk::WriteLaTeXAllButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+bool escrido::CContentChunk::WriteLaTeXAllButFirstWord( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   // Get all-but-first-word.
-  std::string sAllButFirstWord ;
-  if( !AllButFirstWord( sContent, sAllButFirstWord ) )
+  strview::CStrView sAllButFirstWord;
+  if( !AllButFirstWord( this->GetContent( oTagBlock_i ), sAllButFirstWord ) )
     return false;
 
   // Chunk dependend writing of the word.
   switch( fType )
   {
     case cont_chunk_type::HTML_TEXT:
-      oOutStrm_i << ConvertHTML2LaTeX( sAllButFirstWord );
+      ConvertHTML2LaTeX( sAllButFirstWord, oOutBuf_i, oWriteInfo_i );
       return true;
 
     case cont_chunk_type::PLAIN_TEXT:
       // Do LaTeX escaping.
-      oOutStrm_i << LaTeXEscape( sAllButFirstWord );
+      LaTeXEscape( sAllButFirstWord, oOutBuf_i );
       return true;
 
     default:
@@ -704,10 +1001,11 @@ bool escrido::CContentChunk::WriteLaTeXAllButFirstWord( std::ostream& oOutStrm_i
 /// \return     True if one or more characters were written, false otherwise.
 // *****************************************************************************
 
-bool escrido::CContentChunk::WriteLaTeXAllButFirstWordOrQuote( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+bool escrido::CContentChunk::WriteLaTeXAllButFirstWordOrQuote( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   // Get all-but-first-word-or-quote.
-  std::string sAllButFirstWordOrQuote;
+  const strview::CStrView sContent = this->GetContent( oTagBlock_i );
+  strview::CStrView sAllButFirstWordOrQuote;
   if( !AllButFirstQuote( sContent, sAllButFirstWordOrQuote ) )
     if( !AllButFirstWord( sContent, sAllButFirstWordOrQuote ) )
       return false;
@@ -716,12 +1014,12 @@ bool escrido::CContentChunk::WriteLaTeXAllButFirstWordOrQuote( std::ostream& oOu
   switch( fType )
   {
     case cont_chunk_type::HTML_TEXT:
-      oOutStrm_i << ConvertHTML2LaTeX( sAllButFirstWordOrQuote );
+      ConvertHTML2LaTeX( sAllButFirstWordOrQuote, oOutBuf_i, oWriteInfo_i );
       return true;
 
     case cont_chunk_type::PLAIN_TEXT:
       // Do LaTeX escaping.
-      oOutStrm_i << LaTeXEscape( sAllButFirstWordOrQuote );
+      LaTeXEscape( sAllButFirstWordOrQuote, oOutBuf_i );
       return true;
 
     default:
@@ -731,9 +1029,51 @@ bool escrido::CContentChunk::WriteLaTeXAllButFirstWordOrQuote( std::ostream& oOu
 
 // .............................................................................
 
-void escrido::CContentChunk::DebugOutput() const
+// *****************************************************************************
+/// \brief      Appends the binary representation of the chunk to a buffer.
+// *****************************************************************************
+
+void escrido::CContentChunk::Serialize( std::string& sBuffer_io ) const
 {
-  std::cout << "chunk type: " << (int) fType << ", content: '" << sContent << "'";
+  binstream::Write( sBuffer_io, fType );
+  binstream::Write( sBuffer_io, fSkipFirstWhite );
+  binstream::Write( sBuffer_io, nTextPos );
+  binstream::Write( sBuffer_io, nTextLen );
+  binstream::Write( sBuffer_io, nRefSlot );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Restores the chunk from its binary representation.
+///
+/// \return     'true' on success, 'false' if the buffer is corrupted.
+// *****************************************************************************
+
+bool escrido::CContentChunk::Deserialize( const char*& pPos_io, const char* pEnd_i, const CTagBlock& oTagBlock_i )
+{
+  if( !binstream::Read( pPos_io, pEnd_i, fType ) ||
+      !binstream::Read( pPos_io, pEnd_i, fSkipFirstWhite ) ||
+      !binstream::Read( pPos_io, pEnd_i, nTextPos ) ||
+      !binstream::Read( pPos_io, pEnd_i, nTextLen ) ||
+      !binstream::Read( pPos_io, pEnd_i, nRefSlot ) )
+    return false;
+
+  // The text has to lie within the text buffer and references need a slot.
+  if( nTextPos > oTagBlock_i.sText.size() || nTextLen > oTagBlock_i.sText.size() - nTextPos )
+    return false;
+  if( ( fType == cont_chunk_type::REF || fType == cont_chunk_type::LINK ) &&
+      nRefSlot >= oTagBlock_i.oaRefList.size() )
+    return false;
+
+  return true;
+}
+
+// .............................................................................
+
+void escrido::CContentChunk::DebugOutput( const CTagBlock& oTagBlock_i ) const
+{
+  std::cout << "chunk type: " << (int) fType << ", content: '" << this->GetContent( oTagBlock_i ) << "'";
 }
 
 // -----------------------------------------------------------------------------
@@ -778,7 +1118,7 @@ bool escrido::CTagBlock::Empty() const
     return true;
   else
     if( oaChunkList.size() == 1 )
-      if( oaChunkList[0].GetPlainText().empty() )
+      if( oaChunkList[0].GetPlainText( *this ).empty() )
         return true;
 
   return false;
@@ -851,9 +1191,7 @@ void escrido::CTagBlock::CloseWrite()
 std::string escrido::CTagBlock::GetPlainText() const
 {
   std::string sReturn;
-  for( size_t c = 0; c < oaChunkList.size(); c++ )
-    sReturn += oaChunkList[c].GetPlainText();
-
+  this->GetPlainText( sReturn );
   return sReturn;
 }
 
@@ -869,15 +1207,7 @@ std::string escrido::CTagBlock::GetPlainText() const
 
 std::string escrido::CTagBlock::GetPlainFirstWord() const
 {
-  std::string sReturn;
-  for( size_t c = 0; c < oaChunkList.size(); c++ )
-  {
-    sReturn = oaChunkList[c].GetPlainFirstWord();
-    if( !sReturn.empty() )
-      break;
-  }
-
-  return sReturn;
+  return this->GetPlainFirstWordView().str();
 }
 
 // .............................................................................
@@ -894,15 +1224,7 @@ std::string escrido::CTagBlock::GetPlainFirstWord() const
 
 std::string escrido::CTagBlock::GetPlainFirstWordOrQuote() const
 {
-  std::string sReturn;
-  for( size_t c = 0; c < oaChunkList.size(); c++ )
-  {
-    sReturn = oaChunkList[c].GetPlainFirstWordOrQuote();
-    if( !sReturn.empty() )
-      break;
-  }
-
-  return sReturn;
+  return this->GetPlainFirstWordOrQuoteView().str();
 }
 
 // .............................................................................
@@ -918,40 +1240,129 @@ std::string escrido::CTagBlock::GetPlainFirstWordOrQuote() const
 std::string escrido::CTagBlock::GetPlainTitleLine() const
 {
   std::string sReturn;
+  this->GetPlainTitleLine( sReturn );
+  return sReturn;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the title line (i.e. the first line up to the title
+///             delimitor chunk) without the first word of the tag block.
+///
+/// \return     The title line without the first word
+///             or an empty string, if no first word or quote
+///             exists.
+// *****************************************************************************
+
+std::string escrido::CTagBlock::GetPlainTitleLineButFirstWord() const
+{
+  std::string sReturn;
+  this->GetPlainTitleLineButFirstWord( sReturn );
+  return sReturn;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the first word (i.e. the first group of non-blank space
+///             characters) of the tag block without copying it.
+///
+/// \return     A view into the text buffer of the block (valid as long as the
+///             block is not changed) or an empty view, if no first word exists.
+// *****************************************************************************
+
+strview::CStrView escrido::CTagBlock::GetPlainFirstWordView() const
+{
+  for( size_t c = 0; c < oaChunkList.size(); c++ )
+  {
+    const strview::CStrView sFirstWord = oaChunkList[c].GetPlainFirstWord( *this );
+    if( !sFirstWord.empty() )
+      return sFirstWord;
+  }
+
+  return strview::CStrView();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the first word or the first quote (see
+///             GetPlainFirstWordOrQuote()) of the tag block without copying it.
+///
+/// \return     A view into the text buffer of the block (valid as long as the
+///             block is not changed) or an empty view, if no first word or
+///             quote exists.
+// *****************************************************************************
+
+strview::CStrView escrido::CTagBlock::GetPlainFirstWordOrQuoteView() const
+{
+  for( size_t c = 0; c < oaChunkList.size(); c++ )
+  {
+    const strview::CStrView sFirstWordOrQuote = oaChunkList[c].GetPlainFirstWordOrQuote( *this );
+    if( !sFirstWordOrQuote.empty() )
+      return sFirstWordOrQuote;
+  }
+
+  return strview::CStrView();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the plain text of the tag block in a string whose
+///             buffer is reused (e.g. by calling this in a loop).
+// *****************************************************************************
+
+void escrido::CTagBlock::GetPlainText( std::string& sText_o ) const
+{
+  sText_o.clear();
+  for( size_t c = 0; c < oaChunkList.size(); c++ )
+  {
+    const strview::CStrView sText = oaChunkList[c].GetPlainText( *this );
+    sText_o.append( sText.data(), sText.size() );
+  }
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the title line (see GetPlainTitleLine()) in a string
+///             whose buffer is reused (e.g. by calling this in a loop).
+// *****************************************************************************
+
+void escrido::CTagBlock::GetPlainTitleLine( std::string& sTitleLine_o ) const
+{
+  sTitleLine_o.clear();
 
   // Loop through all text chunks until the title line delimitor is reached.
-  size_t c = 0;
   for( size_t c = 0; c < oaChunkList.size(); c++ )
   {
     // Break off in the title line delimitor is reached.
     if( oaChunkList[c].GetType() == cont_chunk_type::DELIM_TITLE_LINE )
-      return sReturn;
+      return;
 
     // Skip writing start and end paragraphs.
     if( oaChunkList[c].GetType() == cont_chunk_type::START_PARAGRAPH ||
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    sReturn += oaChunkList[c].GetPlainText();
+    const strview::CStrView sText = oaChunkList[c].GetPlainText( *this );
+    sTitleLine_o.append( sText.data(), sText.size() );
   }
-
-  return sReturn;
 }
 
 // .............................................................................
 
 // *****************************************************************************
-/// \brief      Returns the title line (i.e. the first line up to the title
-///             delimitor chunk) without the first word of the tag block.
-///
-/// \return     The title line without the first word
-///             or an empty string, if no first word or quote
-///             exists.
+/// \brief      Returns the title line without the first word (see
+///             GetPlainTitleLineButFirstWord()) in a string whose buffer is
+///             reused (e.g. by calling this in a loop).
 // *****************************************************************************
 
-std::string escrido::CTagBlock::GetPlainTitleLineButFirstWord() const
+void escrido::CTagBlock::GetPlainTitleLineButFirstWord( std::string& sTitleLine_o ) const
 {
-  std::string sReturn;
+  sTitleLine_o.clear();
 
   // Loop through all text chunks until something after the first word was written.
   size_t c = 0;
@@ -959,16 +1370,17 @@ std::string escrido::CTagBlock::GetPlainTitleLineButFirstWord() const
   {
     // Break off in the title line delimitor is reached.
     if( oaChunkList[c].GetType() == cont_chunk_type::DELIM_TITLE_LINE )
-      return sReturn;
+      return;
 
     // Skip writing start and end paragraphs.
     if( oaChunkList[c].GetType() == cont_chunk_type::START_PARAGRAPH ||
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    if( !oaChunkList[c].GetPlainFirstWord().empty() )
+    if( !oaChunkList[c].GetPlainFirstWord( *this ).empty() )
     {
-      sReturn += oaChunkList[c].GetPlainAllButFirstWord();
+      const strview::CStrView sText = oaChunkList[c].GetPlainAllButFirstWord( *this );
+      sTitleLine_o.append( sText.data(), sText.size() );
       break;
     }
   }
@@ -978,17 +1390,27 @@ std::string escrido::CTagBlock::GetPlainTitleLineButFirstWord() const
   {
     // Break off in the title line delimitor is reached.
     if( oaChunkList[c].GetType() == cont_chunk_type::DELIM_TITLE_LINE )
-      return sReturn;
+      return;
 
     // Skip writing start and end paragraphs.
     if( oaChunkList[c].GetType() == cont_chunk_type::START_PARAGRAPH ||
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    sReturn += oaChunkList[c].GetPlainText();
+    const strview::CStrView sText = oaChunkList[c].GetPlainText( *this );
+    sTitleLine_o.append( sText.data(), sText.size() );
   }
+}
 
-  return sReturn;
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the number of content chunks of the block.
+// *****************************************************************************
+
+size_t escrido::CTagBlock::GetChunkN() const
+{
+  return oaChunkList.size();
 }
 
 // .............................................................................
@@ -1036,7 +1458,7 @@ void escrido::CTagBlock::AppendChar( const char cChar_i )
         // Append the character to the latest chunk that accepts the identifier and/or text.
         // Note: the chunk list cannot be empty at that point since otherwise
         // the "append an identifier and a text" mode would be OFF.
-        oaChunkList.back().AppendChar( cChar_i );
+        oaChunkList.back().AppendChar( sText, cChar_i );
       }
       return;
     }
@@ -1052,7 +1474,7 @@ void escrido::CTagBlock::AppendChar( const char cChar_i )
         // Append the character to the latest chunk that accepts the identifier and/or text.
         // Note: the chunk list cannot be empty at that point since otherwise
         // the "append an identifier and a text" mode would be OFF.
-        oaChunkList.back().AppendChar( cChar_i );
+        oaChunkList.back().AppendChar( sText, cChar_i );
       }
       return;
     }
@@ -1065,7 +1487,7 @@ void escrido::CTagBlock::AppendChar( const char cChar_i )
         // => Character belongs to identifier.
 
         // Append character to the latest chunk.
-        oaChunkList.back().AppendChar( cChar_i );
+        oaChunkList.back().AppendChar( sText, cChar_i );
       }
       else
       {
@@ -1100,7 +1522,7 @@ void escrido::CTagBlock::AppendChar( const char cChar_i )
         // => Character belongs to uri.
 
         // Append character to the latest chunk.
-        oaChunkList.back().AppendChar( cChar_i );
+        oaChunkList.back().AppendChar( sText, cChar_i );
       }
       else
       {
@@ -1120,7 +1542,7 @@ void escrido::CTagBlock::AppendChar( const char cChar_i )
           // => Alternative text follows.
 
           // Append one blank space to the latest chunk.
-          oaChunkList.back().AppendChar( ' ' );
+          oaChunkList.back().AppendChar( sText, ' ' );
 
           // Switch "append an identifier and a text" mode to "TEXT".
           this->fAppIdentTextMode = append_ident_text_mode::TEXT;
@@ -1149,7 +1571,7 @@ void escrido::CTagBlock::AppendChar( const char cChar_i )
         // => Character belongs to text.
 
         // Append character to the latest chunk.
-        oaChunkList.back().AppendChar( cChar_i );
+        oaChunkList.back().AppendChar( sText, cChar_i );
       }
       else
       {
@@ -1314,11 +1736,7 @@ void escrido::CTagBlock::AppendInlineTag( tag_type fTagType_i )
     {
       // Eventually delete one last whitespace before end code.
       if( this->oaChunkList.back().GetType() == cont_chunk_type::PLAIN_TEXT )
-      {
-        std::string& sCodeText = this->oaChunkList.back().GetContent();
-        if( sCodeText.back() == ' ' || sCodeText.back() == '\t' )
-          sCodeText.pop_back();
-      }
+        this->oaChunkList.back().RemoveLastBlank( sText );
 
       this->oaChunkList.emplace_back( cont_chunk_type::END_CODE );
       break;
@@ -1335,7 +1753,8 @@ void escrido::CTagBlock::AppendInlineTag( tag_type fTagType_i )
         oaChunkList.emplace_back( cont_chunk_type::START_PARAGRAPH );
       }
 
-      this->oaChunkList.emplace_back( cont_chunk_type::LINK );
+      this->oaChunkList.emplace_back( cont_chunk_type::LINK, static_cast<uint32_t>( oaRefList.size() ) );
+      this->oaRefList.emplace_back();
       this->fAppIdentTextMode = append_ident_text_mode::INIT_URI;
       break;
     }
@@ -1398,7 +1817,8 @@ void escrido::CTagBlock::AppendInlineTag( tag_type fTagType_i )
         oaChunkList.emplace_back( cont_chunk_type::START_PARAGRAPH );
       }
 
-      this->oaChunkList.emplace_back( cont_chunk_type::REF );
+      this->oaChunkList.emplace_back( cont_chunk_type::REF, static_cast<uint32_t>( oaRefList.size() ) );
+      this->oaRefList.emplace_back();
       this->fAppIdentTextMode = append_ident_text_mode::INIT_IDENT;
       break;
     }
@@ -1609,43 +2029,84 @@ void escrido::CTagBlock::AppendDoubleNewLine()
 
 // .............................................................................
 
+// *****************************************************************************
+/// \brief      Resolves the REF and LINK chunks of the block (see
+///             CContentChunk::ResolveRef()).
+///
+/// \param[in]  oRefTable_i
+///             The reference table.
+/// \param[out] asUnresolved_o
+///             The identifiers of unresolved references are appended to this
+///             list.
+// *****************************************************************************
+
+void escrido::CTagBlock::ResolveRefs( const CRefTable& oRefTable_i, std::vector<std::string>& asUnresolved_o ) const
+{
+  for( size_t c = 0; c < oaChunkList.size(); c++ )
+    if( oaChunkList[c].GetType() == cont_chunk_type::REF ||
+        oaChunkList[c].GetType() == cont_chunk_type::LINK )
+      if( !oaChunkList[c].ResolveRef( *this, oRefTable_i ) )
+        asUnresolved_o.push_back( oaChunkList[c].GetRefTarget( *this ) );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Stream adapters of WriteHTML() and WriteLaTeX() for code
+///             writing to std::ostream. The output is collected in an output
+///             buffer that is passed on to the stream.
+// *****************************************************************************
+
 void escrido::CTagBlock::WriteHTML( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
+  outbuf::COutBuffer oOutBuf( oOutStrm_i );
+  this->WriteHTML( oOutBuf, oWriteInfo_i );
+}
+
+// .............................................................................
+
+void escrido::CTagBlock::WriteLaTeX( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+{
+  outbuf::COutBuffer oOutBuf( oOutStrm_i );
+  this->WriteLaTeX( oOutBuf, oWriteInfo_i );
+}
+
+// .............................................................................
 
+void escrido::CTagBlock::WriteHTML( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
+{
   switch( this->fType )
   {
     case tag_type::ATTRIBUTE:
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<dt>";
-      WriteHTMLFirstWord( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "</dt>" << std::endl;
-      WriteHTMLTagLine( "<dd>", oOutStrm_i, oWriteInfo_i++ );
-      WriteHTMLAllButFirstWord( oOutStrm_i, oWriteInfo_i );
-      WriteHTMLTagLine( "</dd>", oOutStrm_i, --oWriteInfo_i );
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<dt>";
+      WriteHTMLFirstWord( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "</dt>" << '\n';
+      WriteHTMLTagLine( "<dd>", oOutBuf_i, oWriteInfo_i++ );
+      WriteHTMLAllButFirstWord( oOutBuf_i, oWriteInfo_i );
+      WriteHTMLTagLine( "</dd>", oOutBuf_i, --oWriteInfo_i );
       break;
     }
 
     case tag_type::FEATURE:
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<dt>";
-      WriteHTMLTitleLineButFirstWordOrQuote( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "</dt>" << std::endl;
-      WriteHTMLTagLine( "<dd>", oOutStrm_i, oWriteInfo_i++ );
-      WriteHTMLAllButTitleLine( oOutStrm_i, oWriteInfo_i );
-      WriteHTMLTagLine( "</dd>", oOutStrm_i, --oWriteInfo_i );
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<dt>";
+      WriteHTMLTitleLineButFirstWordOrQuote( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "</dt>" << '\n';
+      WriteHTMLTagLine( "<dd>", oOutBuf_i, oWriteInfo_i++ );
+      WriteHTMLAllButTitleLine( oOutBuf_i, oWriteInfo_i );
+      WriteHTMLTagLine( "</dd>", oOutBuf_i, --oWriteInfo_i );
       break;
     }
 
     case tag_type::PARAM:
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<dt>";
-      WriteHTMLFirstWord( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "</dt>" << std::endl;
-      WriteHTMLTagLine( "<dd>", oOutStrm_i, oWriteInfo_i++ );
-      WriteHTMLAllButFirstWord( oOutStrm_i, oWriteInfo_i );
-      WriteHTMLTagLine( "</dd>", oOutStrm_i, --oWriteInfo_i );
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<dt>";
+      WriteHTMLFirstWord( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "</dt>" << '\n';
+      WriteHTMLTagLine( "<dd>", oOutBuf_i, oWriteInfo_i++ );
+      WriteHTMLAllButFirstWord( oOutBuf_i, oWriteInfo_i );
+      WriteHTMLTagLine( "</dd>", oOutBuf_i, --oWriteInfo_i );
       break;
     }
 
@@ -1653,33 +2114,33 @@ void escrido::CTagBlock::WriteHTML( std::ostream& oOutStrm_i, const SWriteInfo&
     {
       if( !this->oaChunkList.empty() )
       {
-        WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<li>";
+        WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<li>";
         size_t nRefIdx;
-        if( oWriteInfo_i.oRefTable.GetRefIdx( MakeIdentifier( this->GetPlainFirstWord() ), nRefIdx ) )
+        if( oWriteInfo_i.oRefTable.GetRefIdx( MakeIdentifier( this->GetPlainFirstWordView() ), nRefIdx ) )
         {
-          oOutStrm_i << "<a href=\"" + oWriteInfo_i.oRefTable.GetLink( nRefIdx ) + "\">";
-          oOutStrm_i << oWriteInfo_i.oRefTable.GetText( nRefIdx );
-          oOutStrm_i << "</a>";
+          oOutBuf_i << "<a href=\"" << oWriteInfo_i.oRefTable.GetLink( nRefIdx ) << "\">";
+          oOutBuf_i << oWriteInfo_i.oRefTable.GetText( nRefIdx );
+          oOutBuf_i << "</a>";
         }
         else
-          WriteHTMLFirstWord( oOutStrm_i, oWriteInfo_i );
-        oOutStrm_i << "</li>"<< std::endl;
+          WriteHTMLFirstWord( oOutBuf_i, oWriteInfo_i );
+        oOutBuf_i << "</li>"<< '\n';
       }
       break;
     }
 
     case tag_type::SIGNATURE:
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<li>";
-      WriteHTMLTitleLine( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "</li>" << std::endl;
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<li>";
+      WriteHTMLTitleLine( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "</li>" << '\n';
       break;
     }
 
     default:
     {
       for( size_t c = 0; c < this->oaChunkList.size(); c++ )
-        this->oaChunkList[c].WriteHTML( oOutStrm_i, oWriteInfo_i );
+        this->oaChunkList[c].WriteHTML( *this, oOutBuf_i, oWriteInfo_i );
       break;
     }
   }
@@ -1692,14 +2153,11 @@ void escrido::CTagBlock::WriteHTML( std::ostream& oOutStrm_i, const SWriteInfo&
 ///             characters) of the tag block as HTML into the stream.
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteHTMLFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteHTMLFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until the first word was written.
   for( size_t c = 0; c < oaChunkList.size(); c++ )
-    if( oaChunkList[c].WriteHTMLFirstWord( oOutStrm_i, oWriteInfo_i ) )
+    if( oaChunkList[c].WriteHTMLFirstWord( *this, oOutBuf_i, oWriteInfo_i ) )
       return;
 }
 
@@ -1713,11 +2171,8 @@ void escrido::CTagBlock::WriteHTMLFirstWord( std::ostream& oOutStrm_i, const SWr
 ///             delimitor (e.g. section).
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteHTMLTitleLine( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteHTMLTitleLine( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Write all chunks up to the title line delimitor.
   for( size_t c = 0; c < oaChunkList.size(); c++ )
   {
@@ -1730,7 +2185,7 @@ void escrido::CTagBlock::WriteHTMLTitleLine( std::ostream& oOutStrm_i, const SWr
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    oaChunkList[c].WriteHTML( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteHTML( *this, oOutBuf_i, oWriteInfo_i );
   }
 }
 
@@ -1745,11 +2200,8 @@ void escrido::CTagBlock::WriteHTMLTitleLine( std::ostream& oOutStrm_i, const SWr
 ///             delimitor (e.g. section).
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteHTMLTitleLineButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteHTMLTitleLineButFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until the something after the first word was written.
   size_t c = 0;
   for( c = 0; c < oaChunkList.size(); c++ )
@@ -1763,7 +2215,7 @@ void escrido::CTagBlock::WriteHTMLTitleLineButFirstWord( std::ostream& oOutStrm_
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    if( oaChunkList[c].WriteHTMLAllButFirstWord( oOutStrm_i, oWriteInfo_i ) )
+    if( oaChunkList[c].WriteHTMLAllButFirstWord( *this, oOutBuf_i, oWriteInfo_i ) )
       break;
   }
 
@@ -1779,7 +2231,7 @@ void escrido::CTagBlock::WriteHTMLTitleLineButFirstWord( std::ostream& oOutStrm_
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    oaChunkList[c].WriteHTML( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteHTML( *this, oOutBuf_i, oWriteInfo_i );
   }
 }
 
@@ -1794,11 +2246,8 @@ void escrido::CTagBlock::WriteHTMLTitleLineButFirstWord( std::ostream& oOutStrm_
 ///             delimitor (e.g. section).
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteHTMLTitleLineButFirstWordOrQuote( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteHTMLTitleLineButFirstWordOrQuote( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until the something after the first word was written.
   size_t c = 0;
   for( c = 0; c < oaChunkList.size(); c++ )
@@ -1812,7 +2261,7 @@ void escrido::CTagBlock::WriteHTMLTitleLineButFirstWordOrQuote( std::ostream& oO
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    if( oaChunkList[c].WriteHTMLAllButFirstWordOrQuote( oOutStrm_i, oWriteInfo_i ) )
+    if( oaChunkList[c].WriteHTMLAllButFirstWordOrQuote( *this, oOutBuf_i, oWriteInfo_i ) )
       break;
   }
 
@@ -1828,7 +2277,7 @@ void escrido::CTagBlock::WriteHTMLTitleLineButFirstWordOrQuote( std::ostream& oO
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    oaChunkList[c].WriteHTML( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteHTML( *this, oOutBuf_i, oWriteInfo_i );
   }
 }
 
@@ -1839,24 +2288,21 @@ void escrido::CTagBlock::WriteHTMLTitleLineButFirstWordOrQuote( std::ostream& oO
 ///             as HTML into the stream.
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteHTMLAllButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteHTMLAllButFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until something but the first word was written.
   size_t c = 0;
   for( c = 0; c < oaChunkList.size(); c++ )
-    if( oaChunkList[c].WriteHTMLAllButFirstWord( oOutStrm_i, oWriteInfo_i ) )
+    if( oaChunkList[c].WriteHTMLAllButFirstWord( *this, oOutBuf_i, oWriteInfo_i ) )
       // Break if the first time a chunk has a first word and did NOT write it.
       break;
     else
       // Write all chunks containing no first word but control commands instead.
-      oaChunkList[c].WriteHTML( oOutStrm_i, oWriteInfo_i );
+      oaChunkList[c].WriteHTML( *this, oOutBuf_i, oWriteInfo_i );
 
   // Write full remaining chunks;
   for( c++; c < oaChunkList.size(); c++ )
-    oaChunkList[c].WriteHTML( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteHTML( *this, oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
@@ -1870,11 +2316,8 @@ void escrido::CTagBlock::WriteHTMLAllButFirstWord( std::ostream& oOutStrm_i, con
 ///             delimitor (e.g. section).
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteHTMLAllButTitleLine( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteHTMLAllButTitleLine( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until the title line delimitor is found.
   size_t c = 0;
   for( c = 0; c < oaChunkList.size(); c++ )
@@ -1883,76 +2326,74 @@ void escrido::CTagBlock::WriteHTMLAllButTitleLine( std::ostream& oOutStrm_i, con
 
   // Write full remaining chunks;
   for( c++; c < oaChunkList.size(); c++ )
-    oaChunkList[c].WriteHTML( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteHTML( *this, oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
 
-void escrido::CTagBlock::WriteLaTeX( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteLaTeX( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   switch( this->fType )
   {
     case tag_type::ATTRIBUTE:
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\taglistitem{";
-      WriteLaTeXFirstWord( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "}";
-      WriteLaTeXAllButFirstWord( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "%" << std::endl;
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\taglistitem{";
+      WriteLaTeXFirstWord( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "}";
+      WriteLaTeXAllButFirstWord( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "%" << '\n';
       break;
     }
 
     case tag_type::FEATURE:
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\taglistitem{";
-      WriteLaTeXTitleLineButFirstWordOrQuote( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "}";
-      WriteLaTeXAllButTitleLine( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "%" << std::endl;
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\taglistitem{";
+      WriteLaTeXTitleLineButFirstWordOrQuote( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "}";
+      WriteLaTeXAllButTitleLine( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "%" << '\n';
       break;
     }
 
     case tag_type::PARAM:
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\taglistitem{";
-      WriteLaTeXFirstWord( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "}";
-      WriteLaTeXAllButFirstWord( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "%" << std::endl;
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\taglistitem{";
+      WriteLaTeXFirstWord( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "}";
+      WriteLaTeXAllButFirstWord( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "%" << '\n';
       break;
     }
 
     case tag_type::SEE:
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\item ";
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\item ";
       size_t nRefIdx;
-      if( oWriteInfo_i.oRefTable.GetRefIdx( MakeIdentifier( this->GetPlainFirstWord() ), nRefIdx ) )
+      const std::string sRefIdent = MakeIdentifier( this->GetPlainFirstWordView() );
+      if( oWriteInfo_i.oRefTable.GetRefIdx( sRefIdent, nRefIdx ) )
       {
-        oOutStrm_i << "\\robusthyperref{" << MakeIdentifier( this->GetPlainFirstWord() ) << "}{";
-        oOutStrm_i << ConvertHTML2LaTeX( oWriteInfo_i.oRefTable.GetText( nRefIdx ) );
-        oOutStrm_i << "}%";
+        oOutBuf_i << "\\robusthyperref{" << sRefIdent << "}{";
+        ConvertHTML2LaTeX( oWriteInfo_i.oRefTable.GetText( nRefIdx ), oOutBuf_i, oWriteInfo_i );
+        oOutBuf_i << "}%";
       }
       else
-        WriteLaTeXFirstWord( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << std::endl;
+        WriteLaTeXFirstWord( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << '\n';
       break;
     }
 
     case tag_type::SIGNATURE:
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\signaturelistitem{";
-      WriteLaTeXTitleLine( oOutStrm_i, oWriteInfo_i );
-      oOutStrm_i << "}%" << std::endl;
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\signaturelistitem{";
+      WriteLaTeXTitleLine( oOutBuf_i, oWriteInfo_i );
+      oOutBuf_i << "}%" << '\n';
       break;
     }
 
     default:
     {
       for( size_t c = 0; c < this->oaChunkList.size(); c++ )
-        this->oaChunkList[c].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+        this->oaChunkList[c].WriteLaTeX( *this, oOutBuf_i, oWriteInfo_i );
       break;
     }
   }
@@ -1965,14 +2406,11 @@ void escrido::CTagBlock::WriteLaTeX( std::ostream& oOutStrm_i, const SWriteInfo&
 ///             characters) of the tag block as LaTeX into the stream.
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteLaTeXFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteLaTeXFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until the first word was written.
   for( size_t c = 0; c < oaChunkList.size(); c++ )
-    if( oaChunkList[c].WriteLaTeXFirstWord( oOutStrm_i, oWriteInfo_i ) )
+    if( oaChunkList[c].WriteLaTeXFirstWord( *this, oOutBuf_i, oWriteInfo_i ) )
       return;
 }
 
@@ -1986,11 +2424,8 @@ void escrido::CTagBlock::WriteLaTeXFirstWord( std::ostream& oOutStrm_i, const SW
 ///             delimitor (e.g. section).
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteLaTeXTitleLine( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteLaTeXTitleLine( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Write all chunks up to the title line delimitor.
   for( size_t c = 0; c < oaChunkList.size(); ++c )
   {
@@ -2003,7 +2438,7 @@ void escrido::CTagBlock::WriteLaTeXTitleLine( std::ostream& oOutStrm_i, const SW
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    oaChunkList[c].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteLaTeX( *this, oOutBuf_i, oWriteInfo_i );
   }
 }
 
@@ -2018,11 +2453,8 @@ void escrido::CTagBlock::WriteLaTeXTitleLine( std::ostream& oOutStrm_i, const SW
 ///             delimitor (e.g. section).
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until the something after the first word was written.
   size_t c = 0;
   for( c = 0; c < oaChunkList.size(); c++ )
@@ -2036,7 +2468,7 @@ void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWord( std::ostream& oOutStrm
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    if( oaChunkList[c].WriteLaTeXAllButFirstWord( oOutStrm_i, oWriteInfo_i ) )
+    if( oaChunkList[c].WriteLaTeXAllButFirstWord( *this, oOutBuf_i, oWriteInfo_i ) )
       break;
   }
 
@@ -2052,7 +2484,7 @@ void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWord( std::ostream& oOutStrm
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    oaChunkList[c].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteLaTeX( *this, oOutBuf_i, oWriteInfo_i );
   }
 }
 
@@ -2067,11 +2499,8 @@ void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWord( std::ostream& oOutStrm
 ///             delimitor (e.g. section).
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWordOrQuote( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWordOrQuote( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until the something after the first word was written.
   size_t c = 0;
   for( c = 0; c < oaChunkList.size(); c++ )
@@ -2085,7 +2514,7 @@ void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWordOrQuote( std::ostream& o
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    if( oaChunkList[c].WriteLaTeXAllButFirstWordOrQuote( oOutStrm_i, oWriteInfo_i ) )
+    if( oaChunkList[c].WriteLaTeXAllButFirstWordOrQuote( *this, oOutBuf_i, oWriteInfo_i ) )
       break;
   }
 
@@ -2101,7 +2530,7 @@ void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWordOrQuote( std::ostream& o
         oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
       continue;
 
-    oaChunkList[c].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteLaTeX( *this, oOutBuf_i, oWriteInfo_i );
   }
 }
 
@@ -2112,15 +2541,12 @@ void escrido::CTagBlock::WriteLaTeXTitleLineButFirstWordOrQuote( std::ostream& o
 ///             as LaTeX into the stream.
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteLaTeXAllButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteLaTeXAllButFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until the something but the first word was written.
   size_t c = 0;
   for( c = 0; c < oaChunkList.size(); c++ )
-    if( oaChunkList[c].WriteLaTeXAllButFirstWord( oOutStrm_i, oWriteInfo_i ) )
+    if( oaChunkList[c].WriteLaTeXAllButFirstWord( *this, oOutBuf_i, oWriteInfo_i ) )
       break;
 
   // Write full remaining chunks;
@@ -2132,7 +2558,7 @@ void escrido::CTagBlock::WriteLaTeXAllButFirstWord( std::ostream& oOutStrm_i, co
       if( oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
         break;
 
-    oaChunkList[c].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteLaTeX( *this, oOutBuf_i, oWriteInfo_i );
   }
 }
 
@@ -2147,11 +2573,8 @@ void escrido::CTagBlock::WriteLaTeXAllButFirstWord( std::ostream& oOutStrm_i, co
 ///             delimitor (e.g. section).
 // *****************************************************************************
 
-void escrido::CTagBlock::WriteLaTeXAllButTitleLine( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CTagBlock::WriteLaTeXAllButTitleLine( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  // Set pointer to this tag block.
-  oWriteInfo_i.pTagBlock = this;
-
   // Loop through all text chunks until the title line delimitor is found.
   size_t c = 0;
   for( c = 0; c < oaChunkList.size(); c++ )
@@ -2167,12 +2590,76 @@ void escrido::CTagBlock::WriteLaTeXAllButTitleLine( std::ostream& oOutStrm_i, co
       if( oaChunkList[c].GetType() == cont_chunk_type::END_PARAGRAPH )
         break;
 
-    oaChunkList[c].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+    oaChunkList[c].WriteLaTeX( *this, oOutBuf_i, oWriteInfo_i );
   }
 }
 
 // .............................................................................
 
+// *****************************************************************************
+/// \brief      Appends the binary representation of the tag block (including
+///             its parsing states) to a buffer.
+// *****************************************************************************
+
+void escrido::CTagBlock::Serialize( std::string& sBuffer_io ) const
+{
+  binstream::Write( sBuffer_io, fType );
+  binstream::WriteString( sBuffer_io, sText );
+  binstream::Write( sBuffer_io, static_cast<uint32_t>( oaRefList.size() ) );
+  binstream::Write( sBuffer_io, static_cast<uint32_t>( oaChunkList.size() ) );
+  for( size_t c = 0; c < oaChunkList.size(); c++ )
+    oaChunkList[c].Serialize( sBuffer_io );
+  binstream::Write( sBuffer_io, static_cast<uint32_t>( faWriteMode.size() ) );
+  for( size_t m = 0; m < faWriteMode.size(); m++ )
+    binstream::Write( sBuffer_io, faWriteMode[m] );
+  binstream::Write( sBuffer_io, fAppIdentTextMode );
+  binstream::Write( sBuffer_io, fVerbatimStartMode );
+  binstream::Write( sBuffer_io, fNewLine );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Restores the tag block from its binary representation.
+///
+/// \return     'true' on success, 'false' if the buffer is corrupted.
+// *****************************************************************************
+
+bool escrido::CTagBlock::Deserialize( const char*& pPos_io, const char* pEnd_i )
+{
+  uint32_t nRefN;
+  uint32_t nChunkN;
+  if( !binstream::Read( pPos_io, pEnd_i, fType ) ||
+      !binstream::ReadString( pPos_io, pEnd_i, sText ) ||
+      !binstream::Read( pPos_io, pEnd_i, nRefN ) ||
+      !binstream::Read( pPos_io, pEnd_i, nChunkN ) ||
+      nRefN > nChunkN ||
+      nChunkN > static_cast<size_t>( pEnd_i - pPos_io ) )
+    return false;
+
+  // (The references are resolved anew.)
+  oaRefList.assign( nRefN, CContentChunk::SResolvedRef() );
+  oaChunkList.resize( nChunkN );
+  for( size_t c = 0; c < oaChunkList.size(); c++ )
+    if( !oaChunkList[c].Deserialize( pPos_io, pEnd_i, *this ) )
+      return false;
+
+  uint32_t nWriteModeN;
+  if( !binstream::Read( pPos_io, pEnd_i, nWriteModeN ) ||
+      nWriteModeN > static_cast<size_t>( pEnd_i - pPos_io ) )
+    return false;
+  faWriteMode.resize( nWriteModeN );
+  for( size_t m = 0; m < faWriteMode.size(); m++ )
+    if( !binstream::Read( pPos_io, pEnd_i, faWriteMode[m] ) )
+      return false;
+
+  return binstream::Read( pPos_io, pEnd_i, fAppIdentTextMode ) &&
+         binstream::Read( pPos_io, pEnd_i, fVerbatimStartMode ) &&
+         binstream::Read( pPos_io, pEnd_i, fNewLine );
+}
+
+// .............................................................................
+
 void escrido::CTagBlock::DebugOutput() const
 {
   std::cout << "block " << (unsigned long long) this << " tag type: ";
@@ -2186,7 +2673,7 @@ void escrido::CTagBlock::DebugOutput() const
   std::cout << "| ";
   for( size_t c = 0; c < oaChunkList.size(); c++ )
   {
-    oaChunkList[c].DebugOutput();
+    oaChunkList[c].DebugOutput( *this );
     std::cout << " | ";
   }
   std::cout << std::endl;
@@ -2261,7 +2748,7 @@ void escrido::CTagBlock::AppendCharDefault( const char cChar_i )
       oaChunkList.emplace_back( fTextChunkType );
 
   // Append character to the text chunk.
-  oaChunkList.back().AppendChar( cChar_i );
+  oaChunkList.back().AppendChar( sText, cChar_i );
 }
 
 // .............................................................................
@@ -2604,23 +3091,63 @@ void escrido::CContentUnit::AppendChar( const char cChar_i )
     }
   }
 
-  // => Handle as additional character to the unit.
-  oaBlockList.back().AppendChar( cChar_i );
-  SetParseState( parse_state::DEFAULT );
+  // => Handle as additional character to the unit.
+  oaBlockList.back().AppendChar( cChar_i );
+  SetParseState( parse_state::DEFAULT );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Appends a tag given by its name (which may be unknown).
+// *****************************************************************************
+
+void escrido::CContentUnit::AppendTag( const char* szTagName_i )
+{
+  unsigned int nTagIdx;
+  if( !GetTagIdx( szTagName_i, strlen( szTagName_i ), nTagIdx ) )
+    nTagIdx = nNoTagIdx;
+
+  this->AppendTag( szTagName_i, nTagIdx );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Appends a tag given by its tag index (see GetTagIdx()).
+// *****************************************************************************
+
+void escrido::CContentUnit::AppendTag( unsigned int nTagIdx_i )
+{
+  this->AppendTag( GetTagName( nTagIdx_i ), nTagIdx_i );
 }
 
 // .............................................................................
 
-void escrido::CContentUnit::AppendTag( const char* szTagName_i )
+// *****************************************************************************
+/// \brief      Appends a tag.
+///
+/// \param[in]  szTagName_i
+///             The tag name.
+/// \param[in]  nTagIdx_i
+///             The tag index of the name or nNoTagIdx for unknown tags.
+// *****************************************************************************
+
+void escrido::CContentUnit::AppendTag( const char* szTagName_i, unsigned int nTagIdx_i )
 {
+  const bool fBlockTag = ( nTagIdx_i < nBlockTagTypeN );
+  const bool fInlineTag = ( nTagIdx_i >= nBlockTagTypeN && nTagIdx_i < nTagTypeN );
+  const tag_type fTagType = ( fBlockTag ? oaBlockTagTypeList[nTagIdx_i].fType :
+                              fInlineTag ? oaInlineTagTypeList[nTagIdx_i - nBlockTagTypeN].fType :
+                              tag_type::PARAGRAPH );
+
   // Check whether in a verbatim tag block types like EXAMPLE:
   if( oaBlockList.back().GetTagType() == tag_type::EXAMPLE ||
       oaBlockList.back().GetTagType() == tag_type::OUTPUT )
   {
     // => Verbatim block.
 
-    tag_type fTagType;
-    if( GetBlockTagType( szTagName_i, fTagType ) )
+    if( fBlockTag )
     {
       // => The tag is a block tag.
 
@@ -2648,8 +3175,7 @@ void escrido::CContentUnit::AppendTag( const char* szTagName_i )
     if( oaBlockList.back().GetWriteMode() == tag_block_write_mode::VERBATIM )
     {
       // Only relevant tag in verbatim mode is the @endverbatim inline tag.
-      tag_type fTagType;
-      if( GetInlineTagType( szTagName_i, fTagType ) )
+      if( fInlineTag )
         if( fTagType == tag_type::END_VERBATIM )
         {
           oaBlockList.back().AppendInlineTag( fTagType );
@@ -2695,8 +3221,7 @@ void escrido::CContentUnit::AppendTag( const char* szTagName_i )
       }
     }
 
-    tag_type fTagType;
-    if( GetBlockTagType( szTagName_i, fTagType ) )
+    if( fBlockTag )
     {
       // => The tag is a block tag.
 
@@ -2724,7 +3249,7 @@ void escrido::CContentUnit::AppendTag( const char* szTagName_i )
       }
     }
     else
-      if( GetInlineTagType( szTagName_i, fTagType ) )
+      if( fInlineTag )
       {
         // => The tag is an inline tag.
 
@@ -2844,6 +3369,16 @@ const escrido::CTagBlock* escrido::CContentUnit::GetNextTagBlock( const CTagBloc
 
 // .............................................................................
 
+/// Resolves the REF and LINK chunks of all tag blocks (see
+/// CTagBlock::ResolveRefs()).
+void escrido::CContentUnit::ResolveRefs( const CRefTable& oRefTable_i, std::vector<std::string>& asUnresolved_o ) const
+{
+  for( size_t b = 0; b < oaBlockList.size(); b++ )
+    oaBlockList[b].ResolveRefs( oRefTable_i, asUnresolved_o );
+}
+
+// .............................................................................
+
 // *****************************************************************************
 /// \brief      Writes the "flowing text" tag blocks PARAGRAPH, SECTION,
 ///             SUBSECTION, SUBSUBSECTION, DETAILS and embedded EXAMPLE, IMAGE,
@@ -2852,7 +3387,7 @@ const escrido::CTagBlock* escrido::CContentUnit::GetNextTagBlock( const CTagBloc
 /// \todo       TODO: Implement correct nesting of sections and subsections.
 // *****************************************************************************
 
-void escrido::CContentUnit::WriteHTMLParSectDet( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CContentUnit::WriteHTMLParSectDet( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   // Text section type blocks: default, section or details blocks in their order
   // of their appearance.
@@ -2866,19 +3401,19 @@ void escrido::CContentUnit::WriteHTMLParSectDet( std::ostream& oOutStrm_i, const
       switch( oaBlockList[t].GetTagType() )
       {
         case tag_type::PARAGRAPH:
-          oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
+          oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
           break;
 
         case tag_type::DETAILS:
           if( !fInDetails )
           {
-            WriteHTMLTagLine( "<section class=\"tagblock details\">", oOutStrm_i, oWriteInfo_i++ );
-            WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h2>"
-                                                         << oWriteInfo_i.Label( "Details" )
-                                                         << "</h2>" << std::endl;
+            WriteHTMLTagLine( "<section class=\"tagblock details\">", oOutBuf_i, oWriteInfo_i++ );
+            WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h2>"
+                                                        << oWriteInfo_i.Label( label_type::DETAILS )
+                                                         << "</h2>" << '\n';
             fInDetails = true;
           }
-          oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
+          oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
           break;
 
         case tag_type::SECTION:
@@ -2886,83 +3421,83 @@ void escrido::CContentUnit::WriteHTMLParSectDet( std::ostream& oOutStrm_i, const
           // Eventually leave "details" section.
           if( fInDetails )
           {
-            WriteHTMLTagLine( "</section>", oOutStrm_i, --oWriteInfo_i );
+            WriteHTMLTagLine( "</section>", oOutBuf_i, --oWriteInfo_i );
             fInDetails = false;
           }
 
           // Surrounding "<section>".
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<section id=\""
-                                                         << oaBlockList[t].GetPlainFirstWord()
-                                                         << "\" class=\"tagblock section\">" << std::endl;
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<section id=\""
+                                                        << oaBlockList[t].GetPlainFirstWordView()
+                                                         << "\" class=\"tagblock section\">" << '\n';
 
           // Title line.
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h2>";
-          oaBlockList[t].WriteHTMLTitleLineButFirstWord( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "</h2>" << std::endl;
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h2>";
+          oaBlockList[t].WriteHTMLTitleLineButFirstWord( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "</h2>" << '\n';
 
           // Content and terminating "</section>".
-          oaBlockList[t].WriteHTMLAllButTitleLine( oOutStrm_i, oWriteInfo_i );
-          WriteHTMLTagLine( "</section>", oOutStrm_i, --oWriteInfo_i );
+          oaBlockList[t].WriteHTMLAllButTitleLine( oOutBuf_i, oWriteInfo_i );
+          WriteHTMLTagLine( "</section>", oOutBuf_i, --oWriteInfo_i );
           break;
         }
 
         case tag_type::SUBSECTION:
         {
           // Surrounding "<section>".
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<section id=\""
-                                                         << oaBlockList[t].GetPlainFirstWord()
-                                                         << "\" class=\"tagblock subsection\">" << std::endl;
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<section id=\""
+                                                        << oaBlockList[t].GetPlainFirstWordView()
+                                                         << "\" class=\"tagblock subsection\">" << '\n';
 
           // Title line.
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h3>";
-          oaBlockList[t].WriteHTMLTitleLineButFirstWord( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "</h3>" << std::endl;
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h3>";
+          oaBlockList[t].WriteHTMLTitleLineButFirstWord( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "</h3>" << '\n';
 
           // Content and terminating "</section>".
-          oaBlockList[t].WriteHTMLAllButTitleLine( oOutStrm_i, oWriteInfo_i );
-          WriteHTMLTagLine( "</section>", oOutStrm_i, --oWriteInfo_i );
+          oaBlockList[t].WriteHTMLAllButTitleLine( oOutBuf_i, oWriteInfo_i );
+          WriteHTMLTagLine( "</section>", oOutBuf_i, --oWriteInfo_i );
           break;
         }
 
         case tag_type::SUBSUBSECTION:
         {
           // Surrounding "<section>".
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<section id=\""
-                                                         << oaBlockList[t].GetPlainFirstWord()
-                                                         << "\" class=\"tagblock subsubsection\">" << std::endl;
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<section id=\""
+                                                        << oaBlockList[t].GetPlainFirstWordView()
+                                                         << "\" class=\"tagblock subsubsection\">" << '\n';
 
           // Title line.
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h4>";
-          oaBlockList[t].WriteHTMLTitleLineButFirstWord( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "</h4>" << std::endl;
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h4>";
+          oaBlockList[t].WriteHTMLTitleLineButFirstWord( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "</h4>" << '\n';
 
           // Content and terminating "</section>".
-          oaBlockList[t].WriteHTMLAllButTitleLine( oOutStrm_i, oWriteInfo_i );
-          WriteHTMLTagLine( "</section>", oOutStrm_i, --oWriteInfo_i );
+          oaBlockList[t].WriteHTMLAllButTitleLine( oOutBuf_i, oWriteInfo_i );
+          WriteHTMLTagLine( "</section>", oOutBuf_i, --oWriteInfo_i );
           break;
         }
 
         case tag_type::EXAMPLE:
         {
-          const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( "Example" ) + "</h4>";
-
-          WriteHTMLTagLine( "<div class=\"tagblock examples\">", oOutStrm_i, oWriteInfo_i++ );
-          WriteHTMLTagLine( sTagLine, oOutStrm_i, oWriteInfo_i );
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<pre class=\"example\">";
-          oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "</pre>" << std::endl;
-          WriteHTMLTagLine( "</div>", oOutStrm_i, --oWriteInfo_i );
+          const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( label_type::EXAMPLE ) + "</h4>";
+
+          WriteHTMLTagLine( "<div class=\"tagblock examples\">", oOutBuf_i, oWriteInfo_i++ );
+          WriteHTMLTagLine( sTagLine, oOutBuf_i, oWriteInfo_i );
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<pre class=\"example\">";
+          oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "</pre>" << '\n';
+          WriteHTMLTagLine( "</div>", oOutBuf_i, --oWriteInfo_i );
           break;
         }
 
         case tag_type::IMAGE:
         {
-          WriteHTMLTagLine( "<figure class=\"image\">", oOutStrm_i, oWriteInfo_i++ );
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<img src=\"" << oaBlockList[t].GetPlainFirstWord() << "\">" << std::endl;
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<figcaption>";
-          oaBlockList[t].WriteHTMLAllButFirstWord( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "</figcaption>" << std::endl;
-          WriteHTMLTagLine( "</figure>", oOutStrm_i, --oWriteInfo_i );
+          WriteHTMLTagLine( "<figure class=\"image\">", oOutBuf_i, oWriteInfo_i++ );
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<img src=\"" << oaBlockList[t].GetPlainFirstWordView() << "\">" << '\n';
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<figcaption>";
+          oaBlockList[t].WriteHTMLAllButFirstWord( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "</figcaption>" << '\n';
+          WriteHTMLTagLine( "</figure>", oOutBuf_i, --oWriteInfo_i );
           break;
         }
 
@@ -2970,48 +3505,48 @@ void escrido::CContentUnit::WriteHTMLParSectDet( std::ostream& oOutStrm_i, const
         {
           if( oWriteInfo_i.fInternalTags )
           {
-            const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( "Internal" ) + "</h4>";
+            const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( label_type::INTERNAL ) + "</h4>";
 
-            WriteHTMLTagLine( "<div class=\"internal\">", oOutStrm_i, oWriteInfo_i++ );
-            WriteHTMLTagLine( sTagLine, oOutStrm_i, oWriteInfo_i );
-            oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
-            WriteHTMLTagLine( "</div>", oOutStrm_i, --oWriteInfo_i );
+            WriteHTMLTagLine( "<div class=\"internal\">", oOutBuf_i, oWriteInfo_i++ );
+            WriteHTMLTagLine( sTagLine, oOutBuf_i, oWriteInfo_i );
+            oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
+            WriteHTMLTagLine( "</div>", oOutBuf_i, --oWriteInfo_i );
           }
           break;
         }
 
         case tag_type::NOTE:
         {
-          const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( "Note" ) + "</h4>";
+          const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( label_type::NOTE ) + "</h4>";
 
-          WriteHTMLTagLine( "<div class=\"note\">", oOutStrm_i, oWriteInfo_i++ );
-          WriteHTMLTagLine( sTagLine, oOutStrm_i, oWriteInfo_i );
-          oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
-          WriteHTMLTagLine( "</div>", oOutStrm_i, --oWriteInfo_i );
+          WriteHTMLTagLine( "<div class=\"note\">", oOutBuf_i, oWriteInfo_i++ );
+          WriteHTMLTagLine( sTagLine, oOutBuf_i, oWriteInfo_i );
+          oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
+          WriteHTMLTagLine( "</div>", oOutBuf_i, --oWriteInfo_i );
           break;
         }
 
         case tag_type::OUTPUT:
         {
-          const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( "Output" ) + "</h4>";
-
-          WriteHTMLTagLine( "<div class=\"output\">", oOutStrm_i, oWriteInfo_i++ );
-          WriteHTMLTagLine( sTagLine, oOutStrm_i, oWriteInfo_i );
-          WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<pre class=\"output\">";
-          oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "</pre>" << std::endl;
-          WriteHTMLTagLine( "</div>", oOutStrm_i, --oWriteInfo_i );
+          const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( label_type::OUTPUT ) + "</h4>";
+
+          WriteHTMLTagLine( "<div class=\"output\">", oOutBuf_i, oWriteInfo_i++ );
+          WriteHTMLTagLine( sTagLine, oOutBuf_i, oWriteInfo_i );
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<pre class=\"output\">";
+          oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "</pre>" << '\n';
+          WriteHTMLTagLine( "</div>", oOutBuf_i, --oWriteInfo_i );
           break;
         }
 
         case tag_type::REMARK:
         {
-          const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( "Remark" ) + "</h4>";
+          const std::string sTagLine = std::string( "<h4>" ) + oWriteInfo_i.Label( label_type::REMARK ) + "</h4>";
 
-          WriteHTMLTagLine( "<div class=\"remark\">", oOutStrm_i, oWriteInfo_i++ );
-          WriteHTMLTagLine( sTagLine, oOutStrm_i, oWriteInfo_i );
-          oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
-          WriteHTMLTagLine( "</div>", oOutStrm_i, --oWriteInfo_i );
+          WriteHTMLTagLine( "<div class=\"remark\">", oOutBuf_i, oWriteInfo_i++ );
+          WriteHTMLTagLine( sTagLine, oOutBuf_i, oWriteInfo_i );
+          oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
+          WriteHTMLTagLine( "</div>", oOutBuf_i, --oWriteInfo_i );
           break;
         }
       }
@@ -3020,7 +3555,7 @@ void escrido::CContentUnit::WriteHTMLParSectDet( std::ostream& oOutStrm_i, const
     // Eventually leave last "details" section.
     if( fInDetails )
     {
-      WriteHTMLTagLine( "</section>", oOutStrm_i, --oWriteInfo_i );
+      WriteHTMLTagLine( "</section>", oOutBuf_i, --oWriteInfo_i );
       fInDetails = false;
     }
   }
@@ -3038,14 +3573,14 @@ void escrido::CContentUnit::WriteHTMLParSectDet( std::ostream& oOutStrm_i, const
 ///
 /// \param[in]  fTagType_i
 ///             Type of tag blocks that is written.
-/// \param[in]  oOutStrm_i
+/// \param[in]  oOutBuf_i
 ///             Output stream into which the tag block is written.
 /// \param[in]  oWriteInfo_i
 ///             Write-info structure with additional information.
 // *****************************************************************************
 
 void escrido::CContentUnit::WriteHTMLTagBlock( tag_type fTagType_i,
-                                               std::ostream& oOutStrm_i,
+                                               outbuf::COutBuffer& oOutBuf_i,
                                                const SWriteInfo& oWriteInfo_i ) const
 {
   if( this->HasTagBlock( fTagType_i ) )
@@ -3054,16 +3589,16 @@ void escrido::CContentUnit::WriteHTMLTagBlock( tag_type fTagType_i,
     switch( fTagType_i )
     {
       case tag_type::BRIEF:
-        this->GetFirstTagBlock( tag_type::BRIEF )->WriteHTML( oOutStrm_i, oWriteInfo_i );
+        this->GetFirstTagBlock( tag_type::BRIEF )->WriteHTML( oOutBuf_i, oWriteInfo_i );
         break;
 
       case tag_type::RETURN:
-        WriteHTMLTagLine( "<section class=\"tagblock return\">", oOutStrm_i, oWriteInfo_i++ );
-        WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h2>"
-                                                     << oWriteInfo_i.Label( "Return value" )
-                                                     << "</h2>" << std::endl;
-        this->GetFirstTagBlock( tag_type::RETURN )->WriteHTML( oOutStrm_i, oWriteInfo_i );
-        WriteHTMLTagLine( "</section>", oOutStrm_i, --oWriteInfo_i );
+        WriteHTMLTagLine( "<section class=\"tagblock return\">", oOutBuf_i, oWriteInfo_i++ );
+        WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h2>"
+                                                    << oWriteInfo_i.Label( label_type::RETURN_VALUE )
+                                                     << "</h2>" << '\n';
+        this->GetFirstTagBlock( tag_type::RETURN )->WriteHTML( oOutBuf_i, oWriteInfo_i );
+        WriteHTMLTagLine( "</section>", oOutBuf_i, --oWriteInfo_i );
         break;
     }
   }
@@ -3082,7 +3617,7 @@ void escrido::CContentUnit::WriteHTMLTagBlock( tag_type fTagType_i,
 ///             Type of tag blocks that is written.
 /// \param[in]  sIdentifier_i
 ///             Identifier of the tag block that is written.
-/// \param[in]  oOutStrm_i
+/// \param[in]  oOutBuf_i
 ///             Output stream into which the tag block is written.
 /// \param[in]  oWriteInfo_i
 ///             Write-info structure with additional information.
@@ -3090,7 +3625,7 @@ void escrido::CContentUnit::WriteHTMLTagBlock( tag_type fTagType_i,
 
 void escrido::CContentUnit::WriteHTMLTagBlock( tag_type fTagType_i,
                                                const std::string& sIdentifier_i,
-                                               std::ostream& oOutStrm_i,
+                                               outbuf::COutBuffer& oOutBuf_i,
                                                const SWriteInfo& oWriteInfo_i ) const
 {
   // Write tag block.
@@ -3103,7 +3638,7 @@ void escrido::CContentUnit::WriteHTMLTagBlock( tag_type fTagType_i,
       bool fIdentFeatExists = false;
       for( size_t t = 0; t < oaBlockList.size(); t++ )
         if( oaBlockList[t].GetTagType() == fTagType_i &&
-            oaBlockList[t].GetPlainFirstWordOrQuote() == sIdentifier_i )
+            oaBlockList[t].GetPlainFirstWordOrQuoteView() == sIdentifier_i )
         {
           fIdentFeatExists = true;
           break;
@@ -3112,7 +3647,7 @@ void escrido::CContentUnit::WriteHTMLTagBlock( tag_type fTagType_i,
       if( fIdentFeatExists )
       {
         // Write HTML elements.
-        this->WriteHTMLFeatureType( sIdentifier_i, oOutStrm_i, oWriteInfo_i );
+        this->WriteHTMLFeatureType( sIdentifier_i, oOutBuf_i, oWriteInfo_i );
       }
 
       break;
@@ -3134,14 +3669,14 @@ void escrido::CContentUnit::WriteHTMLTagBlock( tag_type fTagType_i,
 ///
 /// \param[in]  fTagType_i
 ///             Type of which all tag blocks are written.
-/// \param[in]  oOutStrm_i
+/// \param[in]  oOutBuf_i
 ///             Output stream into which the tag blocks are written.
 /// \param[in]  oWriteInfo_i
 ///             Write-info structure with additional information.
 // *****************************************************************************
 
 void escrido::CContentUnit::WriteHTMLTagBlockList( tag_type fTagType_i,
-                                                   std::ostream& oOutStrm_i,
+                                                   outbuf::COutBuffer& oOutBuf_i,
                                                    const SWriteInfo& oWriteInfo_i ) const
 {
   if( this->HasTagBlock( fTagType_i ) )
@@ -3163,7 +3698,7 @@ void escrido::CContentUnit::WriteHTMLTagBlockList( tag_type fTagType_i,
       while( iFeatType != saFeatureTypeList.end() )
       {
         // Write HTML elements.
-        this->WriteHTMLFeatureType( *iFeatType, oOutStrm_i, oWriteInfo_i );
+        this->WriteHTMLFeatureType( *iFeatType, oOutBuf_i, oWriteInfo_i );
 
         // Cycle to next feature type.
         std::list <std::string>::iterator iFeat = iFeatType;
@@ -3180,31 +3715,31 @@ void escrido::CContentUnit::WriteHTMLTagBlockList( tag_type fTagType_i,
     switch( fTagType_i )
     {
        case tag_type::ATTRIBUTE:
-         WriteHTMLTagLine( "<section class=\"tagblock attributes\">", oOutStrm_i, oWriteInfo_i++ );
-         WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h2>"
-                                                      << oWriteInfo_i.Label( "Attributes" )
-                                                      << "</h2>" << std::endl;
+         WriteHTMLTagLine( "<section class=\"tagblock attributes\">", oOutBuf_i, oWriteInfo_i++ );
+         WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h2>"
+                                                     << oWriteInfo_i.Label( label_type::ATTRIBUTES )
+                                                      << "</h2>" << '\n';
          break;
 
        case tag_type::PARAM:
-         WriteHTMLTagLine( "<section class=\"tagblock parameters\">", oOutStrm_i, oWriteInfo_i++ );
-         WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h2>"
-                                                      << oWriteInfo_i.Label( "Parameters" )
-                                                      << "</h2>" << std::endl;
+         WriteHTMLTagLine( "<section class=\"tagblock parameters\">", oOutBuf_i, oWriteInfo_i++ );
+         WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h2>"
+                                                     << oWriteInfo_i.Label( label_type::PARAMETERS )
+                                                      << "</h2>" << '\n';
          break;
 
        case tag_type::SEE:
-         WriteHTMLTagLine( "<section class=\"tagblock see\">", oOutStrm_i, oWriteInfo_i++ );
-         WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h2>"
-                                                      << oWriteInfo_i.Label( "See also" )
-                                                      << "</h2>" << std::endl;
+         WriteHTMLTagLine( "<section class=\"tagblock see\">", oOutBuf_i, oWriteInfo_i++ );
+         WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h2>"
+                                                     << oWriteInfo_i.Label( label_type::SEE_ALSO )
+                                                      << "</h2>" << '\n';
          break;
 
        case tag_type::SIGNATURE:
-         WriteHTMLTagLine( "<section class=\"tagblock signatures\">", oOutStrm_i, oWriteInfo_i++ );
-         WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h2>"
-                                                      << oWriteInfo_i.Label( "Signatures" )
-                                                      << "</h2>" << std::endl;
+         WriteHTMLTagLine( "<section class=\"tagblock signatures\">", oOutBuf_i, oWriteInfo_i++ );
+         WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h2>"
+                                                     << oWriteInfo_i.Label( label_type::SIGNATURES )
+                                                      << "</h2>" << '\n';
          break;
     }
 
@@ -3214,33 +3749,33 @@ void escrido::CContentUnit::WriteHTMLTagBlockList( tag_type fTagType_i,
       case tag_type::SEE:
       case tag_type::SIGNATURE:
       {
-        WriteHTMLTagLine( "<ul>", oOutStrm_i, oWriteInfo_i++ );
+        WriteHTMLTagLine( "<ul>", oOutBuf_i, oWriteInfo_i++ );
 
         // Loop over all tag blocks.
         for( size_t t = 0; t < oaBlockList.size(); t++ )
           if( oaBlockList[t].GetTagType() == fTagType_i )
-            oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
-        WriteHTMLTagLine( "</ul>", oOutStrm_i, --oWriteInfo_i );
+            oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
+        WriteHTMLTagLine( "</ul>", oOutBuf_i, --oWriteInfo_i );
         break;
       }
 
       default:
       {
-        WriteHTMLTagLine( "<dl>", oOutStrm_i, oWriteInfo_i++ );
+        WriteHTMLTagLine( "<dl>", oOutBuf_i, oWriteInfo_i++ );
 
         // Loop over all tag blocks.
         for( size_t t = 0; t < oaBlockList.size(); t++ )
           if( oaBlockList[t].GetTagType() == fTagType_i )
-            oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
+            oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
 
-        WriteHTMLTagLine( "</dl>", oOutStrm_i, --oWriteInfo_i );
+        WriteHTMLTagLine( "</dl>", oOutBuf_i, --oWriteInfo_i );
 
         break;
       }
     }
 
     // Write tag block closing line.
-    WriteHTMLTagLine( "</section>", oOutStrm_i, --oWriteInfo_i );
+    WriteHTMLTagLine( "</section>", oOutBuf_i, --oWriteInfo_i );
   }
 }
 
@@ -3252,7 +3787,7 @@ void escrido::CContentUnit::WriteHTMLTagBlockList( tag_type fTagType_i,
 ///             standardized way.
 // *****************************************************************************
 
-void escrido::CContentUnit::WriteLaTeXParSectDet( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CContentUnit::WriteLaTeXParSectDet( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
   // Text section type blocks: default, section or details blocks in their order
   // of their appearance.
@@ -3266,19 +3801,19 @@ void escrido::CContentUnit::WriteLaTeXParSectDet( std::ostream& oOutStrm_i, cons
       switch( oaBlockList[t].GetTagType() )
       {
         case tag_type::PARAGRAPH:
-          oaBlockList[t].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+          oaBlockList[t].WriteLaTeX( oOutBuf_i, oWriteInfo_i );
           break;
 
         case tag_type::DETAILS:
         {
           if( !fInDetails )
           {
-            oOutStrm_i << "\\tagblocksection{" << oWriteInfo_i.Label( "Details" ) << "}%" << std::endl << std::endl;
+            oOutBuf_i << "\\tagblocksection{" << oWriteInfo_i.Label( label_type::DETAILS ) << "}%" << '\n' << '\n';
             fInDetails = true;
           }
 
-          oaBlockList[t].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << std::endl << std::endl;
+          oaBlockList[t].WriteLaTeX( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << '\n' << '\n';
 
           break;
         }
@@ -3289,14 +3824,14 @@ void escrido::CContentUnit::WriteLaTeXParSectDet( std::ostream& oOutStrm_i, cons
             fInDetails = false;
 
           // Title line.
-          oOutStrm_i << "\\tagblocksection{";
-          oaBlockList[t].WriteLaTeXTitleLineButFirstWord( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "}%" << std::endl
-                     << "\\label{" << oaBlockList[t].GetPlainFirstWord() << "}%" << std::endl << std::endl;
+          oOutBuf_i << "\\tagblocksection{";
+          oaBlockList[t].WriteLaTeXTitleLineButFirstWord( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "}%" << '\n'
+                     << "\\label{" << oaBlockList[t].GetPlainFirstWordView() << "}%" << '\n' << '\n';
 
           // Content.
-          oaBlockList[t].WriteLaTeXAllButTitleLine( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << std::endl << std::endl;
+          oaBlockList[t].WriteLaTeXAllButTitleLine( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << '\n' << '\n';
 
           break;
         }
@@ -3304,50 +3839,50 @@ void escrido::CContentUnit::WriteLaTeXParSectDet( std::ostream& oOutStrm_i, cons
         case tag_type::SUBSECTION:
         {
           // Title line.
-          oOutStrm_i << "\\tagblocksubsection{";
-          oaBlockList[t].WriteLaTeXTitleLineButFirstWord( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "}%" << std::endl
-                     << "\\label{" << oaBlockList[t].GetPlainFirstWord() << "}%" << std::endl << std::endl;
+          oOutBuf_i << "\\tagblocksubsection{";
+          oaBlockList[t].WriteLaTeXTitleLineButFirstWord( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "}%" << '\n'
+                     << "\\label{" << oaBlockList[t].GetPlainFirstWordView() << "}%" << '\n' << '\n';
 
           // Content.
-          oaBlockList[t].WriteLaTeXAllButTitleLine( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << std::endl << std::endl;
+          oaBlockList[t].WriteLaTeXAllButTitleLine( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << '\n' << '\n';
           break;
         }
 
         case tag_type::SUBSUBSECTION:
         {
           // Title line.
-          oOutStrm_i << "\\tagblocksubsubsection{";
-          oaBlockList[t].WriteLaTeXTitleLineButFirstWord( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "}%" << std::endl
-                     << "\\label{" << oaBlockList[t].GetPlainFirstWord() << "}%" << std::endl << std::endl;
+          oOutBuf_i << "\\tagblocksubsubsection{";
+          oaBlockList[t].WriteLaTeXTitleLineButFirstWord( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "}%" << '\n'
+                     << "\\label{" << oaBlockList[t].GetPlainFirstWordView() << "}%" << '\n' << '\n';
 
           // Content.
-          oaBlockList[t].WriteLaTeXAllButTitleLine( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << std::endl << std::endl;
+          oaBlockList[t].WriteLaTeXAllButTitleLine( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << '\n' << '\n';
           break;
         }
 
         case tag_type::EXAMPLE:
         {
-          oOutStrm_i << "\\verbatimtitle{" << oWriteInfo_i.Label( "Example" ) << "}" << std::endl
-                     << "\\begin{lstlisting}" << std::endl
-                     << oaBlockList[t].GetPlainText()
-                     << "\\end{lstlisting}" << std::endl;
+          oOutBuf_i << "\\verbatimtitle{" << oWriteInfo_i.Label( label_type::EXAMPLE ) << "}" << '\n'
+                     << "\\begin{lstlisting}" << '\n'
+                    << oaBlockList[t].GetPlainText()
+                     << "\\end{lstlisting}" << '\n';
           break;
         }
 
         case tag_type::IMAGE:
         {
-          oOutStrm_i << "\\begin{minipage}{\\textwidth}" << std::endl
-                     << "  \\begin{center}" << std::endl
-                     << "    \\includegraphics[width=\\maxwidth{\\textwidth}]{" << oaBlockList[t].GetPlainFirstWord() << "}\\\\" << std::endl
-                     << "    {";
-          oaBlockList[t].WriteLaTeXAllButFirstWord( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "}" << std::endl
-                     << "  \\end{center}" << std::endl
-                     << "\\end{minipage}" << std::endl << std::endl;
+          oOutBuf_i << "\\begin{minipage}{\\textwidth}" << '\n'
+                     << "  \\begin{center}" << '\n'
+                     << "    \\includegraphics[width=\\maxwidth{\\textwidth}]{" << oaBlockList[t].GetPlainFirstWordView() << "}\\\\" << '\n'
+                    << "    {";
+          oaBlockList[t].WriteLaTeXAllButFirstWord( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "}" << '\n'
+                     << "  \\end{center}" << '\n'
+                     << "\\end{minipage}" << '\n' << '\n';
           break;
         }
 
@@ -3355,35 +3890,35 @@ void escrido::CContentUnit::WriteLaTeXParSectDet( std::ostream& oOutStrm_i, cons
         {
           if( oWriteInfo_i.fInternalTags )
           {
-            oOutStrm_i << "\\begin{internal}" << std::endl;
-            oaBlockList[t].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
-            oOutStrm_i << "\\end{internal}" << std::endl << std::endl;
+            oOutBuf_i << "\\begin{internal}" << '\n';
+            oaBlockList[t].WriteLaTeX( oOutBuf_i, oWriteInfo_i );
+            oOutBuf_i << "\\end{internal}" << '\n' << '\n';
           }
           break;
         }
 
         case tag_type::NOTE:
         {
-          oOutStrm_i << "\\begin{note}" << std::endl;
-          oaBlockList[t].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "\\end{note}" << std::endl << std::endl;
+          oOutBuf_i << "\\begin{note}" << '\n';
+          oaBlockList[t].WriteLaTeX( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "\\end{note}" << '\n' << '\n';
           break;
         }
 
         case tag_type::OUTPUT:
         {
-          oOutStrm_i << "\\verbatimtitle{" << oWriteInfo_i.Label( "Output" ) << "}" << std::endl
-                     << "\\begin{lstlisting}" << std::endl
-                     << oaBlockList[t].GetPlainText()
-                     << "\\end{lstlisting}" << std::endl;
+          oOutBuf_i << "\\verbatimtitle{" << oWriteInfo_i.Label( label_type::OUTPUT ) << "}" << '\n'
+                     << "\\begin{lstlisting}" << '\n'
+                    << oaBlockList[t].GetPlainText()
+                     << "\\end{lstlisting}" << '\n';
           break;
         }
 
         case tag_type::REMARK:
         {
-          oOutStrm_i << "\\begin{remark}" << std::endl;
-          oaBlockList[t].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
-          oOutStrm_i << "\\end{remark}" << std::endl << std::endl;
+          oOutBuf_i << "\\begin{remark}" << '\n';
+          oaBlockList[t].WriteLaTeX( oOutBuf_i, oWriteInfo_i );
+          oOutBuf_i << "\\end{remark}" << '\n' << '\n';
           break;
         }
       }
@@ -3406,14 +3941,14 @@ void escrido::CContentUnit::WriteLaTeXParSectDet( std::ostream& oOutStrm_i, cons
 ///
 /// \param[in]  fTagType_i
 ///             Type of tag blocks that is written.
-/// \param[in]  oOutStrm_i
+/// \param[in]  oOutBuf_i
 ///             Output stream into which the tag block is written.
 /// \param[in]  oWriteInfo_i
 ///             Write-info structure with additional information.
 // *****************************************************************************
 
 void escrido::CContentUnit::WriteLaTeXTagBlock( tag_type fTagType_i,
-                                                std::ostream& oOutStrm_i,
+                                                outbuf::COutBuffer& oOutBuf_i,
                                                  const SWriteInfo& oWriteInfo_i ) const
 {
   if( this->HasTagBlock( fTagType_i ) )
@@ -3422,14 +3957,14 @@ void escrido::CContentUnit::WriteLaTeXTagBlock( tag_type fTagType_i,
     switch( fTagType_i )
     {
       case tag_type::BRIEF:
-        this->GetFirstTagBlock( tag_type::BRIEF )->WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+        this->GetFirstTagBlock( tag_type::BRIEF )->WriteLaTeX( oOutBuf_i, oWriteInfo_i );
         break;
 
       case tag_type::RETURN:
-        oOutStrm_i << "\\tagblocksection{"
-                   << oWriteInfo_i.Label( "Return value" )
-                   << "}" << std::endl;
-        this->GetFirstTagBlock( tag_type::RETURN )->WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+        oOutBuf_i << "\\tagblocksection{"
+                  << oWriteInfo_i.Label( label_type::RETURN_VALUE )
+                   << "}" << '\n';
+        this->GetFirstTagBlock( tag_type::RETURN )->WriteLaTeX( oOutBuf_i, oWriteInfo_i );
         break;
     }
   }
@@ -3448,7 +3983,7 @@ void escrido::CContentUnit::WriteLaTeXTagBlock( tag_type fTagType_i,
 ///             Type of tag blocks that is written.
 /// \param[in]  sIdentifier_i
 ///             Identifier of the tag block that is written.
-/// \param[in]  oOutStrm_i
+/// \param[in]  oOutBuf_i
 ///             Output stream into which the tag block is written.
 /// \param[in]  oWriteInfo_i
 ///             Write-info structure with additional information.
@@ -3456,7 +3991,7 @@ void escrido::CContentUnit::WriteLaTeXTagBlock( tag_type fTagType_i,
 
 void escrido::CContentUnit::WriteLaTeXTagBlock( tag_type fTagType_i,
                                                 const std::string& sIdentifier_i,
-                                                std::ostream& oOutStrm_i,
+                                                outbuf::COutBuffer& oOutBuf_i,
                                                 const SWriteInfo& oWriteInfo_i ) const
 {
   // Write tag block.
@@ -3469,7 +4004,7 @@ void escrido::CContentUnit::WriteLaTeXTagBlock( tag_type fTagType_i,
       bool fIdentFeatExists = false;
       for( size_t t = 0; t < oaBlockList.size(); t++ )
         if( oaBlockList[t].GetTagType() == fTagType_i &&
-            oaBlockList[t].GetPlainFirstWordOrQuote() == sIdentifier_i )
+            oaBlockList[t].GetPlainFirstWordOrQuoteView() == sIdentifier_i )
         {
           fIdentFeatExists = true;
           break;
@@ -3478,7 +4013,7 @@ void escrido::CContentUnit::WriteLaTeXTagBlock( tag_type fTagType_i,
       if( fIdentFeatExists )
       {
         // Write LaTeX elements
-        this->WriteLaTeXFeatureType( sIdentifier_i, oOutStrm_i, oWriteInfo_i );
+        this->WriteLaTeXFeatureType( sIdentifier_i, oOutBuf_i, oWriteInfo_i );
       }
 
       break;
@@ -3500,14 +4035,14 @@ void escrido::CContentUnit::WriteLaTeXTagBlock( tag_type fTagType_i,
 ///
 /// \param[in]  fTagType_i
 ///             Type of which all tag blocks are written.
-/// \param[in]  oOutStrm_i
+/// \param[in]  oOutBuf_i
 ///             Output stream into which the tag blocks are written.
 /// \param[in]  oWriteInfo_i
 ///             Write-info structure with additional information.
 // *****************************************************************************
 
 void escrido::CContentUnit::WriteLaTeXTagBlockList( tag_type fTagType_i,
-                                                    std::ostream& oOutStrm_i,
+                                                    outbuf::COutBuffer& oOutBuf_i,
                                                     const SWriteInfo& oWriteInfo_i ) const
 {
   if( this->HasTagBlock( fTagType_i ) )
@@ -3529,7 +4064,7 @@ void escrido::CContentUnit::WriteLaTeXTagBlockList( tag_type fTagType_i,
       while( iFeatType != saFeatureTypeList.end() )
       {
         // Write LaTeX elements
-        this->WriteLaTeXFeatureType( *iFeatType, oOutStrm_i, oWriteInfo_i );
+        this->WriteLaTeXFeatureType( *iFeatType, oOutBuf_i, oWriteInfo_i );
 
         // Cycle to next feature type.
         std::list <std::string>::iterator iFeat = iFeatType;
@@ -3546,19 +4081,19 @@ void escrido::CContentUnit::WriteLaTeXTagBlockList( tag_type fTagType_i,
     switch( fTagType_i )
     {
        case tag_type::ATTRIBUTE:
-         oOutStrm_i << "\\tagblocksection{" << oWriteInfo_i.Label( "Attributes" ) << "}" << std::endl;
+         oOutBuf_i << "\\tagblocksection{" << oWriteInfo_i.Label( label_type::ATTRIBUTES ) << "}" << '\n';
          break;
 
        case tag_type::PARAM:
-         oOutStrm_i << "\\tagblocksection{" << oWriteInfo_i.Label( "Parameters" ) << "}" << std::endl;
+         oOutBuf_i << "\\tagblocksection{" << oWriteInfo_i.Label( label_type::PARAMETERS ) << "}" << '\n';
          break;
 
        case tag_type::SEE:
-         oOutStrm_i << "\\tagblocksection{" << oWriteInfo_i.Label( "See also" ) << "}" << std::endl;
+         oOutBuf_i << "\\tagblocksection{" << oWriteInfo_i.Label( label_type::SEE_ALSO ) << "}" << '\n';
          break;
 
        case tag_type::SIGNATURE:
-         oOutStrm_i << "\\tagblocksection{" << oWriteInfo_i.Label( "Signatures" ) << "}" << std::endl;
+         oOutBuf_i << "\\tagblocksection{" << oWriteInfo_i.Label( label_type::SIGNATURES ) << "}" << '\n';
          break;
     }
 
@@ -3567,48 +4102,48 @@ void escrido::CContentUnit::WriteLaTeXTagBlockList( tag_type fTagType_i,
     {
       case tag_type::SEE:
       {
-        oOutStrm_i << "\\begin{itemize}" << std::endl;
+        oOutBuf_i << "\\begin{itemize}" << '\n';
         ++oWriteInfo_i;
 
         // Write all tag blocks of the specified type.
         for( size_t t = 0; t < oaBlockList.size(); t++ )
           if( oaBlockList[t].GetTagType() == tag_type::SEE )
-            oaBlockList[t].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+            oaBlockList[t].WriteLaTeX( oOutBuf_i, oWriteInfo_i );
 
         --oWriteInfo_i;
-        oOutStrm_i << "\\end{itemize}" << std::endl;
+        oOutBuf_i << "\\end{itemize}" << '\n';
 
         break;
       }
 
       case tag_type::SIGNATURE:
       {
-        oOutStrm_i << "\\begin{signaturelist}" << std::endl;
+        oOutBuf_i << "\\begin{signaturelist}" << '\n';
         ++oWriteInfo_i;
 
         // Write all tag blocks of the specified type.
         for( size_t t = 0; t < oaBlockList.size(); t++ )
           if( oaBlockList[t].GetTagType() == fTagType_i )
-            oaBlockList[t].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+            oaBlockList[t].WriteLaTeX( oOutBuf_i, oWriteInfo_i );
 
         --oWriteInfo_i;
-        oOutStrm_i << "\\end{signaturelist}" << std::endl;
+        oOutBuf_i << "\\end{signaturelist}" << '\n';
 
         break;
       }
 
       default:
       {
-        oOutStrm_i << "\\begin{taglist}" << std::endl;
+        oOutBuf_i << "\\begin{taglist}" << '\n';
         ++oWriteInfo_i;
 
         // Write all tag blocks of the specified type.
         for( size_t t = 0; t < oaBlockList.size(); t++ )
           if( oaBlockList[t].GetTagType() == fTagType_i )
-            oaBlockList[t].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+            oaBlockList[t].WriteLaTeX( oOutBuf_i, oWriteInfo_i );
 
         --oWriteInfo_i;
-        oOutStrm_i << "\\end{taglist}" << std::endl;
+        oOutBuf_i << "\\end{taglist}" << '\n';
 
         break;
       }
@@ -3618,6 +4153,51 @@ void escrido::CContentUnit::WriteLaTeXTagBlockList( tag_type fTagType_i,
 
 // .............................................................................
 
+// *****************************************************************************
+/// \brief      Appends the binary representation of the content unit
+///             (including its parsing states) to a buffer.
+// *****************************************************************************
+
+void escrido::CContentUnit::Serialize( std::string& sBuffer_io ) const
+{
+  binstream::Write( sBuffer_io, fContUnitType );
+  for( size_t s = 0; s < 3; s++ )
+    binstream::Write( sBuffer_io, fParseState[s] );
+  binstream::Write( sBuffer_io, static_cast<uint32_t>( oaBlockList.size() ) );
+  for( size_t b = 0; b < oaBlockList.size(); b++ )
+    oaBlockList[b].Serialize( sBuffer_io );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Restores the content unit from its binary representation.
+///
+/// \return     'true' on success, 'false' if the buffer is corrupted.
+// *****************************************************************************
+
+bool escrido::CContentUnit::Deserialize( const char*& pPos_io, const char* pEnd_i )
+{
+  if( !binstream::Read( pPos_io, pEnd_i, fContUnitType ) )
+    return false;
+  for( size_t s = 0; s < 3; s++ )
+    if( !binstream::Read( pPos_io, pEnd_i, fParseState[s] ) )
+      return false;
+
+  uint32_t nBlockN;
+  if( !binstream::Read( pPos_io, pEnd_i, nBlockN ) ||
+      nBlockN > static_cast<size_t>( pEnd_i - pPos_io ) )
+    return false;
+  oaBlockList.resize( nBlockN );
+  for( size_t b = 0; b < oaBlockList.size(); b++ )
+    if( !oaBlockList[b].Deserialize( pPos_io, pEnd_i ) )
+      return false;
+
+  return true;
+}
+
+// .............................................................................
+
 void escrido::CContentUnit::DebugOutput() const
 {
   switch( fContUnitType )
@@ -3642,23 +4222,23 @@ void escrido::CContentUnit::DebugOutput() const
 // *****************************************************************************
 
 void escrido::CContentUnit::WriteHTMLFeatureType( const std::string& sTypeIdentifier_i,
-                                                  std::ostream& oOutStrm_i,
+                                                  outbuf::COutBuffer& oOutBuf_i,
                                                   const SWriteInfo& oWriteInfo_i ) const
 {
   // Write HTML elements.
-  WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<section class=\"tagblock features "
-                                                  << GetCamelCase( sTypeIdentifier_i ) << "\">" << std::endl;
-  WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h2>" << GetCapForm( sTypeIdentifier_i ) << "</h2>" << std::endl;
-  WriteHTMLTagLine( "<dl>", oOutStrm_i, oWriteInfo_i++ );
+  WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<section class=\"tagblock features "
+                                                  << GetCamelCase( sTypeIdentifier_i ) << "\">" << '\n';
+  WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h2>" << GetCapForm( sTypeIdentifier_i ) << "</h2>" << '\n';
+  WriteHTMLTagLine( "<dl>", oOutBuf_i, oWriteInfo_i++ );
 
   // Loop over all tag blocks.
   for( size_t t = 0; t < oaBlockList.size(); t++ )
     if( oaBlockList[t].GetTagType() == tag_type::FEATURE )
-      if( oaBlockList[t].GetPlainFirstWordOrQuote() == sTypeIdentifier_i )
-        oaBlockList[t].WriteHTML( oOutStrm_i, oWriteInfo_i );
+      if( oaBlockList[t].GetPlainFirstWordOrQuoteView() == sTypeIdentifier_i )
+        oaBlockList[t].WriteHTML( oOutBuf_i, oWriteInfo_i );
 
-  WriteHTMLTagLine( "</dl>", oOutStrm_i, --oWriteInfo_i );
-  WriteHTMLTagLine( "</section>", oOutStrm_i, --oWriteInfo_i );
+  WriteHTMLTagLine( "</dl>", oOutBuf_i, --oWriteInfo_i );
+  WriteHTMLTagLine( "</section>", oOutBuf_i, --oWriteInfo_i );
 }
 
 // .............................................................................
@@ -3668,22 +4248,22 @@ void escrido::CContentUnit::WriteHTMLFeatureType( const std::string& sTypeIdenti
 // *****************************************************************************
 
 void escrido::CContentUnit::WriteLaTeXFeatureType( const std::string& sTypeIdentifier_i,
-                                                   std::ostream& oOutStrm_i,
+                                                   outbuf::COutBuffer& oOutBuf_i,
                                                    const SWriteInfo& oWriteInfo_i ) const
 {
   // Write tag block title line.
-  oOutStrm_i << "\\tagblocksection{" << GetCapForm( sTypeIdentifier_i ) << "}" << std::endl;
-  oOutStrm_i << "\\begin{taglist}" << std::endl;
+  oOutBuf_i << "\\tagblocksection{" << GetCapForm( sTypeIdentifier_i ) << "}" << '\n';
+  oOutBuf_i << "\\begin{taglist}" << '\n';
   ++oWriteInfo_i;
 
   // Loop over all tag blocks.
   for( size_t t = 0; t < oaBlockList.size(); t++ )
     if( oaBlockList[t].GetTagType() == tag_type::FEATURE )
-      if( oaBlockList[t].GetPlainFirstWordOrQuote() == sTypeIdentifier_i )
-        oaBlockList[t].WriteLaTeX( oOutStrm_i, oWriteInfo_i );
+      if( oaBlockList[t].GetPlainFirstWordOrQuoteView() == sTypeIdentifier_i )
+        oaBlockList[t].WriteLaTeX( oOutBuf_i, oWriteInfo_i );
 
   --oWriteInfo_i;
-  oOutStrm_i << "\\end{taglist}" << std::endl;
+  oOutBuf_i << "\\end{taglist}" << '\n';
 }
 
 // .............................................................................
@@ -3708,10 +4288,18 @@ void escrido::CContentUnit::SetParseState( parse_state fParseState_i )
 
 // -----------------------------------------------------------------------------
 
+outbuf::COutBuffer& escrido::WriteHTMLIndents( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i )
+{
+  oOutBuf_i.indent( oWriteInfo_i.nIndent );
+  return oOutBuf_i;
+}
+
+// -----------------------------------------------------------------------------
+
+/// Stream version of WriteHTMLIndents() (for code writing to std::ostream).
 std::ostream& escrido::WriteHTMLIndents( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i )
 {
-  for( unsigned int i = 0; i < oWriteInfo_i.nIndent; i++ )
-    oOutStrm_i << " ";
+  outbuf::COutBuffer( oOutStrm_i ).indent( oWriteInfo_i.nIndent );
   return oOutStrm_i;
 }
 
@@ -3722,9 +4310,9 @@ std::ostream& escrido::WriteHTMLIndents( std::ostream& oOutStrm_i, const SWriteI
 ///             line break.
 // *****************************************************************************
 
-void escrido::WriteHTMLTagLine( const std::string& sTagText_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i )
+void escrido::WriteHTMLTagLine( const std::string& sTagText_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i )
 {
-  WriteHTMLTagLine( sTagText_i.c_str(), oOutStrm_i, oWriteInfo_i );
+  WriteHTMLTagLine( sTagText_i.c_str(), oOutBuf_i, oWriteInfo_i );
 }
 
 // -----------------------------------------------------------------------------
@@ -3734,11 +4322,27 @@ void escrido::WriteHTMLTagLine( const std::string& sTagText_i, std::ostream& oOu
 ///             line break.
 // *****************************************************************************
 
+void escrido::WriteHTMLTagLine( const char* szTagText_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i )
+{
+  oOutBuf_i.indent( oWriteInfo_i.nIndent );
+  oOutBuf_i << szTagText_i << '\n';
+}
+
+// -----------------------------------------------------------------------------
+
+/// Stream version of WriteHTMLTagLine() (for code writing to std::ostream).
+void escrido::WriteHTMLTagLine( const std::string& sTagText_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i )
+{
+  WriteHTMLTagLine( sTagText_i.c_str(), oOutStrm_i, oWriteInfo_i );
+}
+
+// -----------------------------------------------------------------------------
+
+/// Stream version of WriteHTMLTagLine() (for code writing to std::ostream).
 void escrido::WriteHTMLTagLine( const char* szTagText_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i )
 {
-  for( unsigned int i = 0; i < oWriteInfo_i.nIndent; i++ )
-    oOutStrm_i << " ";
-  oOutStrm_i << szTagText_i << std::endl;
+  outbuf::COutBuffer oOutBuf( oOutStrm_i );
+  WriteHTMLTagLine( szTagText_i, oOutBuf, oWriteInfo_i );
 }
 
 // -----------------------------------------------------------------------------
@@ -3751,33 +4355,17 @@ void escrido::WriteHTMLTagLine( const char* szTagText_i, std::ostream& oOutStrm_
 std::string escrido::HTMLEscape( const std::string& sText_i )
 {
   std::string sReturn;
-  for( size_t c = 0; c < sText_i.size(); c++ )
-  {
-    switch( sText_i[c] )
-    {
-      case '<':
-        sReturn += "&lt;";
-        break;
-
-      case '>':
-        sReturn += "&gt;";
-        break;
-
-      case '&':
-        sReturn += "&amp;";
-        break;
-
-      case ' ':
-        sReturn += "&nbsp;";
-        break;
+  sReturn.reserve( sText_i.size() );
+  AppendHTMLEscaped( sText_i, sReturn );
+  return sReturn;
+}
 
-      default:
-        sReturn += sText_i[c];
-        break;
-    }
-  }
+// -----------------------------------------------------------------------------
 
-  return sReturn;
+/// Appends a text HTML escaped to an output buffer (see HTMLEscape()).
+void escrido::HTMLEscape( const strview::CStrView& sText_i, outbuf::COutBuffer& oOutBuf_i )
+{
+  AppendHTMLEscaped( sText_i, oOutBuf_i );
 }
 
 // -----------------------------------------------------------------------------
@@ -3790,152 +4378,42 @@ std::string escrido::HTMLEscape( const std::string& sText_i )
 std::string escrido::LaTeXEscape( const std::string& sText_i )
 {
   std::string sReturn;
-  for( size_t c = 0; c < sText_i.size(); c++ )
-  {
-    switch( sText_i[c] )
-    {
-      case '\\':
-        sReturn += "\\\\";
-        break;
-
-      case '$':
-        sReturn += "\\$";
-        break;
-
-      case '%':
-        sReturn += "\\%";
-        break;
-
-      case '_':
-        sReturn += "\\_";
-        break;
-
-      case '{':
-        sReturn += "\\{";
-        break;
-
-      case '}':
-        sReturn += "\\}";
-        break;
-
-      case '[':
-        sReturn += "{[}";
-        break;
-
-      case ']':
-        sReturn += "{]}";
-        break;
-
-      case '&':
-        sReturn += "\\&";
-        break;
-
-      case '#':
-        sReturn += "\\#";
-        break;
-
-      case '^':
-        sReturn += "{\\textasciicircum}"; //"\\^";
-        break;
-
-      // Symbol '´':
-      // (use numeric form to be cross-architecture compatible)
-      case '\xB4':
-        sReturn += "'";
-        break;
-
-      // Symbol '°':
-      // (use numeric form to be cross-architecture compatible)
-      case '\xBA':
-        sReturn += "{\\textdegree}";
-        break;
-
-      case '|':
-        sReturn += "{\\textbar}";
-        break;
-
-      case '<':
-        sReturn += "{\\textless}";
-        break;
-
-      case '>':
-        sReturn += "{\\textgreater}";
-        break;
+  sReturn.reserve( sText_i.size() );
+  AppendLaTeXEscaped( sText_i, sReturn );
+  return sReturn;
+}
 
-      default:
-        sReturn += sText_i[c];
-        break;
-    }
-  }
+// -----------------------------------------------------------------------------
 
-  return sReturn;
+/// Appends a text LaTeX escaped to an output buffer (see LaTeXEscape()).
+void escrido::LaTeXEscape( const strview::CStrView& sText_i, outbuf::COutBuffer& oOutBuf_i )
+{
+  AppendLaTeXEscaped( sText_i, oOutBuf_i );
 }
 
 // -----------------------------------------------------------------------------
 
 // *****************************************************************************
 /// \brief      Converts a string containing HTML content into pure LaTeX type
-///             content and returns it.
+///             content and returns it (by the built-in conversion rules).
 // *****************************************************************************
 
 std::string escrido::ConvertHTML2LaTeX( const std::string& sText_i )
 {
-  std::string sTextCpy( sText_i );
-  for( size_t nPos = 0; nPos < sTextCpy.size(); )
-  {
-    // Keep order of the exchange rules from high to low precedence:
-
-    // Very special commands:
-    if( ReplaceIfMatch( sTextCpy, nPos, "LaTeX", "{\\LaTeX}" ) ) continue;
-
-    // HTML specific commands:
-    if( ReplaceIfMatch( sTextCpy, nPos, "<HR>", "\\noindent\\rule{\\textwidth}{0.4pt} " ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "<em>", "\\textit{" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "</em>", "}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "<b>", "\\textbf{" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "</b>", "}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "<sup>", "$^\\textrm{\\footnotesize " ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "</sup>", "}$" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "<sub>", "$_\\textrm{\\footnotesize " ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "</sub>", "}$" ) ) continue;
-
-    // HTML entities:
-    if( ReplaceIfMatch( sTextCpy, nPos, "&amp;", "\\&" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "&gamma;", "$\\gamma$" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "&#42;", "*" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "&#124;", "{\\textbar}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "&#47;", "/" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "&#64;", "@" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "&lt;", "{\\textless}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "&gt;", "{\\textgreater}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "&#8477;", "$\\mathbb{R}$" ) ) continue;
-
-    // Avoid certain LaTeX ligatures:
-    if( ReplaceIfMatch( sTextCpy, nPos, "--", "-{}-" ) ) continue;
-
-    // Characters:
-    if( ReplaceIfMatch( sTextCpy, nPos, "\\", "\\\\" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "$", "\\$" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "%", "\\%" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "_", "\\_" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "{", "\\{" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "}", "\\}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "[", "{[}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "]", "{]}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "&", "\\&" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "#", "\\#" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "^", "{\\textasciicircum}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "´", "'" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "°", "{\\textdegree}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "|", "{\\textbar}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, "<", "{\\textless}" ) ) continue;
-    if( ReplaceIfMatch( sTextCpy, nPos, ">", "{\\textgreater}" ) ) continue;
+  return CLaTeXConverter::GetDefault().Convert( sText_i );
+}
 
-    // Increase counter;
-    nPos++;
-  }
+// -----------------------------------------------------------------------------
 
-  return sTextCpy;
+// *****************************************************************************
+/// \brief      Converts a string containing HTML content into pure LaTeX type
+///             content by the conversion rules of the write info and appends
+///             it to the output buffer.
+// *****************************************************************************
+
+void escrido::ConvertHTML2LaTeX( const strview::CStrView& sText_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i )
+{
+  oWriteInfo_i.pLaTeXConverter->Convert( sText_i.data(), sText_i.size(), oOutBuf_i );
 }
 
 // -----------------------------------------------------------------------------
@@ -4070,20 +4548,31 @@ bool escrido::ReplaceIfMatch( std::string& sText_i, size_t& nPos_i, const char*
 
 bool escrido::All( const std::string& sText_i, std::string& sAll_o )
 {
-  sAll_o.clear();
+  strview::CStrView sAll;
+  const bool fResult = All( strview::CStrView( sText_i ), sAll );
+  sAll_o.assign( sAll.data(), sAll.size() );
+  return fResult;
+}
 
-  // Search the text after the first white space.
-  size_t nBegin = sText_i.find_first_not_of( ' ' );
-  if( nBegin != std::string::npos )
-  {
-    // Detect length of the text
-    size_t nLen = sText_i.find_last_not_of( ' ' ) + 1 - nBegin;
+// -----------------------------------------------------------------------------
 
-    sAll_o = sText_i.substr( nBegin, nLen );
-    return true;
-  }
-  else
+/// View version of All() (returns a part of the input text without copying).
+bool escrido::All( const strview::CStrView& sText_i, strview::CStrView& sAll_o )
+{
+  sAll_o = strview::CStrView();
+
+  // Search the text after the first white space.
+  const size_t nBegin = SkipBlanks( sText_i, 0 );
+  if( nBegin == sText_i.size() )
     return false;
+
+  // Detect the end of the text.
+  size_t nEnd = sText_i.size();
+  while( sText_i[nEnd - 1] == ' ' )
+    --nEnd;
+
+  sAll_o = sText_i.substr( nBegin, nEnd - nBegin );
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -4103,26 +4592,37 @@ bool escrido::All( const std::string& sText_i, std::string& sAll_o )
 
 bool escrido::AllButFirstQuote( const std::string& sText_i, std::string& sAllButFirstQuote_o )
 {
-  sAllButFirstQuote_o.clear();
+  strview::CStrView sAllButFirstQuote;
+  const bool fResult = AllButFirstQuote( strview::CStrView( sText_i ), sAllButFirstQuote );
+  sAllButFirstQuote_o.assign( sAllButFirstQuote.data(), sAllButFirstQuote.size() );
+  return fResult;
+}
+
+// -----------------------------------------------------------------------------
+
+/// View version of AllButFirstQuote() (returns a part of the input text
+/// without copying).
+bool escrido::AllButFirstQuote( const strview::CStrView& sText_i, strview::CStrView& sAllButFirstQuote_o )
+{
+  sAllButFirstQuote_o = strview::CStrView();
 
-  size_t nBegin = sText_i.find_first_not_of( ' ' );
-  if( nBegin != std::string::npos )
+  size_t nBegin = SkipBlanks( sText_i, 0 );
+  if( nBegin == sText_i.size() )
+    return false;
+
+  if( sText_i[nBegin] != '"' )
   {
+    sAllButFirstQuote_o = sText_i.substr( nBegin );
+    return false;
+  }
+
+  // Search the closing quotation mark.
+  for( nBegin++; nBegin < sText_i.size(); nBegin++ )
     if( sText_i[nBegin] == '"' )
     {
-      nBegin = sText_i.find_first_of( '"', nBegin + 1 );
-      if( nBegin != std::string::npos )
-      {
-        nBegin = sText_i.find_first_not_of( ' ', nBegin + 1 );
-        if( nBegin != std::string::npos )
-          sAllButFirstQuote_o = sText_i.substr( nBegin );
-
-        return true;
-      }
+      sAllButFirstQuote_o = sText_i.substr( SkipBlanks( sText_i, nBegin + 1 ) );
+      return true;
     }
-    else
-      sAllButFirstQuote_o = sText_i.substr( nBegin );
-  }
 
   return false;
 }
@@ -4144,23 +4644,26 @@ bool escrido::AllButFirstQuote( const std::string& sText_i, std::string& sAllBut
 
 bool escrido::AllButFirstWord( const std::string& sText_i, std::string& sAllButFirstWord_o )
 {
-  sAllButFirstWord_o.clear();
+  strview::CStrView sAllButFirstWord;
+  const bool fResult = AllButFirstWord( strview::CStrView( sText_i ), sAllButFirstWord );
+  sAllButFirstWord_o.assign( sAllButFirstWord.data(), sAllButFirstWord.size() );
+  return fResult;
+}
 
-  size_t nBegin = sText_i.find_first_not_of( ' ' );
-  if( nBegin != std::string::npos )
-  {
-    nBegin = sText_i.find_first_of( ' ', nBegin );
-    if( nBegin != std::string::npos )
-    {
-      nBegin = sText_i.find_first_not_of( ' ', nBegin );
-      if( nBegin != std::string::npos )
-        sAllButFirstWord_o = sText_i.substr( nBegin );
-    }
+// -----------------------------------------------------------------------------
 
-    return true;
-  }
-  else
+/// View version of AllButFirstWord() (returns a part of the input text without
+/// copying).
+bool escrido::AllButFirstWord( const strview::CStrView& sText_i, strview::CStrView& sAllButFirstWord_o )
+{
+  sAllButFirstWord_o = strview::CStrView();
+
+  const size_t nBegin = SkipBlanks( sText_i, 0 );
+  if( nBegin == sText_i.size() )
     return false;
+
+  sAllButFirstWord_o = sText_i.substr( SkipBlanks( sText_i, FindBlank( sText_i, nBegin ) ) );
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -4180,22 +4683,27 @@ bool escrido::AllButFirstWord( const std::string& sText_i, std::string& sAllButF
 
 bool escrido::FirstWord( const std::string& sText_i, std::string& sFirstWord_o )
 {
-  sFirstWord_o.clear();
+  strview::CStrView sFirstWord;
+  const bool fResult = FirstWord( strview::CStrView( sText_i ), sFirstWord );
+  sFirstWord_o.assign( sFirstWord.data(), sFirstWord.size() );
+  return fResult;
+}
+
+// -----------------------------------------------------------------------------
+
+/// View version of FirstWord() (returns a part of the input text without
+/// copying).
+bool escrido::FirstWord( const strview::CStrView& sText_i, strview::CStrView& sFirstWord_o )
+{
+  sFirstWord_o = strview::CStrView();
 
   // Search the first non-white space (i.e. beginning of the first word).
-  size_t nBegin = sText_i.find_first_not_of( ' ' );
-  if( nBegin != std::string::npos )
-  {
-    // Detect length of the first word.
-    size_t nLen = sText_i.find_first_of( ' ', nBegin );
-    if( nLen != std::string::npos )
-      nLen -= nBegin;
-
-    sFirstWord_o = sText_i.substr( nBegin, nLen );
-    return true;
-  }
-  else
+  const size_t nBegin = SkipBlanks( sText_i, 0 );
+  if( nBegin == sText_i.size() )
     return false;
+
+  sFirstWord_o = sText_i.substr( nBegin, FindBlank( sText_i, nBegin ) - nBegin );
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -4215,26 +4723,32 @@ bool escrido::FirstWord( const std::string& sText_i, std::string& sFirstWord_o )
 
 bool escrido::FirstQuote( const std::string& sText_i, std::string& sFirstQuote_o )
 {
-  sFirstQuote_o.clear();
+  strview::CStrView sFirstQuote;
+  const bool fResult = FirstQuote( strview::CStrView( sText_i ), sFirstQuote );
+  sFirstQuote_o.assign( sFirstQuote.data(), sFirstQuote.size() );
+  return fResult;
+}
 
-  // Search for the first non-whitespace character.
-  size_t nBegin = sText_i.find_first_not_of( ' ' );
-  if( nBegin != std::string::npos )
-  {
-    if( sText_i[nBegin] == '"' )
-    {
-      ++nBegin;
+// -----------------------------------------------------------------------------
 
-      size_t nLen = sText_i.find_first_of( '"', nBegin );
-      if( nLen != std::string::npos )
-      {
-        nLen -= nBegin;
+/// View version of FirstQuote() (returns a part of the input text without
+/// copying).
+bool escrido::FirstQuote( const strview::CStrView& sText_i, strview::CStrView& sFirstQuote_o )
+{
+  sFirstQuote_o = strview::CStrView();
 
-        sFirstQuote_o = sText_i.substr( nBegin, nLen );
-        return true;
-      }
+  // Search for the first non-whitespace character.
+  const size_t nBegin = SkipBlanks( sText_i, 0 );
+  if( nBegin == sText_i.size() || sText_i[nBegin] != '"' )
+    return false;
+
+  // Search the closing quotation mark.
+  for( size_t nEnd = nBegin + 1; nEnd < sText_i.size(); nEnd++ )
+    if( sText_i[nEnd] == '"' )
+    {
+      sFirstQuote_o = sText_i.substr( nBegin + 1, nEnd - nBegin - 1 );
+      return true;
     }
-  }
 
   return false;
 }
@@ -4258,29 +4772,38 @@ bool escrido::FirstQuote( const std::string& sText_i, std::string& sFirstQuote_o
 
 bool escrido::FirstLine( const std::string& sText_i, std::string& sFirstLine_o )
 {
-  sFirstLine_o.clear();
+  strview::CStrView sFirstLine;
+  const bool fResult = FirstLine( strview::CStrView( sText_i ), sFirstLine );
+  sFirstLine_o.assign( sFirstLine.data(), sFirstLine.size() );
+  return fResult;
+}
 
-  // Search the text after the first white space.
-  size_t nBegin = sText_i.find_first_not_of( ' ' );
-  if( nBegin != std::string::npos )
-  {
-    // Search the first line break or alternative the end of the string.
-    size_t nEnd = sText_i.find_first_of( "\r\n", nBegin );
-    if( nEnd == std::string::npos )
-      nEnd = sText_i.length();
-    if( nEnd == nBegin )
-      return false;
-    else
-      --nEnd;
+// -----------------------------------------------------------------------------
 
-    // Detect length of the text by skipping last white spaces
-    size_t nLen = sText_i.find_last_not_of( ' ', nEnd ) + 1 - nBegin;
+/// View version of FirstLine() (returns a part of the input text without
+/// copying).
+bool escrido::FirstLine( const strview::CStrView& sText_i, strview::CStrView& sFirstLine_o )
+{
+  sFirstLine_o = strview::CStrView();
 
-    sFirstLine_o = sText_i.substr( nBegin, nLen );
-    return true;
-  }
-  else
+  // Search the text after the first white space.
+  const size_t nBegin = SkipBlanks( sText_i, 0 );
+  if( nBegin == sText_i.size() )
+    return false;
+
+  // Search the first line break or alternative the end of the string.
+  size_t nEnd = nBegin;
+  while( nEnd < sText_i.size() && sText_i[nEnd] != '\r' && sText_i[nEnd] != '\n' )
+    ++nEnd;
+  if( nEnd == nBegin )
     return false;
+
+  // Skip last white spaces.
+  while( sText_i[nEnd - 1] == ' ' )
+    --nEnd;
+
+  sFirstLine_o = sText_i.substr( nBegin, nEnd - nBegin );
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -4293,7 +4816,8 @@ bool escrido::FirstLine( const std::string& sText_i, std::string& sFirstLine_o )
 /// \param[in]  sDelim_i
 ///             The deliminator string.
 /// \param[out] asTokens_o
-///             The list of tokens (w/o leading and ending blank spaces).
+///             The list of tokens (w/o leading and ending blank spaces; empty
+///             tokens are skipped).
 ///
 /// \return     true, if one or more tokens were found, false otherwise.
 // *****************************************************************************
@@ -4301,31 +4825,47 @@ bool escrido::FirstLine( const std::string& sText_i, std::string& sFirstLine_o )
 bool escrido::Tokenize( const std::string& sText_i,
                         const std::string& sDelim_i,
                         std::vector<std::string>& asTokens_o )
+{
+  std::vector <strview::CStrView> asTokens;
+  Tokenize( strview::CStrView( sText_i ), strview::CStrView( sDelim_i ), asTokens );
+
+  asTokens_o.clear();
+  for( size_t t = 0; t < asTokens.size(); t++ )
+    asTokens_o.emplace_back( asTokens[t].data(), asTokens[t].size() );
+
+  return !asTokens_o.empty();
+}
+
+// -----------------------------------------------------------------------------
+
+/// View version of Tokenize() (the tokens are parts of the input text; the
+/// token list can be reused without reallocation).
+bool escrido::Tokenize( const strview::CStrView& sText_i,
+                        const strview::CStrView& sDelim_i,
+                        std::vector<strview::CStrView>& asTokens_o )
 {
   asTokens_o.clear();
 
-  const size_t nTextLen = sText_i.length();
-  const char cBlank = ' ';
   size_t nBegin = 0;
-  size_t nEnd, nTokBegin, nTokEnd;
   while( true )
   {
     // Get end position of token (including blank spaces)
-    nEnd = sText_i.find( sDelim_i, nBegin );
-    if( nEnd == std::string::npos )
-      nEnd = nTextLen;
+    const size_t nEnd = std::search( sText_i.begin() + nBegin, sText_i.end(),
+                                     sDelim_i.begin(), sDelim_i.end() ) - sText_i.begin();
 
     // Reduce token by front and end blank spaces
-    nTokBegin = sText_i.find_first_not_of( &cBlank, nBegin, nEnd - nBegin );
-    if( nTokBegin != std::string::npos )
-    {
-      nTokEnd = sText_i.find_last_not_of( &cBlank, nEnd - 1, nEnd - nTokBegin ) + 1;
-
-      // Add token (w/o front and end blank spaces )
+    size_t nTokBegin = nBegin;
+    size_t nTokEnd = nEnd;
+    while( nTokBegin < nTokEnd && sText_i[nTokBegin] == ' ' )
+      ++nTokBegin;
+    while( nTokEnd > nTokBegin && sText_i[nTokEnd - 1] == ' ' )
+      --nTokEnd;
+
+    // Add token (w/o front and end blank spaces )
+    if( nTokBegin != nTokEnd )
       asTokens_o.push_back( sText_i.substr( nTokBegin, nTokEnd - nTokBegin ) );
-    }
 
-    if( nEnd == nTextLen )
+    if( nEnd == sText_i.size() )
       break;
     else
       nBegin = nEnd + 1;
@@ -4346,15 +4886,16 @@ bool escrido::Tokenize( const std::string& sText_i,
 ///             identifier.
 // *****************************************************************************
 
-std::string escrido::MakeIdentifier( const std::string& sText_i )
+std::string escrido::MakeIdentifier( const strview::CStrView& sText_i )
 {
   // Get first word.
-  std::string sFirstWord;
+  strview::CStrView sFirstWord;
   if( !FirstWord( sText_i, sFirstWord ) )
     return std::string( "no-identifier" );
 
   // Result value.
   std::string sResult;
+  sResult.reserve( sFirstWord.size() );
 
   // Render first word into an identifier.
   bool fFirstLetter = true;
@@ -4383,30 +4924,59 @@ std::string escrido::MakeIdentifier( const std::string& sText_i )
 
 // -----------------------------------------------------------------------------
 
+// *****************************************************************************
+/// \brief      Looks up the tag index of a tag name (see anTagHashTable).
+///
+/// \param[in]  pTagName_i
+///             The tag name (not necessarily null-terminated).
+/// \param[in]  nLen_i
+///             Length of the tag name.
+/// \param[out] nTagIdx_o
+///             Returns the tag index.
+///
+/// \return     'true' if the tag name is known, 'false' otherwise.
+// *****************************************************************************
+
+bool escrido::GetTagIdx( const char* pTagName_i, size_t nLen_i, unsigned int& nTagIdx_o )
+{
+  if( nLen_i == 0 )
+    return false;
+
+  // Only the tag name of the hash value can match.
+  const unsigned char nTagIdx = anTagHashTable[TagNameHash( pTagName_i, nLen_i )];
+  if( nTagIdx == nNoTagIdx )
+    return false;
+
+  const char* szTagName = GetTagName( nTagIdx );
+  if( strncmp( szTagName, pTagName_i, nLen_i ) != 0 || szTagName[nLen_i] != '\0' )
+    return false;
+
+  nTagIdx_o = nTagIdx;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
 bool escrido::GetBlockTagType( const char* szTagName_i, tag_type& fTagType_o )
 {
-  for( unsigned int t = 0; t < nBlockTagTypeN; t++ )
-    if( strcmp( szTagName_i, oaBlockTagTypeList[t].szName ) == 0 )
-    {
-      fTagType_o = oaBlockTagTypeList[t].fType;
-      return true;
-    }
+  unsigned int nTagIdx;
+  if( !GetTagIdx( szTagName_i, strlen( szTagName_i ), nTagIdx ) || nTagIdx >= nBlockTagTypeN )
+    return false;
 
-  return false;
+  fTagType_o = oaBlockTagTypeList[nTagIdx].fType;
+  return true;
 }
 
 // -----------------------------------------------------------------------------
 
 bool escrido::GetInlineTagType( const char* szTagName_i, tag_type& fTagType_o )
 {
-  for( unsigned int t = 0; t < nBlockTagTypeN; t++ )
-    if( strcmp( szTagName_i, oaInlineTagTypeList[t].szName ) == 0 )
-    {
-      fTagType_o = oaInlineTagTypeList[t].fType;
-      return true;
-    }
+  unsigned int nTagIdx;
+  if( !GetTagIdx( szTagName_i, strlen( szTagName_i ), nTagIdx ) || nTagIdx < nBlockTagTypeN )
+    return false;
 
-  return false;
+  fTagType_o = oaInlineTagTypeList[nTagIdx - nBlockTagTypeN].fType;
+  return true;
 }
 
 // -----------------------------------------------------------------------------
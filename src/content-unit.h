@@ -21,8 +21,13 @@
 
 #include <string>
 #include <vector>
+#include <ostream>          // std::ostream
+#include <cstdint>          // uint32_t
 
+#include "outbuf.h"
+#include "strview.h"
 #include "reftable.h"
+#include "html2latex.h"
 
 // -----------------------------------------------------------------------------
 
@@ -69,7 +74,7 @@ namespace escrido
 // -----------------------------------------------------------------------------
 
 // Content chunk types:
-enum class cont_chunk_type
+enum class cont_chunk_type : unsigned char
 {
   UNDEFINED,
   HTML_TEXT,
@@ -170,7 +175,7 @@ enum class verbatim_start_mode
 
 // Flag for skipping the first whitespace of a content chunk, e.g. plain text
 // chunk in CODE or LINK tags.
-enum class skip_first_white
+enum class skip_first_white : unsigned char
 {
   INIT,
   OFF
@@ -192,6 +197,26 @@ enum class cont_unit_type
   MULTI_LINE
 };
 
+// Built-in labels of the output (headings that can be relabeled):
+enum class label_type : unsigned char
+{
+  ATTRIBUTES,
+  AUTHOR,
+  COPYRIGHT,
+  DATE,
+  DETAILS,
+  EXAMPLE,
+  INTERNAL,
+  NOTE,
+  OUTPUT,
+  PARAMETERS,
+  REMARK,
+  RETURN_VALUE,
+  SEE_ALSO,
+  SIGNATURES,
+  VERSION
+};
+
 namespace escrido
 {
   // Struct for definine tag type strings.
@@ -203,7 +228,7 @@ namespace escrido
 
   // Block tag types:
   const unsigned int nBlockTagTypeN = 26;
-  const escrido::STagType oaBlockTagTypeList[nBlockTagTypeN] = {
+  constexpr escrido::STagType oaBlockTagTypeList[nBlockTagTypeN] = {
     { tag_type::ATTRIBUTE,     "attribute" },
     { tag_type::AUTHOR,        "author" },
     { tag_type::BRIEF,         "brief" },
@@ -232,8 +257,8 @@ namespace escrido
     { tag_type::VERSION,       "version" } };
 
   // Inline tag types:
-  const unsigned int nInlineTagTypeN = 12;
-  const escrido::STagType oaInlineTagTypeList[nInlineTagTypeN] = {
+  const unsigned int nInlineTagTypeN = 11;
+  constexpr escrido::STagType oaInlineTagTypeList[nInlineTagTypeN] = {
     { tag_type::CODE,         "code" },
     { tag_type::CODE,         "c" },
     { tag_type::END_CODE,     "endcode" },
@@ -245,6 +270,69 @@ namespace escrido
     { tag_type::END_TABLE,    "endtable" },
     { tag_type::VERBATIM,     "verbatim" },
     { tag_type::END_VERBATIM, "endverbatim" } };
+
+  // Tag indices: the block tag types followed by the inline tag types.
+  const unsigned int nTagTypeN = nBlockTagTypeN + nInlineTagTypeN;
+  const unsigned char nNoTagIdx = 0xFF;
+
+  // Returns the tag name of a tag index.
+  constexpr const char* GetTagName( unsigned int nTagIdx_i )
+  {
+    return nTagIdx_i < nBlockTagTypeN ? oaBlockTagTypeList[nTagIdx_i].szName
+                                      : oaInlineTagTypeList[nTagIdx_i - nBlockTagTypeN].szName;
+  }
+
+  // Perfect hash function of the tag names. (The factors are chosen such that
+  // no two tag names share a hash value; see the check below.)
+  const unsigned int nTagHashN = 64;
+  constexpr unsigned int TagNameHash( const char* pTagName_i, size_t nLen_i )
+  {
+    return ( nLen_i * 20u +
+             static_cast<unsigned char>( pTagName_i[0] ) * 8u +
+             static_cast<unsigned char>( pTagName_i[nLen_i - 1] ) * 19u +
+             ( nLen_i > 1 ? static_cast<unsigned char>( pTagName_i[1] ) * 17u : 0u ) ) % nTagHashN;
+  }
+
+  // Tag indices by hash value of the tag names (nNoTagIdx: no tag).
+  constexpr unsigned char anTagHashTable[nTagHashN] = {
+    255,  28, 255,  21,  22,  27,  26,   3,  20, 255, 255,  24, 255, 255, 255,  23,
+     30,  15, 255,  32,  12,  34, 255, 255,   2, 255,  31,  25,  35, 255,  13, 255,
+      4, 255, 255,  16,  14, 255, 255,  19,   8,  36,   5,   6,  17, 255,  18,   0,
+      7, 255,   9, 255,  33, 255, 255, 255, 255,  11,  10,   1,  29, 255, 255, 255 };
+
+  // Compile time check of the hash table: every tag name must be found at the
+  // position of its hash value.
+  constexpr size_t TagNameLen( const char* szTagName_i )
+  {
+    return *szTagName_i == '\0' ? 0 : 1 + TagNameLen( szTagName_i + 1 );
+  }
+  constexpr bool TagHashTableValid( unsigned int nTagIdx_i )
+  {
+    return nTagIdx_i == nTagTypeN ||
+           ( anTagHashTable[TagNameHash( GetTagName( nTagIdx_i ), TagNameLen( GetTagName( nTagIdx_i ) ) )] == nTagIdx_i &&
+             TagHashTableValid( nTagIdx_i + 1 ) );
+  }
+  static_assert( TagHashTableValid( 0 ), "tag name hash table does not match the tag type lists" );
+
+  // Default terms of the built-in labels (in order of label_type):
+  const unsigned int nLabelTypeN = 15;
+  constexpr const char* aszLabelList[nLabelTypeN] = {
+    "Attributes",
+    "Author",
+    "Copyright",
+    "Date",
+    "Details",
+    "Example",
+    "Internal",
+    "Note",
+    "Output",
+    "Parameters",
+    "Remark",
+    "Return value",
+    "See also",
+    "Signatures",
+    "Version"
+  };
 }
 
 // -----------------------------------------------------------------------------
@@ -255,22 +343,36 @@ namespace escrido
 
 namespace escrido
 {
+  outbuf::COutBuffer& WriteHTMLIndents( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i );
   std::ostream& WriteHTMLIndents( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i );
+  void          WriteHTMLTagLine( const std::string& sTagText_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i );
+  void          WriteHTMLTagLine( const char* szTagText_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i );
   void          WriteHTMLTagLine( const std::string& sTagText_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i );
   void          WriteHTMLTagLine( const char* szTagText_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i );
   std::string   HTMLEscape( const std::string& sText_i );
+  void          HTMLEscape( const strview::CStrView& sText_i, outbuf::COutBuffer& oOutBuf_i );
   std::string   LaTeXEscape( const std::string& sText_i );
+  void          LaTeXEscape( const strview::CStrView& sText_i, outbuf::COutBuffer& oOutBuf_i );
   std::string   ConvertHTML2LaTeX( const std::string& sText_i );
+  void          ConvertHTML2LaTeX( const strview::CStrView& sText_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i );
   std::string   ConvertHTML2ClearText( const std::string& sText_i );
   bool          ReplaceIfMatch( std::string& sText_i, size_t& nPos_i, const char* szPattern_i, const char* szReplacement_i );
   bool          All( const std::string& sText_i, std::string& sAll_o );
+  bool          All( const strview::CStrView& sText_i, strview::CStrView& sAll_o );
   bool          AllButFirstQuote( const std::string& sText_i, std::string& sAllButFirstQuote_o );
+  bool          AllButFirstQuote( const strview::CStrView& sText_i, strview::CStrView& sAllButFirstQuote_o );
   bool          AllButFirstWord( const std::string& sText_i, std::string& sAllButFirstWord_o );
+  bool          AllButFirstWord( const strview::CStrView& sText_i, strview::CStrView& sAllButFirstWord_o );
   bool          FirstWord( const std::string& sText_i, std::string& sFirstWord_o );
+  bool          FirstWord( const strview::CStrView& sText_i, strview::CStrView& sFirstWord_o );
   bool          FirstQuote( const std::string& sText_i, std::string& sFirstQuote_o );
+  bool          FirstQuote( const strview::CStrView& sText_i, strview::CStrView& sFirstQuote_o );
   bool          FirstLine( const std::string& sText_i, std::string& sFirstLine_o );
+  bool          FirstLine( const strview::CStrView& sText_i, strview::CStrView& sFirstLine_o );
   bool          Tokenize( const std::string& sText_i, const std::string& sDelim_i, std::vector<std::string>& asTokens_o );
-  std::string   MakeIdentifier( const std::string& sWord_i );
+  bool          Tokenize( const strview::CStrView& sText_i, const strview::CStrView& sDelim_i, std::vector<strview::CStrView>& asTokens_o );
+  std::string   MakeIdentifier( const strview::CStrView& sWord_i );
+  bool          GetTagIdx( const char* pTagName_i, size_t nLen_i, unsigned int& nTagIdx_o );
   bool          GetBlockTagType( const char* szTagName_i, tag_type& fTagType_o );
   bool          GetInlineTagType( const char* szTagName_i, tag_type& fTagType_o );
   std::string   GetCamelCase( const std::string& sName_i );
@@ -287,17 +389,21 @@ namespace escrido
 
 struct escrido::SWriteInfo
 {
-  CRefTable                  oRefTable;
+  const CRefTable&           oRefTable;     // Reference table (owned by the caller; not copied with the write info).
   const std::vector <std::pair<std::string, std::string>>& oRelabelList;
   bool                       fInternalTags;
+  bool                       fProgress;     // Flag whether the progress of writing is reported on the console.
+  const CLaTeXConverter*     pLaTeXConverter;
 
-  mutable const CTagBlock*   pTagBlock;
   mutable signed int         nIndent;
 
-  SWriteInfo( const std::vector <std::pair<std::string, std::string>>& oRelabelList_i );
+  const char*                aszLabel[nLabelTypeN]; // Terms of the built-in labels (default or custom).
+
+  SWriteInfo( const CRefTable& oRefTable_i,
+              const std::vector <std::pair<std::string, std::string>>& oRelabelList_i );
 
   // Default or custom term:
-  const char* Label( const char* szLabel_i ) const;
+  const char* Label( label_type fLabel_i ) const;
 
   // Indentation tracking:
   const SWriteInfo& operator++() const;   // Prefix:  ++c
@@ -312,51 +418,91 @@ struct escrido::SWriteInfo
 
 // -----------------------------------------------------------------------------
 
+// *****************************************************************************
+/// \brief      A content chunk, i.e. a piece of text or a structural element
+///             (e.g. a paragraph start or a table cell) of a tag block.
+///
+/// \details    Chunks are compact records: the text of all chunks of a block
+///             is stored in a single text buffer of the block and a chunk only
+///             holds its position and length therein. Structural chunks have
+///             no text. The resolved references of REF and LINK chunks are
+///             stored in a side table of the block, too. Hence all methods
+///             that access the text take the owning tag block.
+// *****************************************************************************
+
 class escrido::CContentChunk
 {
+  public:
+
+    /// Resolved reference of a REF or LINK chunk (see ResolveRef()).
+    struct SResolvedRef
+    {
+      unsigned long nRefStamp;              ///< Stamp of the reference table resolved against (0: not resolved).
+      size_t nRefIdx;                       ///< Index of the reference (std::string::npos: unresolved).
+      std::string sRefTarget;               ///< Reference identifier (REF) or URL (LINK).
+      std::string sRefText;                 ///< Display text (REF) or explicit link text (LINK).
+
+      SResolvedRef();
+    };
+
   private:
 
     cont_chunk_type fType;                  ///< Content chunk type.
-    std::string sContent;                   ///< General type content.
-
     skip_first_white fSkipFirstWhite;       ///< Flag for skipping the first whitespace.
+    uint32_t nTextPos;                      ///< Position of the text in the text buffer of the block.
+    uint32_t nTextLen;                      ///< Length of the text.
+    uint32_t nRefSlot;                      ///< Index of the resolved reference in the side table of the block (REF and LINK chunks).
 
   public:
 
     // Constructor:
     CContentChunk();
     CContentChunk( const cont_chunk_type fType_i );
+    CContentChunk( const cont_chunk_type fType_i, const uint32_t nRefSlot_i );
 
     // Member administration:
     cont_chunk_type GetType() const;
-    std::string& GetContent();
+    strview::CStrView GetContent( const CTagBlock& oTagBlock_i ) const;
     void SetSkipFirstWhiteMode( skip_first_white fSkipFirstWhite_i );
 
-    // Access of formated text content:
-    std::string GetPlainText() const;
-    std::string GetPlainFirstWord() const;
-    std::string GetPlainFirstWordOrQuote() const;
-    std::string GetPlainAllButFirstWord() const;
-    std::string GetPlainFirstLine() const;
+    // Access of formated text content (views into the text buffer of the block):
+    strview::CStrView GetPlainText( const CTagBlock& oTagBlock_i ) const;
+    strview::CStrView GetPlainFirstWord( const CTagBlock& oTagBlock_i ) const;
+    strview::CStrView GetPlainFirstWordOrQuote( const CTagBlock& oTagBlock_i ) const;
+    strview::CStrView GetPlainAllButFirstWord( const CTagBlock& oTagBlock_i ) const;
+    strview::CStrView GetPlainFirstLine( const CTagBlock& oTagBlock_i ) const;
 
-    // Append parsing content:
-    void AppendChar( const char cChar_i );
+    // Append parsing content (last chunk of the block only):
+    void AppendChar( std::string& sText_io, const char cChar_i );
+    void RemoveLastBlank( std::string& sText_io );
+
+    // Reference resolution:
+    bool ResolveRef( const CTagBlock& oTagBlock_i, const CRefTable& oRefTable_i ) const;
+    const std::string& GetRefTarget( const CTagBlock& oTagBlock_i ) const;
 
     // Output method:
-    void WriteHTML( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    bool WriteHTMLFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    bool WriteHTMLAllButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    bool WriteHTMLAllButFirstWordOrQuote( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTML( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    bool WriteHTMLFirstWord( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    bool WriteHTMLAllButFirstWord( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    bool WriteHTMLAllButFirstWordOrQuote( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
 
-    void WriteLaTeX( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    bool WriteLaTeXFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    bool WriteLaTeXAllButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    bool WriteLaTeXAllButFirstWordOrQuote( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeX( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    bool WriteLaTeXFirstWord( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    bool WriteLaTeXAllButFirstWord( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    bool WriteLaTeXAllButFirstWordOrQuote( const CTagBlock& oTagBlock_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+
+    // Serialization:
+    void Serialize( std::string& sBuffer_io ) const;
+    bool Deserialize( const char*& pPos_io, const char* pEnd_i, const CTagBlock& oTagBlock_i );
 
     // Debug output:
-    void DebugOutput() const;
+    void DebugOutput( const CTagBlock& oTagBlock_i ) const;
 };
 
+// Every tag block holds one chunk per text run and structural element: keep the
+// chunk a compact record (see tools/bench/microbench for the block memory).
+static_assert( sizeof( escrido::CContentChunk ) <= 16, "CContentChunk must not exceed 16 bytes" );
+
 // -----------------------------------------------------------------------------
 
 // CLASS CTagBlock
@@ -370,6 +516,9 @@ class escrido::CTagBlock
     // Data:
     tag_type fType;                                 ///< Type of the tag block, e.g. "details" or "param".
     std::vector <CContentChunk> oaChunkList;        ///< List of chunks the block content consists of.
+    std::string sText;                              ///< Text buffer of the chunks.
+    mutable std::vector <CContentChunk::SResolvedRef>
+      oaRefList;                                    ///< Resolved references of the REF and LINK chunks.
 
     // Parsing states and flags:
     std::vector <tag_block_write_mode> faWriteMode; ///< Internal write mode stack (e.g. text mode, table mode, unordered list mode).
@@ -397,7 +546,15 @@ class escrido::CTagBlock
     std::string GetPlainTitleLine() const;
     std::string GetPlainTitleLineButFirstWord() const;
 
+    // Access of formated text content (w/o allocation):
+    strview::CStrView GetPlainFirstWordView() const;
+    strview::CStrView GetPlainFirstWordOrQuoteView() const;
+    void GetPlainText( std::string& sText_o ) const;
+    void GetPlainTitleLine( std::string& sTitleLine_o ) const;
+    void GetPlainTitleLineButFirstWord( std::string& sTitleLine_o ) const;
+
     // Content chunk navigation:
+    size_t GetChunkN() const;
     const CContentChunk* GetNextContentChunk( const CContentChunk* pContentChunk ) const;
 
     // Append parsing content:
@@ -406,22 +563,33 @@ class escrido::CTagBlock
     void AppendNewLine();
     void AppendDoubleNewLine();
 
+    // Reference resolution:
+    void ResolveRefs( const CRefTable& oRefTable_i, std::vector<std::string>& asUnresolved_o ) const;
+
     // Output method:
+    void WriteHTML( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLTitleLine( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLTitleLineButFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLTitleLineButFirstWordOrQuote( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLAllButFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLAllButTitleLine( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+
+    void WriteLaTeX( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXTitleLine( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXTitleLineButFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXTitleLineButFirstWordOrQuote( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXAllButFirstWord( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXAllButTitleLine( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+
+    // Output method (stream adapters):
     void WriteHTML( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTitleLine( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTitleLineButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTitleLineButFirstWordOrQuote( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLAllButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLAllButTitleLine( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-
     void WriteLaTeX( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXTitleLine( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXTitleLineButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXTitleLineButFirstWordOrQuote( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXAllButFirstWord( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXAllButTitleLine( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
+
+    // Serialization:
+    void Serialize( std::string& sBuffer_io ) const;
+    bool Deserialize( const char*& pPos_io, const char* pEnd_i );
 
     // Debug output:
     void DebugOutput() const;
@@ -431,6 +599,7 @@ class escrido::CTagBlock
     void AppendCharDefault( const char cChar_i );
     void EscapeFromWriteModes( const std::vector<tag_block_write_mode>& oaWriteModes_i );
 
+  friend class escrido::CContentChunk;
   friend class escrido::CContentUnit;
 };
 
@@ -466,6 +635,7 @@ class escrido::CContentUnit
     void AppendTab();
     void AppendChar( const char cChar_i );
     void AppendTag( const char* szTagName_i );
+    void AppendTag( unsigned int nTagIdx_i );
 
     // Methods for accessing tag blocks:
     size_t           GetTagBlockN() const;
@@ -475,16 +645,23 @@ class escrido::CContentUnit
     const CTagBlock* GetFirstTagBlock( tag_type fTagType_i ) const;
     const CTagBlock* GetNextTagBlock( const CTagBlock* pLast_i, tag_type fTagType_i ) const;
 
+    // Reference resolution:
+    void ResolveRefs( const CRefTable& oRefTable_i, std::vector<std::string>& asUnresolved_o ) const;
+
     // Output method:
-    void WriteHTMLParSectDet( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTagBlock( tag_type fTagType_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTagBlock( tag_type fTagType_i, const std::string& sIdentifier_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTagBlockList( tag_type fTagType_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLParSectDet( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLTagBlock( tag_type fTagType_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLTagBlock( tag_type fTagType_i, const std::string& sIdentifier_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLTagBlockList( tag_type fTagType_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
 
-    void WriteLaTeXParSectDet( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXTagBlock( tag_type fTagType_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXTagBlock( tag_type fTagType_i, const std::string& sIdentifier_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXTagBlockList( tag_type fTagType_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXParSectDet( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXTagBlock( tag_type fTagType_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXTagBlock( tag_type fTagType_i, const std::string& sIdentifier_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXTagBlockList( tag_type fTagType_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+
+    // Serialization:
+    void Serialize( std::string& sBuffer_io ) const;
+    bool Deserialize( const char*& pPos_io, const char* pEnd_i );
 
     // Debug output:
     void DebugOutput() const;
@@ -493,14 +670,17 @@ class escrido::CContentUnit
 
     // Specific output methods:
     void WriteHTMLFeatureType( const std::string& sTypeIdentifier_i,
-                               std::ostream& oOutStrm_i,
+                               outbuf::COutBuffer& oOutBuf_i,
                                const SWriteInfo& oWriteInfo_i ) const;
     void WriteLaTeXFeatureType( const std::string& sTypeIdentifier_i,
-                                std::ostream& oOutStrm_i,
+                                outbuf::COutBuffer& oOutBuf_i,
                                 const SWriteInfo& oWriteInfo_i ) const;
 
     // Parsing state setting:
     void SetParseState( parse_state fParseState_i );
+
+    // Tag appending:
+    void AppendTag( const char* szTagName_i, unsigned int nTagIdx_i );
 };
 
 
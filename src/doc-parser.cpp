@@ -0,0 +1,70 @@
+// -----------------------------------------------------------------------------
+/// \file       doc-parser.cpp
+///
+/// \brief      Module implementation file for the entry point of the
+///             flex/bison documentation parser.
+// -----------------------------------------------------------------------------
+
+#include "doc-parser.h"
+
+#include <mutex>            // std::mutex, std::lock_guard
+
+// Declare yyparse: required for yacc under Ubuntu 12.x (at least)
+extern int yyparse();
+
+extern void InitScanner( const std::string* pSrc_i );  // Lex initialization.
+
+// -----------------------------------------------------------------------------
+
+// PARSING BUFFERS
+
+// -----------------------------------------------------------------------------
+
+namespace escrido
+{
+  CDocumentation* pParseDocumentation = NULL;   ///< The documentation that is parsed into (only set while parsing).
+  bool fParseOutput = true;                     ///< Flag whether new pages are reported on the console (while parsing).
+  CContentUnit oParseContUnit;                  ///< Content unit that is written to while parsing.
+}
+
+namespace
+{
+  std::mutex oParseMutex;                       ///< Serializes the use of the (non-reentrant) scanner and parser.
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS IMPLEMENTATION
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Parses the content of an input file into a documentation.
+///
+/// \details    The flex scanner and the bison parser work on global state.
+///             Calls from different threads are therefore serialized, so
+///             several documentations can be parsed independently.
+///
+/// \param[in]  sData_i
+///             The file content.
+/// \param[in,out] oDocumentation_io
+///             The documentation the pages and content units are appended to.
+/// \param[in]  fOutput_i
+///             Flag whether new pages are reported on the console.
+///
+/// \return     'true' on success, 'false' if there were syntax errors.
+// *****************************************************************************
+
+bool escrido::ParseDocumentation( const std::string& sData_i, CDocumentation& oDocumentation_io,
+                                  bool fOutput_i )
+{
+  std::lock_guard<std::mutex> oLock( oParseMutex );
+
+  pParseDocumentation = &oDocumentation_io;
+  fParseOutput = fOutput_i;
+  InitScanner( &sData_i );
+  const int nResult = yyparse();
+  pParseDocumentation = NULL;
+
+  return nResult == 0;
+}
@@ -0,0 +1,33 @@
+#ifndef DOC_PARSER_ALLREADY_READ_IN
+#define DOC_PARSER_ALLREADY_READ_IN
+
+// -----------------------------------------------------------------------------
+/// \file       doc-parser.h
+///
+/// \brief      Module header for the entry point of the flex/bison
+///             documentation parser.
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+
+#include "escrido-doc.h"
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+namespace escrido
+{
+  bool ParseDocumentation( const std::string& sData_i, CDocumentation& oDocumentation_io,
+                           bool fOutput_i = true );
+}
+
+#endif /* DOC_PARSER_ALLREADY_READ_IN */
@@ -10,23 +10,60 @@
 // -----------------------------------------------------------------------------
 
 #include "escrido-doc.h"
+#include "stats.h"       // oRunStats, CPhaseTimer, CTraceSpan
 
 #include <cstring>       // strlen
-#include <sstream>       // std::stringstream, std::stringbuf
 #include <fstream>       // std::ifstream, std::ofstream
 #include <iostream>      // std::cout, std::cin, std::cerr, std::endl
 #include <cctype>        // tolower, toupper
-#include <algorithm>     // std::sort
+#include <algorithm>     // std::sort, std::find
 #include <unordered_set> // std::unordered_set
 
 // -----------------------------------------------------------------------------
 
+// LOCAL FUNCTIONS
+
+// -----------------------------------------------------------------------------
+
+namespace
+{
+  /// Returns the first position of a headline span that is not a blank.
+  const char* SkipHeadlineBlanks( const char* pPos_i, const char* pEnd_i )
+  {
+    while( pPos_i != pEnd_i && ( *pPos_i == ' ' || *pPos_i == '\t' ) )
+      ++pPos_i;
+    return pPos_i;
+  }
+
+  /// Returns the first position of a headline span that is a blank.
+  const char* FindHeadlineBlank( const char* pPos_i, const char* pEnd_i )
+  {
+    while( pPos_i != pEnd_i && *pPos_i != ' ' && *pPos_i != '\t' )
+      ++pPos_i;
+    return pPos_i;
+  }
+
+  /// Appends a headline span to a text (tabs become blanks).
+  void AppendHeadlineText( const char* pPos_i, const char* pEnd_i, std::string& sText_io )
+  {
+    const size_t nStart = sText_io.size();
+    sText_io.append( pPos_i, pEnd_i );
+    for( size_t c = nStart; c < sText_io.size(); ++c )
+      if( sText_io[c] == '\t' )
+        sText_io[c] = ' ';
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 // CLASS CGroupNode
 
 // -----------------------------------------------------------------------------
 
 escrido::CGroupNode::CGroupNode( const std::string& sGroupName_i ):
-  sGroupName ( sGroupName_i )
+  sGroupName ( sGroupName_i ),
+  nGroupName ( symbol::NONE ),
+  nFlatIdx   ( std::string::npos )
 {}
 
 // .............................................................................
@@ -38,22 +75,29 @@ escrido::CGroupNode::~CGroupNode()
 
 // .............................................................................
 
-escrido::CGroupNode* escrido::CGroupNode::AddChildGroup( const std::string& sGroupName_i )
+escrido::CGroupNode* escrido::CGroupNode::AddChildGroup( const std::string& sGroupName_i, CSymbolTable& oSymbolTable_io )
 {
   CGroupNode* pNewSubGroup = new CGroupNode( sGroupName_i );
 
+  pNewSubGroup->nGroupName = oSymbolTable_io.Intern( sGroupName_i );
+
   apChildNodeList.push_back( pNewSubGroup );
+  oChildNodeMap[pNewSubGroup->nGroupName] = pNewSubGroup;
 
   return pNewSubGroup;
 }
 
 // .............................................................................
 
-escrido::CGroupNode* escrido::CGroupNode::GetChildGroup( const std::string& sGroupName_i ) const
+escrido::CGroupNode* escrido::CGroupNode::GetChildGroup( const std::string& sGroupName_i, const CSymbolTable& oSymbolTable_i ) const
 {
-  for( size_t g = 0; g < apChildNodeList.size(); ++g )
-    if( apChildNodeList[g]->sGroupName == sGroupName_i )
-      return apChildNodeList[g];
+  symbol_id nGroupName;
+  if( !oSymbolTable_i.Find( sGroupName_i, nGroupName ) )
+    return NULL;
+
+  std::unordered_map <symbol_id, CGroupNode*>::const_iterator iChild = oChildNodeMap.find( nGroupName );
+  if( iChild != oChildNodeMap.end() )
+    return iChild->second;
 
   return NULL;
 }
@@ -66,6 +110,9 @@ void escrido::CGroupNode::Clear()
     delete apChildNodeList[g];
 
   apChildNodeList.resize( 0 );
+  oChildNodeMap.clear();
+  naDocPageIdxList.clear();
+  aoPageTypeBucketList.clear();
 }
 
 // .............................................................................
@@ -82,7 +129,8 @@ void escrido::CGroupNode::Clear()
 // *****************************************************************************
 
 void escrido::CGroupNode::Order( const std::vector <CDocPage*>& apDocPageList_i,
-                                 const std::vector <std::string>& asRefList_i )
+                                 const std::vector <std::string>& asRefList_i,
+                                 const CSymbolTable& oSymbolTable_i )
 {
   // An object for alphanumeric sorting.
   struct SSortObj
@@ -116,19 +164,28 @@ void escrido::CGroupNode::Order( const std::vector <CDocPage*>& apDocPageList_i,
     };
   };
 
+  // The reference list as symbols. (References that are not interned do not
+  // match any page or group.)
+  std::vector <symbol_id> anRefList;
+  for( size_t r = 0; r < asRefList_i.size(); ++r )
+  {
+    symbol_id nRef;
+    anRefList.push_back( oSymbolTable_i.Find( asRefList_i[r], nRef ) ? nRef : symbol::NONE );
+  }
+
   // Step 1: order doc pages inside by the @order tags.
   {
     // Create a new doc page list
     std::vector<size_t> anNewDocPageIdxList;
 
     // Step 1.1: loop over reference list
-    for( size_t r = 0; r < asRefList_i.size(); ++r )
+    for( size_t r = 0; r < anRefList.size(); ++r )
     {
-      const std::string& sRef = asRefList_i[r];
+      const symbol_id nRef = anRefList[r];
 
       // Check if the reference occurs within the original list of doc pages.
       for( size_t p = 0; p < this->naDocPageIdxList.size(); ++p )
-        if( apDocPageList_i[this->naDocPageIdxList[p]]->GetIdent() == sRef )
+        if( apDocPageList_i[this->naDocPageIdxList[p]]->GetIdentSym() == nRef )
         {
           // Add doc page index to new doc page list.
           anNewDocPageIdxList.push_back( this->naDocPageIdxList[p] );
@@ -167,13 +224,13 @@ void escrido::CGroupNode::Order( const std::vector <CDocPage*>& apDocPageList_i,
     std::vector<CGroupNode*> anNewChildNodeList;
 
     // Step 2.1: loop over reference list
-    for( size_t r = 0; r < asRefList_i.size(); ++r )
+    for( size_t r = 0; r < anRefList.size(); ++r )
     {
-      const std::string& sRef = asRefList_i[r];
+      const symbol_id nRef = anRefList[r];
 
       // Check if the reference occurs within the original list of children.
       for( size_t c = 0; c < this->apChildNodeList.size(); ++c )
-        if( this->apChildNodeList[c]->sGroupName == sRef )
+        if( this->apChildNodeList[c]->nGroupName == nRef )
         {
           // Add subgroup to new child node list.
           anNewChildNodeList.push_back( this->apChildNodeList[c] );
@@ -208,7 +265,64 @@ void escrido::CGroupNode::Order( const std::vector <CDocPage*>& apDocPageList_i,
 
   // Step 3: apply to all children.
   for( size_t c = 0; c < this->apChildNodeList.size(); ++c )
-    this->apChildNodeList[c]->Order( apDocPageList_i, asRefList_i );
+    this->apChildNodeList[c]->Order( apDocPageList_i, asRefList_i, oSymbolTable_i );
+}
+
+// .............................................................................
+
+/// Returns the pages of the group sorted into page types (see
+/// FillPageTypeBuckets()).
+const std::vector <escrido::CGroupNode::SPageTypeBucket>& escrido::CGroupNode::GetPageTypeBuckets() const
+{
+  return aoPageTypeBucketList;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Sorts the pages of the group into page type buckets in
+///             navigation order.
+///
+/// \details    The buckets of "mainpage" and "page" come first, followed by
+///             the other page types in order of their first appearance. Within
+///             a bucket the pages keep their order. Empty buckets are omitted.
+// *****************************************************************************
+
+void escrido::CGroupNode::FillPageTypeBuckets( const std::vector <CDocPage*>& apDocPageList_i )
+{
+  aoPageTypeBucketList.clear();
+
+  // Reserve the first positions for "mainpage" and "page".
+  std::unordered_map <symbol_id, size_t> oBucketIdxMap;
+  oBucketIdxMap[symbol::MAINPAGE] = 0;
+  oBucketIdxMap[symbol::PAGE] = 1;
+  aoPageTypeBucketList.resize( 2 );
+  aoPageTypeBucketList[0].nPageTypeID = symbol::MAINPAGE;
+  aoPageTypeBucketList[1].nPageTypeID = symbol::PAGE;
+
+  for( size_t p = 0; p < naDocPageIdxList.size(); ++p )
+  {
+    const CDocPage* pPage = apDocPageList_i[naDocPageIdxList[p]];
+
+    // Find or add the bucket of the page type.
+    std::pair<std::unordered_map <symbol_id, size_t>::iterator, bool> oInsert =
+      oBucketIdxMap.insert( std::make_pair( pPage->GetPageTypeSym(), aoPageTypeBucketList.size() ) );
+    if( oInsert.second )
+    {
+      aoPageTypeBucketList.emplace_back();
+      aoPageTypeBucketList.back().nPageTypeID = pPage->GetPageTypeSym();
+    }
+
+    SPageTypeBucket& oBucket = aoPageTypeBucketList[oInsert.first->second];
+    if( oBucket.anDocPageIdxList.empty() )
+      oBucket.sPageTypeLit = pPage->GetPageTypeLit();
+    oBucket.anDocPageIdxList.push_back( naDocPageIdxList[p] );
+  }
+
+  // Remove empty buckets ("mainpage" or "page" may not occur).
+  for( size_t b = aoPageTypeBucketList.size(); b > 0; --b )
+    if( aoPageTypeBucketList[b-1].anDocPageIdxList.empty() )
+      aoPageTypeBucketList.erase( aoPageTypeBucketList.begin() + ( b - 1 ) );
 }
 
 // -----------------------------------------------------------------------------
@@ -230,7 +344,7 @@ escrido::CGroupTree::CGroupTree( const std::vector <CDocPage*>& apDocPageList_i
 ///             doc pages list.
 // *****************************************************************************
 
-void escrido::CGroupTree::Update()
+void escrido::CGroupTree::Update( CSymbolTable& oSymbolTable_io )
 {
   this->Clear();
 
@@ -251,9 +365,9 @@ void escrido::CGroupTree::Update()
       const std::string& sGroupName = asDocPageGroupNames[g];
 
       // Find or create subgroup as child of the current node.
-      CGroupNode* pSubGroup = pGroupNode->GetChildGroup( sGroupName );
+      CGroupNode* pSubGroup = pGroupNode->GetChildGroup( sGroupName, oSymbolTable_io );
       if( pSubGroup == NULL )
-        pSubGroup = pGroupNode->AddChildGroup( sGroupName );
+        pSubGroup = pGroupNode->AddChildGroup( sGroupName, oSymbolTable_io );
 
       // Proceed with subgroup.
       pGroupNode = pSubGroup;
@@ -262,6 +376,8 @@ void escrido::CGroupTree::Update()
     // Add the doc page index to the terminal (sub-)group
     pGroupNode->naDocPageIdxList.push_back( f );
   }
+
+  this->Flatten();
 }
 
 // .............................................................................
@@ -270,13 +386,16 @@ void escrido::CGroupTree::Clear()
 {
   oRoot.Clear();
   this->nMaxLvl = 0;
+  this->aoFlatList.clear();
 }
 
 // .............................................................................
 
-void escrido::CGroupTree::Order( const std::vector <std::string>& asRefList_i )
+void escrido::CGroupTree::Order( const std::vector <std::string>& asRefList_i, const CSymbolTable& oSymbolTable_i )
 {
-  oRoot.Order( apDocPageList, asRefList_i );
+  oRoot.Order( apDocPageList, asRefList_i, oSymbolTable_i );
+
+  this->Flatten();
 }
 
 // .............................................................................
@@ -290,65 +409,50 @@ const escrido::CGroupNode* escrido::CGroupTree::FirstGroupNode( size_t& nLvl_o )
 
 // .............................................................................
 
+// *****************************************************************************
+/// \brief      Returns the group node following a given one in pre-order (depth
+///             first) and its nesting level, or NULL after the last node.
+// *****************************************************************************
+
 const escrido::CGroupNode* escrido::CGroupTree::NextGroupNode( const CGroupNode* pLast_i,
                                                                size_t& nLvl_o ) const
 {
-  // A search stack element
-  struct SNode
-  {
-    const size_t nLvl;
-    const CGroupNode* pNode;
+  const size_t nLastIdx = this->GetFlatIdx( pLast_i );
+  if( nLastIdx == std::string::npos || nLastIdx + 1 >= aoFlatList.size() )
+    return NULL;
 
-    SNode( size_t nLvl_i, const CGroupNode* pNode_i ):
-      nLvl  ( nLvl_i ),
-      pNode ( pNode_i )
-      {};
-  };
+  const size_t nIdx = nLastIdx + 1;
 
-  // A search stack for looping over the tree.
-  // Initialize with root node.
-  std::vector <SNode> apStack;
-  apStack.emplace_back( 0, &oRoot );
+  nLvl_o = aoFlatList[nIdx].nLvl;
+  return aoFlatList[nIdx].pNode;
+}
 
-  // Walk over tree.
-  while( !apStack.empty() )
-  {
-    // Pop last node
-    const CGroupNode* pNode = apStack.back().pNode;
-    size_t nLvl = apStack.back().nLvl;
-    apStack.pop_back();
+// .............................................................................
 
-    // Search for the given node:
-    if( pNode == pLast_i )
-    {
-      if( pNode->apChildNodeList.empty() )
-      {
-        if( apStack.empty() )
-        {
-          // Return NULL, signaling that no further element proceeds.
-          return NULL;
-        }
-        else
-        {
-          // Return next element in stack.
-          nLvl_o = apStack.back().nLvl;
-          return apStack.back().pNode;
-        }
-      }
-      else
-      {
-        // Return first child.
-        nLvl_o = nLvl + 1;
-        return pNode->apChildNodeList.front();
-      }
-    }
+// *****************************************************************************
+/// \brief      Returns the flattened group list, i.e. all group nodes in
+///             pre-order (depth first, the root first) with their nesting
+///             levels, parents and subtree ranges.
+///
+/// \details    The list is rebuilt by Update() and Order(), so looping over
+///             it is the cheap way of traversing the tree.
+// *****************************************************************************
 
-    // Add all children back-to-front to the stack (i.e. depth first looping).
-    for( size_t c = pNode->apChildNodeList.size(); c > 0; --c )
-      apStack.emplace_back( nLvl + 1, pNode->apChildNodeList[c-1] );
-  }
+const std::vector <escrido::CGroupTree::SFlatNode>& escrido::CGroupTree::GetFlatList() const
+{
+  return aoFlatList;
+}
 
-  return NULL;
+// .............................................................................
+
+/// Returns the index of a group node in the flattened group list (npos if
+/// the node does not belong to the tree).
+size_t escrido::CGroupTree::GetFlatIdx( const CGroupNode* pGroup_i ) const
+{
+  const size_t nIdx = pGroup_i->nFlatIdx;
+  if( nIdx < aoFlatList.size() && aoFlatList[nIdx].pNode == pGroup_i )
+    return nIdx;
+  return std::string::npos;
 }
 
 // .............................................................................
@@ -362,49 +466,77 @@ size_t escrido::CGroupTree::MaxLvl() const
 
 std::vector<std::string> escrido::CGroupTree::GetGroupNames( const CGroupNode* pGroup_i ) const
 {
-  // A search stack element
-  struct SNode
+  // String list for the function result.
+  std::vector<std::string> oResult;
+
+  size_t nIdx = this->GetFlatIdx( pGroup_i );
+  if( nIdx == std::string::npos )
+    return oResult;
+
+  // Walk up to the root (whose name is not part of the list).
+  oResult.resize( aoFlatList[nIdx].nLvl );
+  while( aoFlatList[nIdx].nLvl > 0 )
   {
-    const size_t nLvl;
-    const CGroupNode* pNode;
+    oResult[aoFlatList[nIdx].nLvl - 1] = aoFlatList[nIdx].pNode->sGroupName;
+    nIdx = aoFlatList[nIdx].nParentIdx;
+  }
 
-    SNode( size_t nLvl_i, const CGroupNode* pNode_i ):
-      nLvl  ( nLvl_i ),
-      pNode ( pNode_i )
-      {};
-  };
+  return oResult;
+}
 
-  // String list for the function result.
-  std::vector<std::string> oResult;
+// .............................................................................
 
-  // A search stack for looping over the tree.
-  // Initialize with root node.
-  std::vector <SNode> apStack;
-  apStack.emplace_back( 0, &oRoot );
+// *****************************************************************************
+/// \brief      Builds the flattened group list (see GetFlatList()) and the
+///             page type buckets of the nodes from the current state of the
+///             tree.
+// *****************************************************************************
 
-  // Walk over tree.
-  while( !apStack.empty() )
+void escrido::CGroupTree::Flatten()
+{
+  aoFlatList.clear();
+
+  // A search stack element: a node and the list index of its parent.
+  struct SNode
   {
-    // Pop last node
-    const CGroupNode* pNode = apStack.back().pNode;
-    size_t nLvl = apStack.back().nLvl;
-    apStack.pop_back();
+    CGroupNode* pNode;
+    size_t nParentIdx;
+  };
 
-    // Delete all names in the output string list up to this level.
-    oResult.resize( nLvl );
-    if( nLvl > 0 )
-      oResult[nLvl - 1] = pNode->sGroupName;
+  std::vector <SNode> aoStack;
+  aoStack.push_back( { &oRoot, std::string::npos } );
 
-    // Search for the given node:
-    if( pNode == pGroup_i )
-      return oResult;
+  // Walk over tree.
+  while( !aoStack.empty() )
+  {
+    const SNode oNode = aoStack.back();
+    aoStack.pop_back();
+
+    // Append the node.
+    SFlatNode oFlatNode;
+    oFlatNode.pNode = oNode.pNode;
+    oFlatNode.nLvl = ( oNode.nParentIdx == std::string::npos ? 0 : aoFlatList[oNode.nParentIdx].nLvl + 1 );
+    oFlatNode.nParentIdx = oNode.nParentIdx;
+    oFlatNode.nSubtreeEnd = 0;
+    oNode.pNode->nFlatIdx = aoFlatList.size();
+    aoFlatList.push_back( oFlatNode );
+    oNode.pNode->FillPageTypeBuckets( apDocPageList );
 
     // Add all children back-to-front to the stack (i.e. depth first looping).
-    for( size_t c = pNode->apChildNodeList.size(); c > 0; --c )
-      apStack.emplace_back( nLvl + 1, pNode->apChildNodeList[c-1] );
+    for( size_t c = oNode.pNode->apChildNodeList.size(); c > 0; --c )
+      aoStack.push_back( { oNode.pNode->apChildNodeList[c-1], oNode.pNode->nFlatIdx } );
   }
 
-  return oResult;
+  // Determine the subtree ranges (children come behind their parents).
+  for( size_t g = aoFlatList.size(); g > 0; --g )
+  {
+    SFlatNode& oFlatNode = aoFlatList[g-1];
+    if( oFlatNode.nSubtreeEnd == 0 )
+      oFlatNode.nSubtreeEnd = g;
+    if( oFlatNode.nParentIdx != std::string::npos &&
+        aoFlatList[oFlatNode.nParentIdx].nSubtreeEnd < oFlatNode.nSubtreeEnd )
+      aoFlatList[oFlatNode.nParentIdx].nSubtreeEnd = oFlatNode.nSubtreeEnd;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -446,19 +578,26 @@ void escrido::CParamList::AppendParam( const CParam& oParam_i )
 escrido::CDocPage::CDocPage() :
   sPageTypeLit ( "page" ),
   sPageTypeID  ( "page" ),
-  fState       ( headline_parse_state::START )
+  nPageTypeID  ( symbol::NONE ),
+  nIdent       ( symbol::NONE )
 {}
 
 // .............................................................................
 
 escrido::CDocPage::CDocPage( const char* szPageTypeLit_i,
                              const char* szPageTypeID_i,
-                             const char* szIdent_i,
-                             headline_parse_state fState_i ) :
+                             const char* szIdent_i ) :
   sPageTypeLit ( szPageTypeLit_i ),
   sPageTypeID  ( szPageTypeID_i ),
   sIdent       ( szIdent_i ),
-  fState       ( fState_i )
+  nPageTypeID  ( symbol::NONE ),
+  nIdent       ( symbol::NONE )
+{}
+
+// .............................................................................
+
+/// Destructs the page (pages are deleted through base class pointers).
+escrido::CDocPage::~CDocPage()
 {}
 
 // .............................................................................
@@ -474,62 +613,40 @@ void escrido::CDocPage::AppendContentUnit( const CContentUnit& oContUnit_i )
 
 // .............................................................................
 
-void escrido::CDocPage::AppendHeadlineChar( const char cIdentChar_i )
-{
-  // Parse the page headline. Typically it is one identifier word followed by
-  // multiple words of the page title.
-  switch( fState )
-  {
-    case headline_parse_state::START:
-      if( cIdentChar_i == ' ' || cIdentChar_i == '\t' )
-        return;
-      else
-      {
-        fState = headline_parse_state::IDENTIFIER;
-        sIdent.push_back( cIdentChar_i );
-        return;
-      }
+// *****************************************************************************
+/// \brief      Parses the page headline, i.e. the text following the page tag
+///             up to the end of the line.
+///
+/// \details    The headline is one identifier word followed by multiple words
+///             of the page title.
+///
+/// \param[in]  pHeadline_i
+///             Start of the headline.
+/// \param[in]  nLen_i
+///             Length of the headline.
+// *****************************************************************************
 
-    case headline_parse_state::IDENTIFIER:
-      if( cIdentChar_i == ' ' || cIdentChar_i == '\t' )
-      {
-        fState = headline_parse_state::POST_IDENT;
-        return;
-      }
-      else
-      {
-        sIdent.push_back( cIdentChar_i );
-        return;
-      }
+void escrido::CDocPage::ParseHeadline( const char* pHeadline_i, size_t nLen_i )
+{
+  const char* pEnd = pHeadline_i + nLen_i;
 
-    case headline_parse_state::POST_IDENT:
-    {
-      if( cIdentChar_i == ' ' || cIdentChar_i == '\t' )
-        return;
-      else
-      {
-        fState = headline_parse_state::TITLE;
-        sTitle.push_back( cIdentChar_i );
-        return;
-      }
-    }
+  const char* pIdent = SkipHeadlineBlanks( pHeadline_i, pEnd );
+  const char* pIdentEnd = FindHeadlineBlank( pIdent, pEnd );
+  sIdent.append( pIdent, pIdentEnd );
 
-    case headline_parse_state::TITLE:
-      sTitle.push_back( cIdentChar_i );
-      return;
-  }
+  AppendHeadlineText( SkipHeadlineBlanks( pIdentEnd, pEnd ), pEnd, sTitle );
 }
 
 // .............................................................................
 
-const std::string escrido::CDocPage::GetPageTypeLit() const
+const std::string& escrido::CDocPage::GetPageTypeLit() const
 {
   return sPageTypeLit;
 }
 
 // .............................................................................
 
-const std::string escrido::CDocPage::GetPageTypeID() const
+const std::string& escrido::CDocPage::GetPageTypeID() const
 {
   return sPageTypeID;
 }
@@ -543,6 +660,39 @@ const std::string& escrido::CDocPage::GetIdent() const
 
 // .............................................................................
 
+/// Returns the page type identifier as symbol (see InternSymbols()).
+escrido::symbol_id escrido::CDocPage::GetPageTypeSym() const
+{
+  return nPageTypeID;
+}
+
+// .............................................................................
+
+/// Returns the page identifier as symbol (see InternSymbols()).
+escrido::symbol_id escrido::CDocPage::GetIdentSym() const
+{
+  return nIdent;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Interns the page type identifier and the page identifier into
+///             the symbol table of the documentation.
+///
+/// \details    This is done once the headline is complete, i.e. on closing
+///             the page while parsing (see CDocumentation::CloseDocPage()).
+///             Until then both symbols are symbol::NONE.
+// *****************************************************************************
+
+void escrido::CDocPage::InternSymbols( CSymbolTable& oSymbolTable_io )
+{
+  nPageTypeID = oSymbolTable_io.Intern( sPageTypeID );
+  nIdent = oSymbolTable_io.Intern( sIdent );
+}
+
+// .............................................................................
+
 const std::string& escrido::CDocPage::GetTitle() const
 {
   return sTitle;
@@ -570,7 +720,7 @@ const std::string escrido::CDocPage::GetBrief() const
 const std::string escrido::CDocPage::GetNamespace() const
 {
   if( this->oContUnit.HasTagBlock( tag_type::NAMESPACE ) )
-    return this->oContUnit.GetFirstTagBlock( tag_type::NAMESPACE )->GetPlainFirstWord();
+    return this->oContUnit.GetFirstTagBlock( tag_type::NAMESPACE )->GetPlainFirstWordView().str();
   else
     return std::string();
 }
@@ -580,22 +730,20 @@ const std::string escrido::CDocPage::GetNamespace() const
 const std::vector <std::string> escrido::CDocPage::GetLabelNames() const
 {
   std::vector <std::string> asResult;
-  std::vector <std::string> asTokens;
+
+  // (The line buffer and the token list are reused for all label blocks.)
+  std::vector <strview::CStrView> asTokens;
   std::string sLine;
 
-  if( this->oContUnit.HasTagBlock( tag_type::LABEL ) )
+  const CTagBlock* oTagBlock = this->oContUnit.GetFirstTagBlock( tag_type::LABEL );
+  while( oTagBlock != NULL )
   {
-    const CTagBlock* oTagBlock = this->oContUnit.GetFirstTagBlock( tag_type::LABEL );
-    sLine = oTagBlock->GetPlainTitleLine();
-    if( Tokenize( sLine, ",", asTokens ) )
-      asResult.insert( asResult.end(), asTokens.begin(), asTokens.end() );
+    oTagBlock->GetPlainTitleLine( sLine );
+    Tokenize( sLine, ",", asTokens );
+    for( size_t t = 0; t < asTokens.size(); t++ )
+      asResult.emplace_back( asTokens[t].data(), asTokens[t].size() );
 
-    while( ( oTagBlock = this->oContUnit.GetNextTagBlock( oTagBlock, tag_type::LABEL ) ) != NULL )
-    {
-      sLine = oTagBlock->GetPlainTitleLine();
-      if( Tokenize( sLine, ",", asTokens ) )
-        asResult.insert( asResult.end(), asTokens.begin(), asTokens.end() );
-    }
+    oTagBlock = this->oContUnit.GetNextTagBlock( oTagBlock, tag_type::LABEL );
   }
 
   return asResult;
@@ -653,10 +801,10 @@ const std::string escrido::CDocPage::GetClearTextBrief( const SWriteInfo& oWrite
   {
     const CTagBlock& oBriefTagBlock = *(this->oContUnit.GetFirstTagBlock( tag_type::BRIEF ));
 
-    std::ostringstream oSStream;
-    oBriefTagBlock.WriteHTML( oSStream, oWriteInfo_i );
+    outbuf::COutBuffer oOutBuf;
+    oBriefTagBlock.WriteHTML( oOutBuf, oWriteInfo_i );
 
-    return ConvertHTML2ClearText( oSStream.str() );
+    return ConvertHTML2ClearText( oOutBuf.str() );
   }
   else
     return std::string();
@@ -685,7 +833,7 @@ const std::string escrido::CDocPage::GetClearTextContent( const SWriteInfo& oWri
   std::vector <bool> afTagBlockDone( this->oContUnit.GetTagBlockN(), false );
 
   // String content
-  std::string sContent;
+  outbuf::COutBuffer oContent;
 
   // First add all "real" text content.
   for( size_t t = 0; t < this->oContUnit.GetTagBlockN(); ++t )
@@ -705,9 +853,7 @@ const std::string escrido::CDocPage::GetClearTextContent( const SWriteInfo& oWri
         fTagType == tag_type::SUBSUBSECTION )
     {
       // Write HTML to string
-      std::ostringstream oSStream;
-      oTagBlock.WriteHTML( oSStream, oWriteInfo_i );
-      sContent += oSStream.str();
+      oTagBlock.WriteHTML( oContent, oWriteInfo_i );
 
       // Tag block as done.
       afTagBlockDone[t] = true;
@@ -727,13 +873,11 @@ const std::string escrido::CDocPage::GetClearTextContent( const SWriteInfo& oWri
       const CTagBlock& oTagBlock = this->oContUnit.GetTagBlock( t );
 
       // Write HTML to string
-      std::ostringstream oSStream;
-      oTagBlock.WriteHTML( oSStream, oWriteInfo_i );
-      sContent += oSStream.str();
+      oTagBlock.WriteHTML( oContent, oWriteInfo_i );
     }
 
   // Convert to clear text and return.
-  return ConvertHTML2ClearText( sContent );
+  return ConvertHTML2ClearText( oContent.str() );
 }
 
 // .............................................................................
@@ -749,34 +893,34 @@ const std::string escrido::CDocPage::GetURL( const std::string& sOutputPostfix_i
 /// \brief      Writes HTML output of meta data such as AUTHOR, DATE etc.
 // *****************************************************************************
 
-void escrido::CDocPage::WriteHTMLMetaDataList( std::ostream& oOutStrm_i,
+void escrido::CDocPage::WriteHTMLMetaDataList( outbuf::COutBuffer& oOutBuf_i,
                                                const SWriteInfo& oWriteInfo_i ) const
 {
   // Start description list.
-  WriteHTMLTagLine( "<dl>", oOutStrm_i, oWriteInfo_i++ );
+  WriteHTMLTagLine( "<dl>", oOutBuf_i, oWriteInfo_i++ );
 
   // Author:
   if( oContUnit.HasTagBlock( tag_type::AUTHOR ) )
   {
     const std::string sTagLine = std::string( "<dt class=\"author\">" ) +
-                                 oWriteInfo_i.Label( "Author" ) + "</dt>";
+                                 oWriteInfo_i.Label( label_type::AUTHOR ) + "</dt>";
 
-    WriteHTMLTagLine( sTagLine, oOutStrm_i, oWriteInfo_i );
-    WriteHTMLTagLine( "<dd>", oOutStrm_i, oWriteInfo_i++ );
-    oContUnit.GetFirstTagBlock( tag_type::AUTHOR )->WriteHTML( oOutStrm_i, oWriteInfo_i );
-    WriteHTMLTagLine( "</dd>", oOutStrm_i, --oWriteInfo_i );
+    WriteHTMLTagLine( sTagLine, oOutBuf_i, oWriteInfo_i );
+    WriteHTMLTagLine( "<dd>", oOutBuf_i, oWriteInfo_i++ );
+    oContUnit.GetFirstTagBlock( tag_type::AUTHOR )->WriteHTML( oOutBuf_i, oWriteInfo_i );
+    WriteHTMLTagLine( "</dd>", oOutBuf_i, --oWriteInfo_i );
   }
 
   // Date:
   if( oContUnit.HasTagBlock( tag_type::DATE ) )
   {
     const std::string sTagLine = std::string( "<dt class=\"date\">" ) +
-                                 oWriteInfo_i.Label( "Date" ) + "</dt>";
+                                 oWriteInfo_i.Label( label_type::DATE ) + "</dt>";
 
-    WriteHTMLTagLine( sTagLine, oOutStrm_i, oWriteInfo_i );
-    WriteHTMLTagLine( "<dd>", oOutStrm_i, oWriteInfo_i++ );
-    oContUnit.GetFirstTagBlock( tag_type::DATE )->WriteHTML( oOutStrm_i, oWriteInfo_i );
-    WriteHTMLTagLine( "</dd>", oOutStrm_i, --oWriteInfo_i );
+    WriteHTMLTagLine( sTagLine, oOutBuf_i, oWriteInfo_i );
+    WriteHTMLTagLine( "<dd>", oOutBuf_i, oWriteInfo_i++ );
+    oContUnit.GetFirstTagBlock( tag_type::DATE )->WriteHTML( oOutBuf_i, oWriteInfo_i );
+    WriteHTMLTagLine( "</dd>", oOutBuf_i, --oWriteInfo_i );
   }
   else
   {
@@ -788,28 +932,28 @@ void escrido::CDocPage::WriteHTMLMetaDataList( std::ostream& oOutStrm_i,
   if( oContUnit.HasTagBlock( tag_type::VERSION ) )
   {
     const std::string sTagLine = std::string( "<dt class=\"version\">" ) +
-                                 oWriteInfo_i.Label( "Version" ) + "</dt>";
+                                 oWriteInfo_i.Label( label_type::VERSION ) + "</dt>";
 
-    WriteHTMLTagLine( sTagLine, oOutStrm_i, oWriteInfo_i );
-    WriteHTMLTagLine( "<dd>", oOutStrm_i, oWriteInfo_i++ );
-    oContUnit.GetFirstTagBlock( tag_type::VERSION )->WriteHTML( oOutStrm_i, oWriteInfo_i );
-    WriteHTMLTagLine( "</dd>", oOutStrm_i, --oWriteInfo_i );
+    WriteHTMLTagLine( sTagLine, oOutBuf_i, oWriteInfo_i );
+    WriteHTMLTagLine( "<dd>", oOutBuf_i, oWriteInfo_i++ );
+    oContUnit.GetFirstTagBlock( tag_type::VERSION )->WriteHTML( oOutBuf_i, oWriteInfo_i );
+    WriteHTMLTagLine( "</dd>", oOutBuf_i, --oWriteInfo_i );
   }
 
   // Copyright:
   if( oContUnit.HasTagBlock( tag_type::COPYRIGHT ) )
   {
     const std::string sTagLine = std::string( "<dt class=\"copyright\">" ) +
-                                 oWriteInfo_i.Label( "Copyright" ) + "</dt>";
+                                 oWriteInfo_i.Label( label_type::COPYRIGHT ) + "</dt>";
 
-    WriteHTMLTagLine( sTagLine, oOutStrm_i, oWriteInfo_i );
-    WriteHTMLTagLine( "<dd>", oOutStrm_i, oWriteInfo_i++ );
-    oContUnit.GetFirstTagBlock( tag_type::COPYRIGHT )->WriteHTML( oOutStrm_i, oWriteInfo_i );
-    WriteHTMLTagLine( "</dd>", oOutStrm_i, --oWriteInfo_i );
+    WriteHTMLTagLine( sTagLine, oOutBuf_i, oWriteInfo_i );
+    WriteHTMLTagLine( "<dd>", oOutBuf_i, oWriteInfo_i++ );
+    oContUnit.GetFirstTagBlock( tag_type::COPYRIGHT )->WriteHTML( oOutBuf_i, oWriteInfo_i );
+    WriteHTMLTagLine( "</dd>", oOutBuf_i, --oWriteInfo_i );
   }
 
   // End description list.
-  WriteHTMLTagLine( "</dl>", oOutStrm_i, --oWriteInfo_i );
+  WriteHTMLTagLine( "</dl>", oOutBuf_i, --oWriteInfo_i );
 }
 
 // .............................................................................
@@ -818,9 +962,9 @@ void escrido::CDocPage::WriteHTMLMetaDataList( std::ostream& oOutStrm_i,
 /// \brief      Writes HTML output of page headline.
 // *****************************************************************************
 
-void escrido::CDocPage::WriteHTMLHeadline( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CDocPage::WriteHTMLHeadline( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h1 id=\"" << sIdent << "\">" << sTitle << "</h1>" << std::endl;
+  WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h1 id=\"" << sIdent << "\">" << sTitle << "</h1>" << '\n';
 }
 
 // .............................................................................
@@ -831,9 +975,9 @@ void escrido::CDocPage::WriteHTMLHeadline( std::ostream& oOutStrm_i, const SWrit
 ///             NOTES, OUTPUT and REMARK paragraphs in the order they appear.
 // *****************************************************************************
 
-void escrido::CDocPage::WriteHTMLParSectDet( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CDocPage::WriteHTMLParSectDet( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  oContUnit.WriteHTMLParSectDet( oOutStrm_i, oWriteInfo_i );
+  oContUnit.WriteHTMLParSectDet( oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
@@ -843,10 +987,10 @@ void escrido::CDocPage::WriteHTMLParSectDet( std::ostream& oOutStrm_i, const SWr
 // *****************************************************************************
 
 void escrido::CDocPage::WriteHTMLTagBlock( tag_type fTagType_i,
-                                           std::ostream& oOutStrm_i,
+                                           outbuf::COutBuffer& oOutBuf_i,
                                            const SWriteInfo& oWriteInfo_i ) const
 {
-  oContUnit.WriteHTMLTagBlock( fTagType_i, oOutStrm_i, oWriteInfo_i );
+  oContUnit.WriteHTMLTagBlock( fTagType_i, oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
@@ -858,10 +1002,10 @@ void escrido::CDocPage::WriteHTMLTagBlock( tag_type fTagType_i,
 
 void escrido::CDocPage::WriteHTMLTagBlock( tag_type fTagType_i,
                                            const std::string& sIdentifier_i,
-                                           std::ostream& oOutStrm_i,
+                                           outbuf::COutBuffer& oOutBuf_i,
                                            const SWriteInfo& oWriteInfo_i ) const
 {
-  oContUnit.WriteHTMLTagBlock( fTagType_i, sIdentifier_i, oOutStrm_i, oWriteInfo_i );
+  oContUnit.WriteHTMLTagBlock( fTagType_i, sIdentifier_i, oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
@@ -871,10 +1015,10 @@ void escrido::CDocPage::WriteHTMLTagBlock( tag_type fTagType_i,
 // *****************************************************************************
 
 void escrido::CDocPage::WriteHTMLTagBlockList( tag_type fTagType_i,
-                                             std::ostream& oOutStrm_i,
+                                             outbuf::COutBuffer& oOutBuf_i,
                                              const SWriteInfo& oWriteInfo_i ) const
 {
-  oContUnit.WriteHTMLTagBlockList( fTagType_i, oOutStrm_i, oWriteInfo_i );
+  oContUnit.WriteHTMLTagBlockList( fTagType_i, oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
@@ -883,10 +1027,12 @@ void escrido::CDocPage::WriteHTMLTagBlockList( tag_type fTagType_i,
 /// \brief      Writes LaTeX output of page headline.
 // *****************************************************************************
 
-void escrido::CDocPage::WriteLaTeXHeadline( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CDocPage::WriteLaTeXHeadline( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\pageheadline{" << LaTeXEscape( sTitle ) << "}" << std::endl;
-  WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "\\label{" << sIdent << "}" << std::endl;
+  WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\pageheadline{";
+  LaTeXEscape( sTitle, oOutBuf_i );
+  oOutBuf_i << "}" << '\n';
+  WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "\\label{" << sIdent << "}" << '\n';
 }
 
 // .............................................................................
@@ -897,9 +1043,9 @@ void escrido::CDocPage::WriteLaTeXHeadline( std::ostream& oOutStrm_i, const SWri
 ///             in the order they appear.
 // *****************************************************************************
 
-void escrido::CDocPage::WriteLaTeXParSectDet( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const
+void escrido::CDocPage::WriteLaTeXParSectDet( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const
 {
-  oContUnit.WriteLaTeXParSectDet( oOutStrm_i, oWriteInfo_i );
+  oContUnit.WriteLaTeXParSectDet( oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
@@ -909,10 +1055,10 @@ void escrido::CDocPage::WriteLaTeXParSectDet( std::ostream& oOutStrm_i, const SW
 // *****************************************************************************
 
 void escrido::CDocPage::WriteLaTeXTagBlock( tag_type fTagType_i,
-                                            std::ostream& oOutStrm_i,
+                                            outbuf::COutBuffer& oOutBuf_i,
                                             const SWriteInfo& oWriteInfo_i ) const
 {
-  oContUnit.WriteLaTeXTagBlock( fTagType_i, oOutStrm_i, oWriteInfo_i );
+  oContUnit.WriteLaTeXTagBlock( fTagType_i, oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
@@ -924,10 +1070,10 @@ void escrido::CDocPage::WriteLaTeXTagBlock( tag_type fTagType_i,
 
 void escrido::CDocPage::WriteLaTeXTagBlock( tag_type fTagType_i,
                                             const std::string& sIdentifier_i,
-                                            std::ostream& oOutStrm_i,
+                                            outbuf::COutBuffer& oOutBuf_i,
                                             const SWriteInfo& oWriteInfo_i ) const
 {
-  oContUnit.WriteLaTeXTagBlock( fTagType_i, sIdentifier_i, oOutStrm_i, oWriteInfo_i );
+  oContUnit.WriteLaTeXTagBlock( fTagType_i, sIdentifier_i, oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
@@ -937,52 +1083,39 @@ void escrido::CDocPage::WriteLaTeXTagBlock( tag_type fTagType_i,
 // *****************************************************************************
 
 void escrido::CDocPage::WriteLaTeXTagBlockList( tag_type fTagType_i,
-                                                std::ostream& oOutStrm_i,
+                                                outbuf::COutBuffer& oOutBuf_i,
                                                 const SWriteInfo& oWriteInfo_i ) const
 {
-  oContUnit.WriteLaTeXTagBlockList( fTagType_i, oOutStrm_i, oWriteInfo_i );
+  oContUnit.WriteLaTeXTagBlockList( fTagType_i, oOutBuf_i, oWriteInfo_i );
 }
 
 // .............................................................................
 
 void escrido::CDocPage::AddToRefTable( CRefTable& oRefTable_o, const std::string& sOutputPostfix_i ) const
 {
+  const std::string sURL = this->GetURL( sOutputPostfix_i );
+
   // Add reference to the page.
   oRefTable_o.AppendRef( sIdent,
-                         this->GetURL( sOutputPostfix_i ),
+                         sURL,
                          sTitle );
 
-  // Add reference to sections.
-  const CTagBlock* pTagBlock = oContUnit.GetFirstTagBlock( tag_type::SECTION );
-  while( pTagBlock != NULL )
-  {
-    std::string sIdent = MakeIdentifier( pTagBlock->GetPlainFirstWord() );
-    oRefTable_o.AppendRef( sIdent,
-                           this->GetURL( sOutputPostfix_i ) + "#" + sIdent,
-                           pTagBlock->GetPlainTitleLineButFirstWord() );
-    pTagBlock = oContUnit.GetNextTagBlock( pTagBlock, tag_type::SECTION );
-  }
-
-  // Add reference to subsections.
-  pTagBlock = oContUnit.GetFirstTagBlock( tag_type::SUBSECTION );
-  while( pTagBlock != NULL )
-  {
-    std::string sIdent = MakeIdentifier( pTagBlock->GetPlainFirstWord() );
-    oRefTable_o.AppendRef( sIdent,
-                           this->GetURL( sOutputPostfix_i ) + "#" + sIdent,
-                           pTagBlock->GetPlainTitleLineButFirstWord() );
-    pTagBlock = oContUnit.GetNextTagBlock( pTagBlock, tag_type::SUBSECTION );
-  }
-
-  // Add reference to subsubsections.
-  pTagBlock = oContUnit.GetFirstTagBlock( tag_type::SUBSUBSECTION );
-  while( pTagBlock != NULL )
+  // Add references to sections, subsections and subsubsections (in this
+  // order). The link and text buffers are reused for all of them.
+  const tag_type afSectionType[] = { tag_type::SECTION, tag_type::SUBSECTION, tag_type::SUBSUBSECTION };
+  std::string sLink;
+  std::string sText;
+  for( size_t s = 0; s < sizeof( afSectionType ) / sizeof( afSectionType[0] ); s++ )
   {
-    std::string sIdent = MakeIdentifier( pTagBlock->GetPlainFirstWord() );
-    oRefTable_o.AppendRef( sIdent,
-                           this->GetURL( sOutputPostfix_i ) + "#" + sIdent,
-                           pTagBlock->GetPlainTitleLineButFirstWord() );
-    pTagBlock = oContUnit.GetNextTagBlock( pTagBlock, tag_type::SUBSUBSECTION );
+    const CTagBlock* pTagBlock = oContUnit.GetFirstTagBlock( afSectionType[s] );
+    while( pTagBlock != NULL )
+    {
+      const std::string sSectionIdent = MakeIdentifier( pTagBlock->GetPlainFirstWordView() );
+      sLink.assign( sURL ).append( 1, '#' ).append( sSectionIdent );
+      pTagBlock->GetPlainTitleLineButFirstWord( sText );
+      oRefTable_o.AppendRef( sSectionIdent, sLink, sText );
+      pTagBlock = oContUnit.GetNextTagBlock( pTagBlock, afSectionType[s] );
+    }
   }
 }
 
@@ -1001,11 +1134,24 @@ void escrido::CDocPage::DebugOutput() const
 // -----------------------------------------------------------------------------
 
 escrido::CPageMainpage::CPageMainpage():
-  CDocPage( "mainpage", "mainpage", "mainpage", headline_parse_state::POST_IDENT )
+  CDocPage( "mainpage", "mainpage", "mainpage" )
 {}
 
 // .............................................................................
 
+// *****************************************************************************
+/// \brief      Parses the page headline. For the main page this is the title
+///             only.
+// *****************************************************************************
+
+void escrido::CPageMainpage::ParseHeadline( const char* pHeadline_i, size_t nLen_i )
+{
+  const char* pEnd = pHeadline_i + nLen_i;
+  AppendHeadlineText( SkipHeadlineBlanks( pHeadline_i, pEnd ), pEnd, sTitle );
+}
+
+// .............................................................................
+
 const std::string escrido::CPageMainpage::GetURL( const std::string& sOutputPostfix_i ) const
 {
   return std::string( "index" + sOutputPostfix_i );
@@ -1018,98 +1164,59 @@ const std::string escrido::CPageMainpage::GetURL( const std::string& sOutputPost
 // -----------------------------------------------------------------------------
 
 escrido::CRefPage::CRefPage():
-  CDocPage( "", "", "", headline_parse_state::START )
+  CDocPage( "", "", "" )
 {}
 
 // .............................................................................
 
-void escrido::CRefPage::AppendHeadlineChar( const char cIdentChar_i )
-{
-  // Parse the program construct headline. This is one program construct label
-  // (as "function", "data type" or "class", possibly in quotation marks), an
-  // identifier word followed by the individual name of the construct.
-  switch( fState )
-  {
-    case headline_parse_state::START:
-      if( cIdentChar_i == ' ' || cIdentChar_i == '\t' )
-        return;
-      else
-      if( cIdentChar_i == '"' )
-      {
-        fState = headline_parse_state::PAGETYPE_DQUOTED;
-        return;
-      }
-      else
-      {
-        fState = headline_parse_state::PAGETYPE;
-        sPageTypeLit.push_back( cIdentChar_i );
-        return;
-      }
-
-    case headline_parse_state::PAGETYPE:
-      if( cIdentChar_i == ' ' || cIdentChar_i == '\t' )
-      {
-        fState = headline_parse_state::POST_PAGETYPE;
-        BuildPageTypeID();
-        return;
-      }
-      else
-      {
-        sPageTypeLit.push_back( cIdentChar_i );
-        return;
-      }
-
-    case headline_parse_state::PAGETYPE_DQUOTED:
-      if( cIdentChar_i == '"' )
-      {
-        fState = headline_parse_state::POST_PAGETYPE;
-        BuildPageTypeID();
-        return;
-      }
-      else
-      {
-        sPageTypeLit.push_back( cIdentChar_i );
-        return;
-      }
+// *****************************************************************************
+/// \brief      Parses the page headline.
+///
+/// \details    The headline of a program construct is one program construct
+///             label (the page type, as "function", "data type" or "class",
+///             possibly in quotation marks), an identifier word and the
+///             individual name of the construct (the title). The page type
+///             identifier is the label with blanks replaced by underscores.
+// *****************************************************************************
 
-    case headline_parse_state::POST_PAGETYPE:
-      if( cIdentChar_i == ' ' || cIdentChar_i == '\t' )
-        return;
-      else
-      {
-        fState = headline_parse_state::IDENTIFIER;
-        sIdent.push_back( cIdentChar_i );
-        return;
-      }
+void escrido::CRefPage::ParseHeadline( const char* pHeadline_i, size_t nLen_i )
+{
+  const char* pEnd = pHeadline_i + nLen_i;
 
-    case headline_parse_state::IDENTIFIER:
-      if( cIdentChar_i == ' ' || cIdentChar_i == '\t' )
-      {
-        fState = headline_parse_state::POST_IDENT;
-        return;
-      }
-      else
-      {
-        sIdent.push_back( cIdentChar_i );
-        return;
-      }
+  const char* pPageType = SkipHeadlineBlanks( pHeadline_i, pEnd );
+  if( pPageType == pEnd )
+    return;
 
-    case headline_parse_state::POST_IDENT:
-    {
-      if( cIdentChar_i == ' ' || cIdentChar_i == '\t' )
-        return;
-      else
-      {
-        fState = headline_parse_state::TITLE;
-        sTitle.push_back( cIdentChar_i );
-        return;
-      }
-    }
+  // Find the end of the page type.
+  const bool fDQuoted = ( *pPageType == '"' );
+  const char* pPageTypeEnd;
+  if( fDQuoted )
+  {
+    ++pPageType;
+    pPageTypeEnd = pPageType;
+    while( pPageTypeEnd != pEnd && *pPageTypeEnd != '"' )
+      ++pPageTypeEnd;
+  }
+  else
+    pPageTypeEnd = FindHeadlineBlank( pPageType, pEnd );
 
-    case headline_parse_state::TITLE:
-      sTitle.push_back( cIdentChar_i );
-      return;
+  // The page type is complete only if it is followed by a blank or the
+  // closing quotation mark; otherwise it has no identifier.
+  const bool fComplete = ( pPageTypeEnd != pEnd );
+  for( const char* pChar = pPageType; pChar != pPageTypeEnd; ++pChar )
+  {
+    const char cChar = ( *pChar == '\t' ? ' ' : *pChar );
+    sPageTypeLit.push_back( cChar );
+    if( fComplete )
+      sPageTypeID.push_back( cChar == ' ' ? '_' : cChar );
   }
+  if( !fComplete )
+    return;
+
+  // Identifier and title.
+  if( fDQuoted )
+    ++pPageTypeEnd;
+  CDocPage::ParseHeadline( pPageTypeEnd, pEnd - pPageTypeEnd );
 }
 
 // .............................................................................
@@ -1121,23 +1228,6 @@ const std::string escrido::CRefPage::GetURL( const std::string& sOutputPostfix_i
 
 // .............................................................................
 
-// *****************************************************************************
-/// \brief      Builds an identifier from the literal page type.
-/// \
-/// \note       This function is very basic and can be improved to cover more
-///             complex literary page types.
-// *****************************************************************************
-
-void escrido::CRefPage::BuildPageTypeID()
-{
-  sPageTypeID = sPageTypeLit;
-  for( size_t c = 0; c < sPageTypeID.size(); c++ )
-    if( sPageTypeID[c] == ' ' || sPageTypeID[c] == '\t' )
-      sPageTypeID[c] = '_';
-    else
-      sPageTypeID[c] == tolower( sPageTypeID[c] );
-}
-
 // -----------------------------------------------------------------------------
 
 // CLASS CDocumentation
@@ -1145,17 +1235,50 @@ void escrido::CRefPage::BuildPageTypeID()
 // -----------------------------------------------------------------------------
 
 escrido::CDocumentation::CDocumentation() :
+  fPageOwner    ( true ),
+  pSymbolTable  ( &this->oSymbolTable ),
   fGroupOrdered ( false ),
   oGroupTree    ( this->paDocPageList ),
-  fNavOrderList ( false )
+  fNavOrderList ( false ),
+  fBackClosed   ( false ),
+  fBackDropped  ( false ),
+  fBackNSKnown  ( false ),
+  nDroppedPageN ( 0 ),
+  paParseRecord ( NULL )
 {}
 
 // .............................................................................
 
 escrido::CDocumentation::~CDocumentation()
 {
-  for( size_t s = 0; s < paDocPageList.size(); s++ )
-    delete paDocPageList[s];
+  if( fPageOwner )
+    for( size_t s = 0; s < paDocPageList.size(); s++ )
+      delete paDocPageList[s];
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Sets namespace and group filters that are applied while the
+///             documentation pages are parsed.
+///
+/// \details    A page is dropped as soon as one of its content units shows
+///             that it does not pass the filters, i.e. when its first namespace
+///             is not in the white list or when it is in a group of the black
+///             list. The remaining content units of a dropped page are
+///             discarded as they arrive (see \ref PushContentUnit()).
+///
+/// \param[in]  saNSWhiteList_i
+///             White list of namespaces. (No filtering if empty.)
+/// \param[in]  saGroupBlackList_i
+///             Black list of groups. (No filtering if empty.)
+// *****************************************************************************
+
+void escrido::CDocumentation::SetParseFilters( const std::vector<std::string>& saNSWhiteList_i,
+                                               const std::vector<std::string>& saGroupBlackList_i )
+{
+  this->saParseNSWhiteList = saNSWhiteList_i;
+  this->saParseGroupBlackList = saGroupBlackList_i;
 }
 
 // .............................................................................
@@ -1167,7 +1290,23 @@ escrido::CDocumentation::~CDocumentation()
 
 void escrido::CDocumentation::PushContentUnit( const CContentUnit& oContUnit_i )
 {
-  if( !paDocPageList.empty() )
+  if( paParseRecord != NULL )
+  {
+    paParseRecord->push_back( SParseEvent() );
+    paParseRecord->back().fType = parse_event_type::CONTENT_UNIT;
+    paParseRecord->back().oContUnit = oContUnit_i;
+  }
+
+  // Discard the content of a page that has been filtered out already.
+  if( fBackDropped || paDocPageList.empty() )
+    return;
+
+  if( this->IsFilteredOut( oContUnit_i ) )
+  {
+    this->DropBack();
+    fBackDropped = true;
+  }
+  else
     paDocPageList.back()->AppendContentUnit( oContUnit_i );
 }
 
@@ -1179,10 +1318,22 @@ void escrido::CDocumentation::PushContentUnit( const CContentUnit& oContUnit_i )
 ///
 /// \param[in]  szDocPageType_i
 ///             Identifier tag of the new documentation page.
+/// \param[in]  fOutput_i
+///             Flag whether the new page is reported on the console.
 // *****************************************************************************
 
-void escrido::CDocumentation::NewDocPage( const char* szDocPageType_i )
+void escrido::CDocumentation::NewDocPage( const char* szDocPageType_i, bool fOutput_i )
 {
+  if( paParseRecord != NULL )
+  {
+    paParseRecord->push_back( SParseEvent() );
+    paParseRecord->back().fType = parse_event_type::NEW_PAGE;
+    paParseRecord->back().sText = szDocPageType_i;
+  }
+
+  // The previous page is complete now.
+  this->CloseDocPage();
+
   // Copy C string into C++ string to make comparison code simpler.
   const std::string sDocPageType( szDocPageType_i );
 
@@ -1199,14 +1350,187 @@ void escrido::CDocumentation::NewDocPage( const char* szDocPageType_i )
   // Otherwise give a warning and use a defaul documentation page.
   if( pNewPage == NULL )
   {
-    std::cerr << "unrecognized page type '@" << szDocPageType_i << "' treated as '@_page_'" << std::endl;
+    if( fOutput_i )
+      std::cerr << "unrecognized page type '@" << szDocPageType_i << "' treated as '@_page_'" << std::endl;
     pNewPage = new CDocPage();
   }
-  else
+  else if( fOutput_i )
     std::cout << "new " << sDocPageType << std::endl;
 
   // Append to list.
   paDocPageList.push_back( pNewPage );
+  fBackClosed = false;
+  fBackDropped = false;
+  fBackNSKnown = false;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Parses the headline of the last page registered.
+// *****************************************************************************
+
+void escrido::CDocumentation::AppendHeadline( const char* szHeadline_i )
+{
+  if( paParseRecord != NULL )
+  {
+    paParseRecord->push_back( SParseEvent() );
+    paParseRecord->back().fType = parse_event_type::HEADLINE;
+    paParseRecord->back().sText = szHeadline_i;
+  }
+
+  if( !fBackDropped && !paDocPageList.empty() )
+    paDocPageList.back()->ParseHeadline( szHeadline_i, strlen( szHeadline_i ) );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Marks the last page registered as complete and applies the
+///             namespace white list to it if it has no namespace at all.
+///
+/// \details    This is called automatically on registering a new page. It
+///             must be called once after parsing the last file.
+// *****************************************************************************
+
+void escrido::CDocumentation::CloseDocPage()
+{
+  if( !fBackClosed && !fBackDropped && !paDocPageList.empty() )
+  {
+    // (A page without namespace tag is in the empty namespace.)
+    if( !fBackNSKnown && !saParseNSWhiteList.empty() &&
+        std::find( saParseNSWhiteList.begin(),
+                   saParseNSWhiteList.end(),
+                   std::string() ) == saParseNSWhiteList.end() )
+      this->DropBack();
+    else
+      paDocPageList.back()->InternSymbols( *pSymbolTable );
+  }
+
+  fBackClosed = true;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the number of pages that were dropped by the parse
+///             filters.
+// *****************************************************************************
+
+size_t escrido::CDocumentation::GetDroppedPageN() const
+{
+  return nDroppedPageN;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Counts the documentation pages, tag blocks and content chunks
+///             (for statistics).
+// *****************************************************************************
+
+void escrido::CDocumentation::CountContent( size_t& nPageN_o, size_t& nBlockN_o, size_t& nChunkN_o ) const
+{
+  nPageN_o = paDocPageList.size();
+  nBlockN_o = 0;
+  nChunkN_o = 0;
+  for( size_t p = 0; p < paDocPageList.size(); p++ )
+  {
+    const CContentUnit& oContentUnit = paDocPageList[p]->GetContentUnit();
+    nBlockN_o += oContentUnit.GetTagBlockN();
+    for( size_t b = 0; b < oContentUnit.GetTagBlockN(); b++ )
+      nChunkN_o += oContentUnit.GetTagBlock( b ).GetChunkN();
+  }
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Removes all pages and resets the documentation to the state
+///             before parsing, including its symbol table. The parse filters
+///             are kept.
+// *****************************************************************************
+
+void escrido::CDocumentation::Clear()
+{
+  if( fPageOwner )
+    for( size_t s = 0; s < paDocPageList.size(); s++ )
+      delete paDocPageList[s];
+  paDocPageList.clear();
+
+  // (A view must not clear the symbol table of its documentation.)
+  if( pSymbolTable == &oSymbolTable )
+    oSymbolTable.Clear();
+
+  fGroupOrdered = false;
+  fNavOrderList = false;
+  fBackClosed = false;
+  fBackDropped = false;
+  fBackNSKnown = false;
+  nDroppedPageN = 0;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Sets a list into which all further parse events are recorded.
+///
+/// \param[in]  paParseRecord_i
+///             Pointer to the event list or NULL to stop recording.
+// *****************************************************************************
+
+void escrido::CDocumentation::SetParseRecord( std::vector<SParseEvent>* paParseRecord_i )
+{
+  this->paParseRecord = paParseRecord_i;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the list the parse events are currently recorded into
+///             (NULL: no recording).
+// *****************************************************************************
+
+std::vector<escrido::SParseEvent>* escrido::CDocumentation::GetParseRecord() const
+{
+  return this->paParseRecord;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Replays recorded parse events as if the file they were recorded
+///             from was parsed again. This is used by the watch mode and the
+///             parse cache to rebuild the documentation without parsing
+///             unchanged files.
+///
+/// \details    If a parse record is set, the replayed events are recorded
+///             again like parsed ones.
+///
+/// \param[in]  oaParseRecord_i
+///             List of recorded events.
+// *****************************************************************************
+
+void escrido::CDocumentation::Replay( const std::vector<SParseEvent>& oaParseRecord_i )
+{
+  for( size_t e = 0; e < oaParseRecord_i.size(); e++ )
+  {
+    const SParseEvent& oEvent = oaParseRecord_i[e];
+    switch( oEvent.fType )
+    {
+      case parse_event_type::NEW_PAGE:
+        this->NewDocPage( oEvent.sText.c_str(), false );
+        break;
+
+      case parse_event_type::HEADLINE:
+        this->AppendHeadline( oEvent.sText.c_str() );
+        break;
+
+      case parse_event_type::CONTENT_UNIT:
+        this->PushContentUnit( oEvent.oContUnit );
+        break;
+    }
+  }
 }
 
 // .............................................................................
@@ -1252,6 +1576,45 @@ const std::vector <std::string> escrido::CDocumentation::GetFeatureNames() const
 
 // .............................................................................
 
+// *****************************************************************************
+/// \brief      Returns the number of documentation pages.
+// *****************************************************************************
+
+size_t escrido::CDocumentation::GetDocPageN() const
+{
+  return paDocPageList.size();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns a documentation page by its index.
+// *****************************************************************************
+
+const escrido::CDocPage& escrido::CDocumentation::GetDocPage( size_t nPageIdx_i ) const
+{
+  return *paDocPageList[nPageIdx_i];
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the symbol table of the pages, e.g. for creating a
+///             reference table (see CreateRefTable()).
+///
+/// \details    Every documentation has a symbol table of its own, so
+///             documentations can be used in parallel threads. A view shares
+///             the table of the documentation it was created from (see
+///             CreateView()). The table is reset by Clear().
+// *****************************************************************************
+
+escrido::CSymbolTable& escrido::CDocumentation::GetSymbolTable() const
+{
+  return *pSymbolTable;
+}
+
+// .............................................................................
+
 // *****************************************************************************
 /// \brief      Removes all documentation pages belonging to namespaces that
 ///             are not in the white list.
@@ -1262,21 +1625,33 @@ const std::vector <std::string> escrido::CDocumentation::GetFeatureNames() const
 
 void escrido::CDocumentation::RemoveNamespaces( const std::vector<std::string>& saNSWhiteList_i )
 {
-  for( size_t f = 0; f < this->paDocPageList.size(); )
+  // Compact the page list in a single stable pass.
+  size_t nKeep = 0;
+  for( size_t f = 0; f < this->paDocPageList.size(); f++ )
   {
+    const std::string sNamespace = this->paDocPageList[f]->GetNamespace();
+
     bool fRemove = true;
     for( size_t n = 0; n < saNSWhiteList_i.size(); n++ )
-      if( this->paDocPageList[f]->GetNamespace() == saNSWhiteList_i[n] )
+      if( sNamespace == saNSWhiteList_i[n] )
       {
         fRemove = false;
         break;
       }
 
     if( fRemove )
-      this->paDocPageList.erase( this->paDocPageList.begin() + f );
+    {
+      if( fPageOwner )
+        delete this->paDocPageList[f];
+    }
     else
-      f++;
+      this->paDocPageList[nKeep++] = this->paDocPageList[f];
   }
+  this->paDocPageList.resize( nKeep );
+
+  // Page indices have changed.
+  fGroupOrdered = false;
+  fNavOrderList = false;
 }
 
 // .............................................................................
@@ -1291,7 +1666,9 @@ void escrido::CDocumentation::RemoveNamespaces( const std::vector<std::string>&
 
 void escrido::CDocumentation::RemoveGroups( const std::vector<std::string>& saGroupBlackList_i )
 {
-  for( size_t f = 0; f < this->paDocPageList.size(); )
+  // Compact the page list in a single stable pass.
+  size_t nKeep = 0;
+  for( size_t f = 0; f < this->paDocPageList.size(); f++ )
   {
     std::vector<std::string> asGroupPage = this->paDocPageList[f]->GetGroupNames();
 
@@ -1312,20 +1689,95 @@ void escrido::CDocumentation::RemoveGroups( const std::vector<std::string>& saGr
     break_loop:
 
     if( fRemove )
-      this->paDocPageList.erase( this->paDocPageList.begin() + f );
+    {
+      if( fPageOwner )
+        delete this->paDocPageList[f];
+    }
     else
-      f++;
+      this->paDocPageList[nKeep++] = this->paDocPageList[f];
   }
+  this->paDocPageList.resize( nKeep );
+
+  // Page indices have changed.
+  fGroupOrdered = false;
+  fNavOrderList = false;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Creates a view on the documentation that contains only the
+///             pages that pass a namespace white list and a groups black list.
+///
+/// \details    The view refers to the pages of this object without copying
+///             them. It is used to write several output variants from one
+///             parsed documentation. Each view has its own group tree and
+///             navigation order. The view must not outlive this object.
+///
+/// \param[in]  saNSWhiteList_i
+///             White list of namespaces. (No filtering if empty.)
+/// \param[in]  saGroupBlackList_i
+///             Black list of groups. (No filtering if empty.)
+/// \param[out] oView_o
+///             Empty documentation object that becomes the view.
+// *****************************************************************************
+
+void escrido::CDocumentation::CreateView( const std::vector<std::string>& saNSWhiteList_i,
+                                          const std::vector<std::string>& saGroupBlackList_i,
+                                          CDocumentation& oView_o ) const
+{
+  oView_o.fPageOwner = false;
+  oView_o.pSymbolTable = this->pSymbolTable;
+  oView_o.paDocPageList.clear();
+  oView_o.paDocPageList.reserve( this->paDocPageList.size() );
+
+  for( size_t p = 0; p < this->paDocPageList.size(); p++ )
+    if( !this->IsFilteredOut( this->paDocPageList[p], saNSWhiteList_i, saGroupBlackList_i ) )
+      oView_o.paDocPageList.push_back( this->paDocPageList[p] );
+
+  oView_o.fGroupOrdered = false;
+  oView_o.fNavOrderList = false;
 }
 
 // .............................................................................
 
 void escrido::CDocumentation::CreateRefTable( const std::string& sOutputPostfix_i,
-                                              SWriteInfo& oWriteInfo_io ) const
+                                              CRefTable& oRefTable_o ) const
+{
+  CPhaseTimer oTimer( "create reference table" );
+
+  // Create a reference table.
+  for( size_t p = 0; p < this->paDocPageList.size(); p++ )
+    this->paDocPageList[p]->AddToRefTable( oRefTable_o, sOutputPostfix_i );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Resolves the references of all pages against the reference
+///             table once, so the output methods only emit the results.
+///
+/// \param[in]  oRefTable_i
+///             The reference table (see CreateRefTable()).
+/// \param[out] asUnresolved_o
+///             Returns the unresolved references as pairs of page identifier
+///             and reference identifier.
+// *****************************************************************************
+
+void escrido::CDocumentation::ResolveRefs( const CRefTable& oRefTable_i,
+                                           std::vector<std::pair<std::string, std::string>>& asUnresolved_o ) const
 {
-  // Create a reference table.
+  CPhaseTimer oTimer( "resolve references" );
+
+  asUnresolved_o.clear();
+  std::vector <std::string> asPageUnresolved;
   for( size_t p = 0; p < this->paDocPageList.size(); p++ )
-    this->paDocPageList[p]->AddToRefTable( oWriteInfo_io.oRefTable, sOutputPostfix_i );
+  {
+    asPageUnresolved.clear();
+    this->paDocPageList[p]->GetContentUnit().ResolveRefs( oRefTable_i, asPageUnresolved );
+    for( size_t r = 0; r < asPageUnresolved.size(); r++ )
+      asUnresolved_o.emplace_back( this->paDocPageList[p]->GetIdent(), asPageUnresolved[r] );
+  }
 }
 
 // .............................................................................
@@ -1333,8 +1785,11 @@ void escrido::CDocumentation::CreateRefTable( const std::string& sOutputPostfix_
 void escrido::CDocumentation::WriteHTMLDoc( const std::string& sTemplateDir_i,
                                             const std::string& sOutputDir_i,
                                             const std::string& sOutputPostfix_i,
-                                            const SWriteInfo& oWriteInfo_i ) const
+                                            const SWriteInfo& oWriteInfo_i,
+                                            const std::vector<bool>& faPageSelect_i ) const
 {
+  CPhaseTimer oTimer( "write HTML documents" );
+
   // Reset indentation in write info.
   oWriteInfo_i.nIndent = 0;
 
@@ -1342,104 +1797,179 @@ void escrido::CDocumentation::WriteHTMLDoc( const std::string& sTemplateDir_i,
   std::vector <std::string> aoFeatureNames = this->GetFeatureNames();
 
   // Find "mainpage".
-  CPageMainpage* pMainpage = NULL;
-  std::string sMainTitle = "Document Title";
-  {
-    for( size_t p = 0; p < this->paDocPageList.size(); p++ )
-      if( this->paDocPageList[p]->GetIdent() == "mainpage" )
-      {
-        pMainpage = static_cast<CPageMainpage*>( this->paDocPageList[p] );
-        sMainTitle = pMainpage->GetTitle();
-        break;
-      }
-  }
+  const CPageMainpage* pMainpage = this->FindMainpage();
 
-  // Create all pages.
+  // Create all pages (or the selected ones).
   for( size_t p = 0; p < this->paDocPageList.size(); p++ )
   {
+    if( !faPageSelect_i.empty() && !faPageSelect_i[p] )
+      continue;
+
     // Get a pointer to this page.
     CDocPage* pPage = paDocPageList[p];
+    CTraceSpan oTraceSpan( "html page", pPage->GetIdent() );
 
     // Output
-    std::cout << "writing page '" << pPage->GetIdent() << "' ";
-
-    // Deduce template file name.
-    std::string sTemplateFileName;
-    if( pPage->GetPageTypeID() == "mainpage" )
-      sTemplateFileName = "index.html";
-    else
-      sTemplateFileName = pPage->GetPageTypeID() + ".html";
+    if( oWriteInfo_i.fProgress )
+      std::cout << "writing page '" << pPage->GetIdent() << "' ";
 
-    // Try to read template.
+    // Fill the template and save the data.
     std::string sTemplatePage;
-    if( ReadTemp( sTemplateDir_i, sTemplateFileName, "default.html", sTemplatePage ) )
+    if( this->BuildHTMLPage( pPage, pMainpage, aoFeatureNames, sTemplateDir_i, oWriteInfo_i, sTemplatePage ) )
+      WriteOutput( sOutputDir_i + pPage->GetURL( sOutputPostfix_i ), sTemplatePage );
+
+    // Output
+    if( oWriteInfo_i.fProgress )
+      std::cout << std::endl;
+  }
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Creates the HTML document of a single page in memory.
+///
+/// \details    Used by the documentation server, which renders pages only
+///             when they are requested.
+///
+/// \param[in]  sURL_i
+///             URL of the page (relative to the HTML directory).
+/// \param[in]  sTemplateDir_i
+///             Template directory.
+/// \param[in]  sOutputPostfix_i
+///             Output postfix (file ending) of the HTML documents.
+/// \param[in]  oWriteInfo_i
+///             Write info object with the reference table.
+/// \param[out] sPage_o
+///             Returns the HTML document.
+///
+/// \return     'true' if a page with this URL exists and its template could
+///             be read, 'false' otherwise.
+// *****************************************************************************
+
+bool escrido::CDocumentation::GetHTMLPage( const std::string& sURL_i,
+                                           const std::string& sTemplateDir_i,
+                                           const std::string& sOutputPostfix_i,
+                                           const SWriteInfo& oWriteInfo_i,
+                                           std::string& sPage_o ) const
+{
+  for( size_t p = 0; p < this->paDocPageList.size(); p++ )
+    if( paDocPageList[p]->GetURL( sOutputPostfix_i ) == sURL_i )
     {
-      // Replace mainpage placeholders in this page.
-      ReplacePlaceholder( "*escrido-maintitle*", sMainTitle, sTemplatePage );
-      if( pMainpage != NULL )
-      {
-        ReplacePlaceholder( "*escrido-metadata*", *pMainpage, &CDocPage::WriteHTMLMetaDataList, oWriteInfo_i, sTemplatePage );
+      CPhaseTimer oTimer( "write HTML documents" );
+      CTraceSpan oTraceSpan( "html page", paDocPageList[p]->GetIdent() );
 
-        const CContentUnit* pMainContentUnit = &( pMainpage->GetContentUnit() );
+      // Reset indentation in write info.
+      oWriteInfo_i.nIndent = 0;
 
-        if( pMainContentUnit->HasTagBlock( tag_type::AUTHOR ) )
-          ReplacePlaceholder( "*escrido-mainauthor*", pMainContentUnit->GetFirstTagBlock( tag_type::AUTHOR )->GetPlainText(), sTemplatePage );
+      return this->BuildHTMLPage( paDocPageList[p], this->FindMainpage(), this->GetFeatureNames(),
+                                  sTemplateDir_i, oWriteInfo_i, sPage_o );
+    }
 
-        if( pMainContentUnit->HasTagBlock( tag_type::DATE ) )
-          ReplacePlaceholder( "*escrido-maindate*", pMainContentUnit->GetFirstTagBlock( tag_type::DATE )->GetPlainText(), sTemplatePage );
+  return false;
+}
 
-        if( pMainContentUnit->HasTagBlock( tag_type::VERSION ) )
-          ReplacePlaceholder( "*escrido-mainversion*", pMainContentUnit->GetFirstTagBlock( tag_type::VERSION )->GetPlainText(), sTemplatePage );
+// .............................................................................
 
-        if( pMainContentUnit->HasTagBlock( tag_type::COPYRIGHT ) )
-          ReplacePlaceholder( "*escrido-maincopyright*", pMainContentUnit->GetFirstTagBlock( tag_type::COPYRIGHT )->GetPlainText(), sTemplatePage );
+// *****************************************************************************
+/// \brief      Fills the HTML template of a page.
+///
+/// \param[in]  pPage_i
+///             The page.
+/// \param[in]  pMainpage_i
+///             The mainpage of the documentation (or NULL).
+/// \param[in]  aoFeatureNames_i
+///             Names of all "feature" tags present in the documentation.
+/// \param[in]  sTemplateDir_i
+///             Template directory.
+/// \param[in]  oWriteInfo_i
+///             Write info object with the reference table.
+/// \param[out] sPage_o
+///             Returns the HTML document.
+///
+/// \return     'true' if the template could be read, 'false' otherwise.
+// *****************************************************************************
 
-        if( pMainContentUnit->HasTagBlock( tag_type::BRIEF ) )
-          ReplacePlaceholder( "*escrido-mainbrief*", pMainContentUnit->GetFirstTagBlock( tag_type::BRIEF )->GetPlainText(), sTemplatePage );
-      }
+bool escrido::CDocumentation::BuildHTMLPage( const CDocPage* pPage_i,
+                                             const CPageMainpage* pMainpage_i,
+                                             const std::vector<std::string>& aoFeatureNames_i,
+                                             const std::string& sTemplateDir_i,
+                                             const SWriteInfo& oWriteInfo_i,
+                                             std::string& sPage_o ) const
+{
+  const std::string sMainTitle = ( pMainpage_i != NULL ? pMainpage_i->GetTitle() : std::string( "Document Title" ) );
 
-      // Replace other placeholders in this page.
-      ReplacePlaceholder( "*escrido-headline*", *pPage, &CDocPage::WriteHTMLHeadline, oWriteInfo_i, sTemplatePage );
-      ReplacePlaceholder( "*escrido-page-text*", *pPage, &CDocPage::WriteHTMLParSectDet, oWriteInfo_i, sTemplatePage );
-      ReplacePlaceholder( "*escrido-type*", GetCapForm( pPage->GetPageTypeLit() ), sTemplatePage );
-      ReplacePlaceholder( "*escrido-groupname#*", pPage->GetGroupNames(), sTemplatePage );
-      ReplacePlaceholder( "*escrido-title*", pPage->GetTitle(), sTemplatePage );
-      ReplacePlaceholder( "*escrido-toc*", *this, &CDocumentation::WriteHTMLTableOfContent, pPage, oWriteInfo_i, sTemplatePage );
-      ReplacePlaceholder( "*escrido-pagination-url-prev*", *this, &CDocumentation::WriteHTMLPaginatorURLPrev, pPage, oWriteInfo_i, sTemplatePage );
-      ReplacePlaceholder( "*escrido-pagination-url-next*", *this, &CDocumentation::WriteHTMLPaginatorURLNext, pPage, oWriteInfo_i, sTemplatePage );
-
-      ReplacePlaceholder( "*escrido-brief*", *pPage, &CDocPage::WriteHTMLTagBlock, tag_type::BRIEF, oWriteInfo_i, sTemplatePage );
-      ReplacePlaceholder( "*escrido-return*", *pPage, &CDocPage::WriteHTMLTagBlock, tag_type::RETURN, oWriteInfo_i, sTemplatePage );
-
-      ReplacePlaceholder( "*escrido-attributes*", *pPage, &CDocPage::WriteHTMLTagBlockList, tag_type::ATTRIBUTE, oWriteInfo_i, sTemplatePage );
-      ReplacePlaceholder( "*escrido-params*", *pPage, &CDocPage::WriteHTMLTagBlockList, tag_type::PARAM, oWriteInfo_i, sTemplatePage );
-      ReplacePlaceholder( "*escrido-see*", *pPage, &CDocPage::WriteHTMLTagBlockList, tag_type::SEE, oWriteInfo_i, sTemplatePage );
-      ReplacePlaceholder( "*escrido-signatures*", *pPage, &CDocPage::WriteHTMLTagBlockList, tag_type::SIGNATURE, oWriteInfo_i, sTemplatePage );
-      ReplacePlaceholder( "*escrido-features*", *pPage, &CDocPage::WriteHTMLTagBlockList, tag_type::FEATURE, oWriteInfo_i, sTemplatePage );
-
-      // HTML code for labels
-      std::string sHTMLLabels;
-      {
-        std::vector<std::string> asLabelList = pPage->GetLabelNames();
-        for( size_t l = 0; l < asLabelList.size(); ++l )
-          sHTMLLabels += "<span class=\"label " + GetCamelCase( asLabelList[l] ) + "\">" + asLabelList[l] + "</span>";
-      }
-      ReplacePlaceholder( "*escrido-labels*", sHTMLLabels, sTemplatePage );
+  // Deduce template file name.
+  std::string sTemplateFileName;
+  if( pPage_i->GetPageTypeSym() == symbol::MAINPAGE )
+    sTemplateFileName = "index.html";
+  else
+    sTemplateFileName = pPage_i->GetPageTypeID() + ".html";
 
-      // Construct and replace specific 'features' placeholder:
-      for( size_t f = 0; f < aoFeatureNames.size(); ++f )
-      {
-        const std::string sPlaceholder = "*escrido-feature-" + GetCamelCase( aoFeatureNames[f] ) + "*";
-        ReplacePlaceholder( sPlaceholder.c_str(), *pPage, &CDocPage::WriteHTMLTagBlock, tag_type::FEATURE, aoFeatureNames[f], oWriteInfo_i, sTemplatePage );
-      }
+  // Try to read template.
+  if( !ReadTemp( sTemplateDir_i, sTemplateFileName, "default.html", sPage_o, oWriteInfo_i.fProgress ) )
+    return false;
 
-      // Save data.
-      WriteOutput( sOutputDir_i + pPage->GetURL( sOutputPostfix_i ), sTemplatePage );
-    }
+  // Replace mainpage placeholders in this page.
+  ReplacePlaceholder( "*escrido-maintitle*", sMainTitle, sPage_o );
+  if( pMainpage_i != NULL )
+  {
+    ReplacePlaceholder( "*escrido-metadata*", *pMainpage_i, &CDocPage::WriteHTMLMetaDataList, oWriteInfo_i, sPage_o );
 
-    // Output
-    std::cout << std::endl;
+    const CContentUnit* pMainContentUnit = &( pMainpage_i->GetContentUnit() );
+
+    if( pMainContentUnit->HasTagBlock( tag_type::AUTHOR ) )
+      ReplacePlaceholder( "*escrido-mainauthor*", pMainContentUnit->GetFirstTagBlock( tag_type::AUTHOR )->GetPlainText(), sPage_o );
+
+    if( pMainContentUnit->HasTagBlock( tag_type::DATE ) )
+      ReplacePlaceholder( "*escrido-maindate*", pMainContentUnit->GetFirstTagBlock( tag_type::DATE )->GetPlainText(), sPage_o );
+
+    if( pMainContentUnit->HasTagBlock( tag_type::VERSION ) )
+      ReplacePlaceholder( "*escrido-mainversion*", pMainContentUnit->GetFirstTagBlock( tag_type::VERSION )->GetPlainText(), sPage_o );
+
+    if( pMainContentUnit->HasTagBlock( tag_type::COPYRIGHT ) )
+      ReplacePlaceholder( "*escrido-maincopyright*", pMainContentUnit->GetFirstTagBlock( tag_type::COPYRIGHT )->GetPlainText(), sPage_o );
+
+    if( pMainContentUnit->HasTagBlock( tag_type::BRIEF ) )
+      ReplacePlaceholder( "*escrido-mainbrief*", pMainContentUnit->GetFirstTagBlock( tag_type::BRIEF )->GetPlainText(), sPage_o );
+  }
+
+  // Replace other placeholders in this page.
+  ReplacePlaceholder( "*escrido-headline*", *pPage_i, &CDocPage::WriteHTMLHeadline, oWriteInfo_i, sPage_o );
+  ReplacePlaceholder( "*escrido-page-text*", *pPage_i, &CDocPage::WriteHTMLParSectDet, oWriteInfo_i, sPage_o );
+  ReplacePlaceholder( "*escrido-type*", GetCapForm( pPage_i->GetPageTypeLit() ), sPage_o );
+  ReplacePlaceholder( "*escrido-groupname#*", pPage_i->GetGroupNames(), sPage_o );
+  ReplacePlaceholder( "*escrido-title*", pPage_i->GetTitle(), sPage_o );
+  ReplacePlaceholder( "*escrido-toc*", *this, &CDocumentation::WriteHTMLTableOfContent, pPage_i, oWriteInfo_i, sPage_o );
+  ReplacePlaceholder( "*escrido-pagination-url-prev*", *this, &CDocumentation::WriteHTMLPaginatorURLPrev, pPage_i, oWriteInfo_i, sPage_o );
+  ReplacePlaceholder( "*escrido-pagination-url-next*", *this, &CDocumentation::WriteHTMLPaginatorURLNext, pPage_i, oWriteInfo_i, sPage_o );
+
+  ReplacePlaceholder( "*escrido-brief*", *pPage_i, &CDocPage::WriteHTMLTagBlock, tag_type::BRIEF, oWriteInfo_i, sPage_o );
+  ReplacePlaceholder( "*escrido-return*", *pPage_i, &CDocPage::WriteHTMLTagBlock, tag_type::RETURN, oWriteInfo_i, sPage_o );
+
+  ReplacePlaceholder( "*escrido-attributes*", *pPage_i, &CDocPage::WriteHTMLTagBlockList, tag_type::ATTRIBUTE, oWriteInfo_i, sPage_o );
+  ReplacePlaceholder( "*escrido-params*", *pPage_i, &CDocPage::WriteHTMLTagBlockList, tag_type::PARAM, oWriteInfo_i, sPage_o );
+  ReplacePlaceholder( "*escrido-see*", *pPage_i, &CDocPage::WriteHTMLTagBlockList, tag_type::SEE, oWriteInfo_i, sPage_o );
+  ReplacePlaceholder( "*escrido-signatures*", *pPage_i, &CDocPage::WriteHTMLTagBlockList, tag_type::SIGNATURE, oWriteInfo_i, sPage_o );
+  ReplacePlaceholder( "*escrido-features*", *pPage_i, &CDocPage::WriteHTMLTagBlockList, tag_type::FEATURE, oWriteInfo_i, sPage_o );
+
+  // HTML code for labels
+  std::string sHTMLLabels;
+  {
+    std::vector<std::string> asLabelList = pPage_i->GetLabelNames();
+    for( size_t l = 0; l < asLabelList.size(); ++l )
+      sHTMLLabels += "<span class=\"label " + GetCamelCase( asLabelList[l] ) + "\">" + asLabelList[l] + "</span>";
+  }
+  ReplacePlaceholder( "*escrido-labels*", sHTMLLabels, sPage_o );
+
+  // Construct and replace specific 'features' placeholder:
+  for( size_t f = 0; f < aoFeatureNames_i.size(); ++f )
+  {
+    const std::string sPlaceholder = "*escrido-feature-" + GetCamelCase( aoFeatureNames_i[f] ) + "*";
+    ReplacePlaceholder( sPlaceholder.c_str(), *pPage_i, &CDocPage::WriteHTMLTagBlock, tag_type::FEATURE, aoFeatureNames_i[f], oWriteInfo_i, sPage_o );
   }
+
+  return true;
 }
 
 // .............................................................................
@@ -1450,23 +1980,61 @@ void escrido::CDocumentation::WriteHTMLSearchIndex( const std::string& sOutputDi
                                                     const SWriteInfo& oWriteInfo_i,
                                                     const search_index_encoding fEncoding_i ) const
 {
-  // Reset indentation in write info.
-  oWriteInfo_i.nIndent = 0;
-
   // Generate combined output file name
   std::string sCombined = sOutputDir_i + sOutputPath_i;
 
   // Output
-  std::cout << "writing file '" << sOutputPath_i << "'" << std::endl;
+  if( oWriteInfo_i.fProgress )
+    std::cout << "writing file '" << sOutputPath_i << "'" << std::endl;
 
   // Open output file.
   std::ofstream oOutFile( sCombined.c_str(), std::ofstream::out );
 
+  this->WriteHTMLSearchIndex( oOutFile, sOutputPostfix_i, oWriteInfo_i, fEncoding_i );
+
+  if( oOutFile.tellp() > 0 )
+    oRunStats.nBytesWritten += oOutFile.tellp();
+
+  oOutFile.close();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Writes the search index into a stream (adapter of the output
+///             buffer version).
+// *****************************************************************************
+
+void escrido::CDocumentation::WriteHTMLSearchIndex( std::ostream& oOutStrm_i,
+                                                    const std::string& sOutputPostfix_i,
+                                                    const SWriteInfo& oWriteInfo_i,
+                                                    const search_index_encoding fEncoding_i ) const
+{
+  outbuf::COutBuffer oOutBuf( oOutStrm_i );
+  this->WriteHTMLSearchIndex( oOutBuf, sOutputPostfix_i, oWriteInfo_i, fEncoding_i );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Writes the search index into an output buffer.
+// *****************************************************************************
+
+void escrido::CDocumentation::WriteHTMLSearchIndex( outbuf::COutBuffer& oOutBuf_i,
+                                                    const std::string& sOutputPostfix_i,
+                                                    const SWriteInfo& oWriteInfo_i,
+                                                    const search_index_encoding fEncoding_i ) const
+{
+  CPhaseTimer oTimer( "write search index" );
+
+  // Reset indentation in write info.
+  oWriteInfo_i.nIndent = 0;
+
   if( fEncoding_i == search_index_encoding::JS )
-    oOutFile << "const searchIndex = ";
+    oOutBuf_i << "const searchIndex = ";
 
   // Write file opening (i.e. JSON array opening):
-  oOutFile << "[" << std::endl;
+  oOutBuf_i << "[" << '\n';
 
   // Write index data for all pages
   for( size_t p = 0; p < this->paDocPageList.size(); p++ )
@@ -1475,28 +2043,26 @@ void escrido::CDocumentation::WriteHTMLSearchIndex( const std::string& sOutputDi
     const CDocPage& oPage = *paDocPageList[p];
 
     // Write opening curly bracket.
-    oOutFile << "   {" << std::endl;
+    oOutBuf_i << "   {" << '\n';
 
     // Write general page information
-    oOutFile << "      \"title\":\"" << oPage.GetTitle() << "\"," << std::endl;
-    oOutFile << "      \"brief\":\"" << CleanAndJSONEscape( oPage.GetClearTextBrief( oWriteInfo_i ) ) << "\"," << std::endl;
-    oOutFile << "      \"url\":\"" << oPage.GetURL( sOutputPostfix_i ) << "\"," << std::endl;
-    oOutFile << "      \"content\":\"" << CleanAndJSONEscape( oPage.GetClearTextContent( oWriteInfo_i ) ) << "\"," << std::endl;
+    oOutBuf_i << "      \"title\":\"" << oPage.GetTitle() << "\"," << '\n';
+    oOutBuf_i << "      \"brief\":\"" << CleanAndJSONEscape( oPage.GetClearTextBrief( oWriteInfo_i ) ) << "\"," << '\n';
+    oOutBuf_i << "      \"url\":\"" << oPage.GetURL( sOutputPostfix_i ) << "\"," << '\n';
+    oOutBuf_i << "      \"content\":\"" << CleanAndJSONEscape( oPage.GetClearTextContent( oWriteInfo_i ) ) << "\"," << '\n';
 
     // Write closing curly bracket.
     if( p + 1 == this->paDocPageList.size() )
-      oOutFile << "   }" << std::endl;
+      oOutBuf_i << "   }" << '\n';
     else
-      oOutFile << "   }," << std::endl;
+      oOutBuf_i << "   }," << '\n';
   }
 
   // Write file closing (i.e. JSON array closing):
-  oOutFile << "]";
+  oOutBuf_i << "]";
 
   if( fEncoding_i == search_index_encoding::JS )
-    oOutFile << ";";
-
-  oOutFile.close();
+    oOutBuf_i << ";";
 }
 
 // .............................................................................
@@ -1505,6 +2071,8 @@ void escrido::CDocumentation::WriteLaTeXDoc( const std::string& sTemplateDir_i,
                                              const std::string& sOutputDir_i,
                                              const SWriteInfo& oWriteInfo_i ) const
 {
+  CPhaseTimer oTimer( "write LaTeX document" );
+
  // Make sure the group list is prepared.
   if( !fGroupOrdered )
     this->FillGroupTreeOrdered();
@@ -1520,7 +2088,7 @@ void escrido::CDocumentation::WriteLaTeXDoc( const std::string& sTemplateDir_i,
   const CContentUnit* pMainContentUnit = NULL;
   {
     for( size_t p = 0; p < this->paDocPageList.size(); p++ )
-      if( this->paDocPageList[p]->GetIdent() == "mainpage" )
+      if( this->paDocPageList[p]->GetIdentSym() == symbol::MAINPAGE )
       {
         pMainpage = static_cast<CPageMainpage*>( this->paDocPageList[p] );
         pMainContentUnit = &( pMainpage->GetContentUnit() );
@@ -1552,6 +2120,28 @@ void escrido::CDocumentation::WriteLaTeXDoc( const std::string& sTemplateDir_i,
       if( ReadTemp( sTemplateDir_i, "latex_commands.tex", sTepmplateNewCommands ) )
         ReplacePlaceholder( "*escrido_latex_commands*", sTepmplateNewCommands, sTemplateDoc );
 
+      // Conversion rules from HTML to LaTeX: the rules of the optional
+      // template file take precedence over the built-in ones.
+      CLaTeXConverter oLaTeXConverter;
+      {
+        std::ifstream oRuleFile( sTemplateDir_i + "latex_rules.txt", std::ifstream::in | std::ifstream::binary );
+        if( oRuleFile.is_open() )
+        {
+          // (Attention: the extra brackets arround the first constructor are essential; DO NOT REMOVE;)
+          const std::string sRules( (std::istreambuf_iterator<char>( oRuleFile )),
+                                    std::istreambuf_iterator<char>() );
+          const size_t nErrLine = oLaTeXConverter.ParseRules( sRules );
+          if( nErrLine != std::string::npos )
+            std::cerr << "warning: invalid conversion rule in line " << nErrLine << " of template file '"
+                      << sTemplateDir_i << "latex_rules.txt' - ignoring the following rules" << std::endl;
+        }
+      }
+      oLaTeXConverter.AddDefaultRules();
+      // (The pages are written with a copy of the write info that uses this
+      // converter.)
+      SWriteInfo oLaTeXWriteInfo( oWriteInfo_i );
+      oLaTeXWriteInfo.pLaTeXConverter = &oLaTeXConverter;
+
       // Replace mainpage placeholders in base document.
       if( pMainpage != NULL )
       {
@@ -1574,10 +2164,12 @@ void escrido::CDocumentation::WriteLaTeXDoc( const std::string& sTemplateDir_i,
       }
 
       // Loop over group tree to write groups content
-      size_t nLvl;
-      const CGroupNode* pGroup = this->oGroupTree.FirstGroupNode( nLvl );
-      while( pGroup != NULL )
+      const std::vector <CGroupTree::SFlatNode>& aoGroupList = this->oGroupTree.GetFlatList();
+      for( size_t g = 0; g < aoGroupList.size(); ++g )
       {
+        const CGroupNode* pGroup = aoGroupList[g].pNode;
+        const size_t nLvl = aoGroupList[g].nLvl;
+
         // Write group headline if
         // - groups are used at all
         // - this group contains any pages
@@ -1619,20 +2211,22 @@ void escrido::CDocumentation::WriteLaTeXDoc( const std::string& sTemplateDir_i,
         {
           // Get a pointer to this page.
           CDocPage* pPage = paDocPageList[pGroup->naDocPageIdxList[p]];
+          CTraceSpan oTraceSpan( "latex page", pPage->GetIdent() );
 
           // Output
-          std::cout << "writing page '" << pPage->GetIdent() << "' ";
+          if( oLaTeXWriteInfo.fProgress )
+            std::cout << "writing page '" << pPage->GetIdent() << "' ";
 
           // Deduce template file name.
           std::string sTemplateFileName;
-          if( pPage->GetPageTypeID() == "mainpage" )
+          if( pPage->GetPageTypeSym() == symbol::MAINPAGE )
             sTemplateFileName = "page.tex";
           else
             sTemplateFileName = pPage->GetPageTypeID() + ".tex";
 
           // Try to read template.
           std::string sTemplatePage;
-          if( ReadTemp( sTemplateDir_i, sTemplateFileName, "default.tex", sTemplatePage ) )
+          if( ReadTemp( sTemplateDir_i, sTemplateFileName, "default.tex", sTemplatePage, oLaTeXWriteInfo.fProgress ) )
           {
             // Expand "*escrido-pages*":
             ReplacePlaceholder( "*escrido-pages*", "*escrido-page*\n*escrido-pages*", sTemplateDoc );
@@ -1653,26 +2247,26 @@ void escrido::CDocumentation::WriteLaTeXDoc( const std::string& sTemplateDir_i,
             }
 
             // Replace other placeholders in this page.
-            ReplacePlaceholder( "*escrido-headline*", *pPage, &CDocPage::WriteLaTeXHeadline, oWriteInfo_i, sTemplatePage );
-            ReplacePlaceholder( "*escrido-page-text*", *pPage, &CDocPage::WriteLaTeXParSectDet, oWriteInfo_i, sTemplatePage );
+            ReplacePlaceholder( "*escrido-headline*", *pPage, &CDocPage::WriteLaTeXHeadline, oLaTeXWriteInfo, sTemplatePage );
+            ReplacePlaceholder( "*escrido-page-text*", *pPage, &CDocPage::WriteLaTeXParSectDet, oLaTeXWriteInfo, sTemplatePage );
             ReplacePlaceholder( "*escrido-type*", GetCapForm( pPage->GetPageTypeLit() ), sTemplatePage );
             ReplacePlaceholder( "*escrido-groupname#*", pPage->GetGroupNames(), sTemplatePage );
             ReplacePlaceholder( "*escrido-title*", pPage->GetTitle(), sTemplatePage );
 
-            ReplacePlaceholder( "*escrido-brief*", *pPage, &CDocPage::WriteLaTeXTagBlock, tag_type::BRIEF, oWriteInfo_i, sTemplatePage );
-            ReplacePlaceholder( "*escrido-return*", *pPage, &CDocPage::WriteLaTeXTagBlock, tag_type::RETURN, oWriteInfo_i, sTemplatePage );
+            ReplacePlaceholder( "*escrido-brief*", *pPage, &CDocPage::WriteLaTeXTagBlock, tag_type::BRIEF, oLaTeXWriteInfo, sTemplatePage );
+            ReplacePlaceholder( "*escrido-return*", *pPage, &CDocPage::WriteLaTeXTagBlock, tag_type::RETURN, oLaTeXWriteInfo, sTemplatePage );
 
-            ReplacePlaceholder( "*escrido-attributes*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::ATTRIBUTE, oWriteInfo_i, sTemplatePage );
-            ReplacePlaceholder( "*escrido-params*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::PARAM, oWriteInfo_i, sTemplatePage );
-            ReplacePlaceholder( "*escrido-see*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::SEE, oWriteInfo_i, sTemplatePage );
-            ReplacePlaceholder( "*escrido-signatures*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::SIGNATURE, oWriteInfo_i, sTemplatePage );
-            ReplacePlaceholder( "*escrido-features*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::FEATURE, oWriteInfo_i, sTemplatePage );
+            ReplacePlaceholder( "*escrido-attributes*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::ATTRIBUTE, oLaTeXWriteInfo, sTemplatePage );
+            ReplacePlaceholder( "*escrido-params*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::PARAM, oLaTeXWriteInfo, sTemplatePage );
+            ReplacePlaceholder( "*escrido-see*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::SEE, oLaTeXWriteInfo, sTemplatePage );
+            ReplacePlaceholder( "*escrido-signatures*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::SIGNATURE, oLaTeXWriteInfo, sTemplatePage );
+            ReplacePlaceholder( "*escrido-features*", *pPage, &CDocPage::WriteLaTeXTagBlockList, tag_type::FEATURE, oLaTeXWriteInfo, sTemplatePage );
 
             // Construct and replace specific 'features' placeholder:
             for( size_t f = 0; f < aoFeatureNames.size(); ++f )
             {
               const std::string sPlaceholder = "*escrido-feature-" + GetCamelCase( aoFeatureNames[f] ) + "*";
-              ReplacePlaceholder( sPlaceholder.c_str(), *pPage, &CDocPage::WriteLaTeXTagBlock, tag_type::FEATURE, aoFeatureNames[f], oWriteInfo_i, sTemplatePage );
+              ReplacePlaceholder( sPlaceholder.c_str(), *pPage, &CDocPage::WriteLaTeXTagBlock, tag_type::FEATURE, aoFeatureNames[f], oLaTeXWriteInfo, sTemplatePage );
             }
 
             // Enter page into base document.
@@ -1680,11 +2274,9 @@ void escrido::CDocumentation::WriteLaTeXDoc( const std::string& sTemplateDir_i,
           }
 
           // Output
-          std::cout << std::endl;
+          if( oLaTeXWriteInfo.fProgress )
+            std::cout << std::endl;
         }
-
-        // Get next group
-        pGroup = this->oGroupTree.NextGroupNode( pGroup, nLvl );
       }
 
       // Delete final "*escrido-pages*":
@@ -1717,68 +2309,51 @@ void escrido::CDocumentation::DebugOutput() const
 // *****************************************************************************
 
 void escrido::CDocumentation::WriteHTMLTableOfContent( const CDocPage* pWritePage_i,
-                                                       std::ostream& oOutStrm_i,
+                                                       outbuf::COutBuffer& oOutBuf_i,
                                                        const SWriteInfo& oWriteInfo_i ) const
 {
   if( !fGroupOrdered )
     this->FillGroupTreeOrdered();
 
-  // Determine those groups containing the "write page".
-  std::vector <const CGroupNode*> apWritePageGroups;
-  {
-    // Loop over groups
-    signed int nPrevLvl = -1;
-    size_t nLvl;
-    const CGroupNode* pGroup = this->oGroupTree.FirstGroupNode( nLvl );
-    bool fFoundWritePage = false;
-    while( pGroup != NULL )
-    {
-      // Track group path
-      if( (signed int) nLvl <= nPrevLvl )
-        apWritePageGroups.erase( apWritePageGroups.end() - ( nPrevLvl - nLvl + 1 ),
-                                 apWritePageGroups.end() );
-      apWritePageGroups.push_back( pGroup );
-
-      // Check for write page
-      for( size_t p = 0; p < pGroup->naDocPageIdxList.size(); ++p )
-        if( paDocPageList[pGroup->naDocPageIdxList[p]] == pWritePage_i )
-        {
-          fFoundWritePage = true;
-          break;
-        }
+  const std::vector <CGroupTree::SFlatNode>& aoGroupList = this->oGroupTree.GetFlatList();
 
-      if( fFoundWritePage )
+  // Determine the group containing the "write page". (The groups containing
+  // it are those whose subtree range includes this group.)
+  size_t nWritePageGroupIdx = std::string::npos;
+  for( size_t g = 0; g < aoGroupList.size() && nWritePageGroupIdx == std::string::npos; ++g )
+  {
+    const CGroupNode* pGroup = aoGroupList[g].pNode;
+    for( size_t p = 0; p < pGroup->naDocPageIdxList.size(); ++p )
+      if( paDocPageList[pGroup->naDocPageIdxList[p]] == pWritePage_i )
+      {
+        nWritePageGroupIdx = g;
         break;
-
-      // Store previous level
-      nPrevLvl = nLvl;
-
-      // Get next group
-      pGroup = this->oGroupTree.NextGroupNode( pGroup, nLvl );
-    }
+      }
   }
 
   // Loop over group tree:
   signed int nPrevLvl = -1;
-  size_t nLvl;
-  const CGroupNode* pGroup = this->oGroupTree.FirstGroupNode( nLvl );
-  while( pGroup != NULL )
+  for( size_t g = 0; g < aoGroupList.size(); ++g )
   {
+    const CGroupNode* pGroup = aoGroupList[g].pNode;
+    const signed int nLvl = static_cast<signed int>( aoGroupList[g].nLvl );
+
     // Closing tags of group unordered list containers
-    if( (signed int) nLvl <= nPrevLvl )
+    if( nLvl <= nPrevLvl )
       for( int i = 0; i <= ( nPrevLvl - nLvl ); ++i )
       {
-        WriteHTMLIndents( oOutStrm_i, --oWriteInfo_i ) << "</ul>" << std::endl;
-        WriteHTMLIndents( oOutStrm_i, --oWriteInfo_i ) << "</li>" << std::endl;
+        WriteHTMLIndents( oOutBuf_i, --oWriteInfo_i ) << "</ul>" << '\n';
+        WriteHTMLIndents( oOutBuf_i, --oWriteInfo_i ) << "</li>" << '\n';
       }
 
     // Start list item
     if( nLvl != 0 )
     {
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<li";
-      if( pGroup == apWritePageGroups[nLvl] )
-        oOutStrm_i << " class=\"activepage\"";
-      oOutStrm_i << ">" << std::endl;
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<li";
+      if( nWritePageGroupIdx != std::string::npos &&
+          g <= nWritePageGroupIdx && nWritePageGroupIdx < aoGroupList[g].nSubtreeEnd )
+        oOutBuf_i << " class=\"activepage\"";
+      oOutBuf_i << ">" << '\n';
     }
 
     // If group name is not empty: display it
@@ -1786,178 +2361,126 @@ void escrido::CDocumentation::WriteHTMLTableOfContent( const CDocPage* pWritePag
     {
       // Determine HTML heading level from the group nesting level.
       // Don't go below level 5 since level 6 is reserved for page type.
-      size_t nHeadingLvl = nLvl + 1;
+      signed int nHeadingLvl = nLvl + 1;
       if( nHeadingLvl > 5 )
         nHeadingLvl = 5;
 
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) <<
-        "<h" << nHeadingLvl << ">" << pGroup->sGroupName << "</h" << nHeadingLvl << ">" << std::endl;
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) <<
+        "<h" << nHeadingLvl << ">" << pGroup->sGroupName << "</h" << nHeadingLvl << ">" << '\n';
     }
 
     // Opening tag of group unordered list container
-    WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<ul>" << std::endl;
-
-    // Write all pages of page types "mainpage" and "page" of this group.
-    WriteHTMLTOCPageType( *pGroup, "mainpage", pWritePage_i, oOutStrm_i, oWriteInfo_i );
-    WriteHTMLTOCPageType( *pGroup, "page", pWritePage_i, oOutStrm_i, oWriteInfo_i );
-
-    // Populate a list of all user-defined page types that appear in this group.
-    std::vector<std::string>saPageTypeList;
-    for( size_t p = 0; p < pGroup->naDocPageIdxList.size(); ++p )
-    {
-      std::string sPageTypeID = paDocPageList[pGroup->naDocPageIdxList[p]]->GetPageTypeID();
-
-      bool fExists = false;
-      for( size_t pt = 0; pt < saPageTypeList.size(); ++pt )
-        if( saPageTypeList[pt] == sPageTypeID )
-        {
-          fExists = true;
-          break;
-        }
-
-      if( !fExists )
-        saPageTypeList.push_back( sPageTypeID );
-    }
+    WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<ul>" << '\n';
 
-    // Write all pages of all other page types of this group.
-    for( size_t pt = 0; pt < saPageTypeList.size(); ++pt )
-      if( saPageTypeList[pt] != "mainpage" && saPageTypeList[pt] != "page" )
-        WriteHTMLTOCPageType( *pGroup, saPageTypeList[pt], pWritePage_i, oOutStrm_i, oWriteInfo_i );
+    // Write all pages of this group by page type ("mainpage" and "page"
+    // first).
+    const std::vector <CGroupNode::SPageTypeBucket>& aoBucketList = pGroup->GetPageTypeBuckets();
+    for( size_t b = 0; b < aoBucketList.size(); ++b )
+      WriteHTMLTOCPageType( aoBucketList[b], pWritePage_i, oOutBuf_i, oWriteInfo_i );
 
     // Store previous level
     nPrevLvl = nLvl;
-
-    // Get next group
-    pGroup = this->oGroupTree.NextGroupNode( pGroup, nLvl );
   }
 
   // Close remaining group div containers
   for( int i = 0; i <= nPrevLvl; ++i )
   {
-    WriteHTMLIndents( oOutStrm_i, --oWriteInfo_i ) << "</ul>" << std::endl;
+    WriteHTMLIndents( oOutBuf_i, --oWriteInfo_i ) << "</ul>" << '\n';
 
     if( i != nPrevLvl )
-      WriteHTMLIndents( oOutStrm_i, --oWriteInfo_i ) << "</li>" << std::endl;
+      WriteHTMLIndents( oOutBuf_i, --oWriteInfo_i ) << "</li>" << '\n';
   }
 }
 
 // .............................................................................
 
 // *****************************************************************************
-/// @brief      Writes all pages of a certain type of one group into the table
-///             of contents.
+/// @brief      Writes all pages of a certain type of one group (i.e. a page
+///             type bucket of the group) into the table of contents.
 // *****************************************************************************
 
-void escrido::CDocumentation::WriteHTMLTOCPageType( const CGroupNode& oGroup_i,
-                                                    const std::string& sPageTypeID_i,
+void escrido::CDocumentation::WriteHTMLTOCPageType( const CGroupNode::SPageTypeBucket& oBucket_i,
                                                     const CDocPage* pWritePage_i,
-                                                    std::ostream& oOutStrm_i,
+                                                    outbuf::COutBuffer& oOutBuf_i,
                                                     const SWriteInfo& oWriteInfo_i ) const
 {
-  // Check whether any pages of this type exist and (if so) retrieve the
-  // literal form of the page type name.
-  bool fPageExist = false;
-  std::string sPageTypeLit;
-  for( size_t p = 0; p < oGroup_i.naDocPageIdxList.size(); ++p )
-  {
-    const CDocPage* pPage = paDocPageList[oGroup_i.naDocPageIdxList[p]];
-
-    if( pPage->GetPageTypeID() == sPageTypeID_i )
-    {
-      // Get the literary form of the page type name.
-      sPageTypeLit = pPage->GetPageTypeLit();
-
-      // Note that at least one page exists.
-      fPageExist = true;
-      break;
-    }
-  }
-
   // Show list of pages if at least one page of that type exists.
-  if( fPageExist )
+  if( !oBucket_i.anDocPageIdxList.empty() )
   {
     // Check whether these pages contain the "write page"
     bool fWritePage = false;
-    for( size_t p = 0; p < oGroup_i.naDocPageIdxList.size(); ++p )
-    {
-      const CDocPage* pPage = paDocPageList[oGroup_i.naDocPageIdxList[p]];
-
-      if( pPage->GetPageTypeID() == sPageTypeID_i )
-        if( pPage == pWritePage_i )
-        {
-          fWritePage = true;
-          break;
-        }
-    }
+    for( size_t p = 0; p < oBucket_i.anDocPageIdxList.size(); ++p )
+      if( paDocPageList[oBucket_i.anDocPageIdxList[p]] == pWritePage_i )
+      {
+        fWritePage = true;
+        break;
+      }
 
-    WriteHTMLIndents( oOutStrm_i, oWriteInfo_i++ ) << "<li";
+    WriteHTMLIndents( oOutBuf_i, oWriteInfo_i++ ) << "<li";
     if( fWritePage )
-      oOutStrm_i << " class=\"activepage\"";
-    oOutStrm_i << ">" << std::endl;
+      oOutBuf_i << " class=\"activepage\"";
+    oOutBuf_i << ">" << '\n';
 
     // For all but "page" and "mainpage": write a headline.
-    if( sPageTypeID_i != "page" &&
-        sPageTypeID_i != "mainpage" )
-      WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<h6>" << GetCapPluralForm( sPageTypeLit ) << "</h6>" << std::endl;
+    if( oBucket_i.nPageTypeID != symbol::PAGE &&
+        oBucket_i.nPageTypeID != symbol::MAINPAGE )
+      WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<h6>" << GetCapPluralForm( oBucket_i.sPageTypeLit ) << "</h6>" << '\n';
 
-    WriteHTMLTagLine( "<ul>", oOutStrm_i, oWriteInfo_i );
+    WriteHTMLTagLine( "<ul>", oOutBuf_i, oWriteInfo_i );
     ++oWriteInfo_i;
 
-    // Loop over all pages of the group:
-    for( size_t p = 0; p < oGroup_i.naDocPageIdxList.size(); ++p )
+    // Loop over all pages of the page type:
+    for( size_t p = 0; p < oBucket_i.anDocPageIdxList.size(); ++p )
     {
-      CDocPage* pPage = paDocPageList[oGroup_i.naDocPageIdxList[p]];
+      CDocPage* pPage = paDocPageList[oBucket_i.anDocPageIdxList[p]];
 
-      if( pPage->GetPageTypeID() == sPageTypeID_i )
-      {
-        // Get brief description, if it exists.
-        std::string sBrief = pPage->GetClearTextBrief( oWriteInfo_i );
+      // Get brief description, if it exists.
+      std::string sBrief = pPage->GetClearTextBrief( oWriteInfo_i );
 
-        // Write list item tag, either with or w/o brief description as title.
-        {
-          if( sBrief.empty() )
-            WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<li";
-          else
-            WriteHTMLIndents( oOutStrm_i, oWriteInfo_i ) << "<li title=\"" << sBrief << "\"";
+      // Write list item tag, either with or w/o brief description as title.
+      {
+        if( sBrief.empty() )
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<li";
+        else
+          WriteHTMLIndents( oOutBuf_i, oWriteInfo_i ) << "<li title=\"" << sBrief << "\"";
 
-          // Mark if the entry is the page currently written.
-          if( pPage == pWritePage_i )
-            oOutStrm_i << " class=\"activepage\"";
+        // Mark if the entry is the page currently written.
+        if( pPage == pWritePage_i )
+          oOutBuf_i << " class=\"activepage\"";
 
-          // Close <li> tag.
-          oOutStrm_i << ">";
-        }
+        // Close <li> tag.
+        oOutBuf_i << ">";
+      }
 
-        // Create link, if available:
-        bool fLink = false;
+      // Create link, if available:
+      bool fLink = false;
+      {
+        size_t nRefIdx;
+        if( oWriteInfo_i.oRefTable.GetRefIdx( pPage->GetIdentSym(), nRefIdx ) )
         {
-          size_t nRefIdx;
-          if( oWriteInfo_i.oRefTable.GetRefIdx( pPage->GetIdent(), nRefIdx ) )
-          {
-            fLink = true;
-            oOutStrm_i << "<a href=\""  << oWriteInfo_i.oRefTable.GetLink( nRefIdx ) << "\">";
-          }
+          fLink = true;
+          oOutBuf_i << "<a href=\""  << oWriteInfo_i.oRefTable.GetLink( nRefIdx ) << "\">";
         }
+      }
 
-        oOutStrm_i << pPage->GetTitle();
+      oOutBuf_i << pPage->GetTitle();
 
-        // Eventually close link.
-        if( fLink )
-          oOutStrm_i << "</a>";
+      // Eventually close link.
+      if( fLink )
+        oOutBuf_i << "</a>";
 
-        oOutStrm_i << "</li>" << std::endl;
-      }
+      oOutBuf_i << "</li>" << '\n';
     }
 
-    WriteHTMLTagLine( "</ul>", oOutStrm_i, --oWriteInfo_i );
-    WriteHTMLTagLine( "</li>", oOutStrm_i, --oWriteInfo_i );
+    WriteHTMLTagLine( "</ul>", oOutBuf_i, --oWriteInfo_i );
+    WriteHTMLTagLine( "</li>", oOutBuf_i, --oWriteInfo_i );
   }
 }
 
 // .............................................................................
 
 void escrido::CDocumentation::WriteHTMLPaginatorURLPrev( const CDocPage* pWritePage_i,
-                                                          std::ostream& oOutStrm_i,
+                                                          outbuf::COutBuffer& oOutBuf_i,
                                                           const SWriteInfo& oWriteInfo_i ) const
 {
   if( !fNavOrderList )
@@ -1979,9 +2502,9 @@ void escrido::CDocumentation::WriteHTMLPaginatorURLPrev( const CDocPage* pWriteP
 
       // Get reference index and output link url.
       size_t nRefIdx;
-      if( oWriteInfo_i.oRefTable.GetRefIdx( pNextPage->GetIdent(), nRefIdx ) )
+      if( oWriteInfo_i.oRefTable.GetRefIdx( pNextPage->GetIdentSym(), nRefIdx ) )
       {
-        oOutStrm_i << oWriteInfo_i.oRefTable.GetLink( nRefIdx );
+        oOutBuf_i << oWriteInfo_i.oRefTable.GetLink( nRefIdx );
       }
     }
   }
@@ -1990,7 +2513,7 @@ void escrido::CDocumentation::WriteHTMLPaginatorURLPrev( const CDocPage* pWriteP
 // .............................................................................
 
 void escrido::CDocumentation::WriteHTMLPaginatorURLNext( const CDocPage* pWritePage_i,
-                                                         std::ostream& oOutStrm_i,
+                                                         outbuf::COutBuffer& oOutBuf_i,
                                                          const SWriteInfo& oWriteInfo_i ) const
 {
   if( !fNavOrderList )
@@ -2012,9 +2535,9 @@ void escrido::CDocumentation::WriteHTMLPaginatorURLNext( const CDocPage* pWriteP
 
       // Get reference index and output link url.
       size_t nRefIdx;
-      if( oWriteInfo_i.oRefTable.GetRefIdx( pNextPage->GetIdent(), nRefIdx ) )
+      if( oWriteInfo_i.oRefTable.GetRefIdx( pNextPage->GetIdentSym(), nRefIdx ) )
       {
-        oOutStrm_i << oWriteInfo_i.oRefTable.GetLink( nRefIdx );
+        oOutBuf_i << oWriteInfo_i.oRefTable.GetLink( nRefIdx );
       }
     }
   }
@@ -2028,8 +2551,10 @@ void escrido::CDocumentation::WriteHTMLPaginatorURLNext( const CDocPage* pWriteP
 
 void escrido::CDocumentation::FillGroupTreeOrdered() const
 {
+  CPhaseTimer oTimer( "order group tree" );
+
   // Step 1: create group tree and fill in all pages.
-  oGroupTree.Update();
+  oGroupTree.Update( *pSymbolTable );
 
   // Step 2: create a reference list from the @order tags of the main page.
   std::vector <std::string> saOrderRefList;
@@ -2037,7 +2562,7 @@ void escrido::CDocumentation::FillGroupTreeOrdered() const
     // Check if a main page exists.
     CPageMainpage* pMainpage = NULL;
     for( size_t p = 0; p < paDocPageList.size(); p++ )
-      if( paDocPageList[p]->GetIdent() == "mainpage" )
+      if( paDocPageList[p]->GetIdentSym() == symbol::MAINPAGE )
       {
         pMainpage = static_cast<CPageMainpage*>( this->paDocPageList[p] );
         break;
@@ -2084,7 +2609,7 @@ void escrido::CDocumentation::FillGroupTreeOrdered() const
 
   // Step 3: sort the group tree based on the reference list and alphanumeric
   //         order.
-  oGroupTree.Order( saOrderRefList );
+  oGroupTree.Order( saOrderRefList, *pSymbolTable );
 
   fGroupOrdered = true;
 }
@@ -2110,49 +2635,18 @@ void escrido::CDocumentation::FillNavOrderList() const
   anNavOrderPageIdxList.clear();
 
   // Loop over group tree:
-  size_t nLvl;
-  const CGroupNode* pGroup = this->oGroupTree.FirstGroupNode( nLvl );
-  while( pGroup != NULL )
+  const std::vector <CGroupTree::SFlatNode>& aoGroupList = this->oGroupTree.GetFlatList();
+  for( size_t g = 0; g < aoGroupList.size(); ++g )
   {
-    // Create a list of all page types within this group.
-    // Start with "mainpage" and "page" type, like in WriteHTMLTableOfContent()
-    std::vector<std::string>saPageTypeList = { "mainpage", "page" };
-
-    // Populate the list with all user-defined page types that appear in this group.
-    for( size_t p = 0; p < pGroup->naDocPageIdxList.size(); p++ )
-    {
-      std::string sPageTypeID = paDocPageList[pGroup->naDocPageIdxList[p]]->GetPageTypeID();
-
-      bool fExists = false;
-      for( size_t pt = 0; pt < saPageTypeList.size(); ++pt )
-        if( saPageTypeList[pt] == sPageTypeID )
-        {
-          fExists = true;
-          break;
-        }
-
-      if( !fExists )
-        saPageTypeList.push_back( sPageTypeID );
-    }
-
-    // Loop over the list of page types.
-    for( size_t pt = 0; pt < saPageTypeList.size(); ++pt )
-    {
-      const std::string& sPageTypeID = saPageTypeList[pt];
-
-      // Loop over all pages in the group
-      for( size_t p = 0; p < pGroup->naDocPageIdxList.size(); ++p )
-      {
-        size_t nDocPageIdx = pGroup->naDocPageIdxList[p];
-
-        // If the page is in the current page type: add it to the order list.
-        if( paDocPageList[nDocPageIdx]->GetPageTypeID() == sPageTypeID )
-          anNavOrderPageIdxList.push_back( nDocPageIdx );
-      }
-    }
-
-    // Get next group
-    pGroup = this->oGroupTree.NextGroupNode( pGroup, nLvl );
+    const CGroupNode* pGroup = aoGroupList[g].pNode;
+
+    // Add the pages by page type ("mainpage" and "page" first), like in
+    // WriteHTMLTableOfContent().
+    const std::vector <CGroupNode::SPageTypeBucket>& aoBucketList = pGroup->GetPageTypeBuckets();
+    for( size_t b = 0; b < aoBucketList.size(); ++b )
+      anNavOrderPageIdxList.insert( anNavOrderPageIdxList.end(),
+                                    aoBucketList[b].anDocPageIdxList.begin(),
+                                    aoBucketList[b].anDocPageIdxList.end() );
   }
 
   fNavOrderList = true;
@@ -2204,6 +2698,126 @@ std::string escrido::CDocumentation::CleanAndJSONEscape( const std::string& sTex
   return sResult;
 }
 
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Checks a documentation page against namespace and group
+///             filters.
+///
+/// \param[in]  pDocPage_i
+///             The documentation page.
+/// \param[in]  saNSWhiteList_i
+///             White list of namespaces. (No filtering if empty.)
+/// \param[in]  saGroupBlackList_i
+///             Black list of groups. (No filtering if empty.)
+///
+/// \return     true, if the page does not pass the filters, false otherwise.
+// *****************************************************************************
+
+bool escrido::CDocumentation::IsFilteredOut( const CDocPage* pDocPage_i,
+                                             const std::vector<std::string>& saNSWhiteList_i,
+                                             const std::vector<std::string>& saGroupBlackList_i ) const
+{
+  // Namespace white list. (The first namespace tag of a page is decisive.)
+  if( !saNSWhiteList_i.empty() )
+    if( std::find( saNSWhiteList_i.begin(),
+                   saNSWhiteList_i.end(),
+                   pDocPage_i->GetNamespace() ) == saNSWhiteList_i.end() )
+      return true;
+
+  // Group black list.
+  if( !saGroupBlackList_i.empty() )
+  {
+    const std::vector<std::string> asGroupPage = pDocPage_i->GetGroupNames();
+    for( size_t pg = 0; pg < asGroupPage.size(); ++pg )
+      if( std::find( saGroupBlackList_i.begin(),
+                     saGroupBlackList_i.end(),
+                     asGroupPage[pg] ) != saGroupBlackList_i.end() )
+        return true;
+  }
+
+  return false;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Checks a content unit arriving for the last page registered
+///             against the parse filters.
+///
+/// \details    Only the tag blocks of the new content unit are inspected. The
+///             first namespace tag of the page is decisive, so the namespace
+///             is checked only until one has been found.
+///
+/// \param[in]  oContUnit_i
+///             The content unit that is to be appended to the last page.
+///
+/// \return     true, if the page does not pass the filters, false otherwise.
+// *****************************************************************************
+
+bool escrido::CDocumentation::IsFilteredOut( const CContentUnit& oContUnit_i )
+{
+  // Namespace white list.
+  if( !fBackNSKnown )
+  {
+    const CTagBlock* pTagBlock = oContUnit_i.GetFirstTagBlock( tag_type::NAMESPACE );
+    if( pTagBlock != NULL )
+    {
+      fBackNSKnown = true;
+      if( !saParseNSWhiteList.empty() &&
+          std::find( saParseNSWhiteList.begin(),
+                     saParseNSWhiteList.end(),
+                     pTagBlock->GetPlainFirstWordView().str() ) == saParseNSWhiteList.end() )
+        return true;
+    }
+  }
+
+  // Group black list.
+  if( !saParseGroupBlackList.empty() )
+  {
+    const CTagBlock* pTagBlock = oContUnit_i.GetFirstTagBlock( tag_type::INGROUP );
+    while( pTagBlock != NULL )
+    {
+      if( std::find( saParseGroupBlackList.begin(),
+                     saParseGroupBlackList.end(),
+                     pTagBlock->GetPlainTitleLine() ) != saParseGroupBlackList.end() )
+        return true;
+      pTagBlock = oContUnit_i.GetNextTagBlock( pTagBlock, tag_type::INGROUP );
+    }
+  }
+
+  return false;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the mainpage of the documentation (or NULL).
+// *****************************************************************************
+
+const escrido::CPageMainpage* escrido::CDocumentation::FindMainpage() const
+{
+  for( size_t p = 0; p < this->paDocPageList.size(); p++ )
+    if( this->paDocPageList[p]->GetIdentSym() == symbol::MAINPAGE )
+      return static_cast<const CPageMainpage*>( this->paDocPageList[p] );
+
+  return NULL;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Deletes the last page registered because it was filtered out.
+// *****************************************************************************
+
+void escrido::CDocumentation::DropBack()
+{
+  delete paDocPageList.back();
+  paDocPageList.pop_back();
+
+  nDroppedPageN++;
+}
+
 // -----------------------------------------------------------------------------
 
 // FUNCTIONS IMPLEMENTATION
@@ -2269,6 +2883,9 @@ bool escrido::ReadTemp( const std::string& sTemplateDir_i,
 ///             if file sFileName_i could be found.
 /// \param[out] sTemplateData_o
 ///             This string returns the final content of the template file.
+/// \param[in]  fOutput_i
+///             Flag whether the use of the alternative file is reported on
+///             the console.
 ///
 /// \return     'true' if the template file or the alternative template file
 ///             could be loaded, 'false' otherwise.
@@ -2277,7 +2894,8 @@ bool escrido::ReadTemp( const std::string& sTemplateDir_i,
 bool escrido::ReadTemp( const std::string& sTemplateDir_i,
                         const std::string& sFileName_i,
                         const std::string& sFallbackFileName_i,
-                        std::string& sTemplateData_o )
+                        std::string& sTemplateData_o,
+                        bool fOutput_i )
 {
   // Try opening the template file.
   std::ifstream oInFile( sTemplateDir_i + sFileName_i, std::ifstream::in | std::ifstream::binary );
@@ -2290,7 +2908,7 @@ bool escrido::ReadTemp( const std::string& sTemplateDir_i,
       std::cerr << "cannot load template files '" << sTemplateDir_i + sFileName_i << "' or '" << sTemplateDir_i + sFallbackFileName_i << "' - skipping page" << std::endl;
       return false;
     }
-    else
+    else if( fOutput_i )
       std::cout << "(template file '" << sTemplateDir_i + sFallbackFileName_i << "')";
   }
 
@@ -2320,6 +2938,8 @@ void escrido::WriteOutput( const std::string& sFileName_i,
 
   // Write template data.
   oOutFile.write( sTemplateData_i.data(), sTemplateData_i.size() );
+  if( oOutFile.good() )
+    oRunStats.nBytesWritten += sTemplateData_i.size();
 
   oOutFile.close();
 }
@@ -2434,7 +3054,7 @@ void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
 
 void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
                                   const CDocPage& oPage_i,
-                                  void (CDocPage::*WriteMethod_i)( std::ostream&, const SWriteInfo& ) const,
+                                  void (CDocPage::*WriteMethod_i)( outbuf::COutBuffer&, const SWriteInfo& ) const,
                                   const SWriteInfo& oWriteInfo_i,
                                   std::string& sTemplateData_io )
 {
@@ -2442,15 +3062,17 @@ void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
   size_t nReplPos = sTemplateData_io.find( szPlaceholder_i );
   if( nReplPos != std::string::npos )
   {
+    CTraceSpan oTraceSpan( "placeholder", szPlaceholder_i );
+
     // Check for indentation counter adjustment.
     AdjustReplaceIndent( nReplPos, sTemplateData_io, oWriteInfo_i );
 
     // Create replacement string.
-    std::stringstream sReplacement;
-    ( oPage_i.*WriteMethod_i )( sReplacement, oWriteInfo_i );
+    outbuf::COutBuffer oReplacement;
+    ( oPage_i.*WriteMethod_i )( oReplacement, oWriteInfo_i );
 
     // Replace all occurrences of the placeholder by the replacement string.
-    ReplacePlaceholder( szPlaceholder_i, sReplacement.str(), sTemplateData_io );
+    ReplacePlaceholder( szPlaceholder_i, oReplacement.str(), sTemplateData_io );
   }
 }
 
@@ -2481,7 +3103,7 @@ void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
 
 void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
                                   const CDocPage& oPage_i,
-                                  void (CDocPage::*WriteMethod_i)( tag_type, std::ostream&, const SWriteInfo& ) const,
+                                  void (CDocPage::*WriteMethod_i)( tag_type, outbuf::COutBuffer&, const SWriteInfo& ) const,
                                   tag_type fTagType_i,
                                   const SWriteInfo& oWriteInfo_i,
                                   std::string& sTemplateData_io )
@@ -2490,15 +3112,17 @@ void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
   size_t nReplPos = sTemplateData_io.find( szPlaceholder_i );
   if( nReplPos != std::string::npos )
   {
+    CTraceSpan oTraceSpan( "placeholder", szPlaceholder_i );
+
     // Check for indentation counter adjustment.
     AdjustReplaceIndent( nReplPos, sTemplateData_io, oWriteInfo_i );
 
     // Create replacement string.
-    std::stringstream sReplacement;
-    ( oPage_i.*WriteMethod_i )( fTagType_i, sReplacement, oWriteInfo_i );
+    outbuf::COutBuffer oReplacement;
+    ( oPage_i.*WriteMethod_i )( fTagType_i, oReplacement, oWriteInfo_i );
 
     // Replace all occurrences of the placeholder by the replacement string.
-    ReplacePlaceholder( szPlaceholder_i, sReplacement.str(), sTemplateData_io );
+    ReplacePlaceholder( szPlaceholder_i, oReplacement.str(), sTemplateData_io );
   }
 }
 
@@ -2532,7 +3156,7 @@ void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
 
 void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
                                   const CDocPage& oPage_i,
-                                  void (CDocPage::*WriteMethod_i)( tag_type, const std::string&, std::ostream&, const SWriteInfo& ) const,
+                                  void (CDocPage::*WriteMethod_i)( tag_type, const std::string&, outbuf::COutBuffer&, const SWriteInfo& ) const,
                                   tag_type fTagType_i,
                                   const std::string& sIdentifier_i,
                                   const SWriteInfo& oWriteInfo_i,
@@ -2542,15 +3166,17 @@ void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
   size_t nReplPos = sTemplateData_io.find( szPlaceholder_i );
   if( nReplPos != std::string::npos )
   {
+    CTraceSpan oTraceSpan( "placeholder", szPlaceholder_i );
+
     // Check for indentation counter adjustment.
     AdjustReplaceIndent( nReplPos, sTemplateData_io, oWriteInfo_i );
 
     // Create replacement string.
-    std::stringstream sReplacement;
-    ( oPage_i.*WriteMethod_i )( fTagType_i, sIdentifier_i, sReplacement, oWriteInfo_i );
+    outbuf::COutBuffer oReplacement;
+    ( oPage_i.*WriteMethod_i )( fTagType_i, sIdentifier_i, oReplacement, oWriteInfo_i );
 
     // Replace all occurrences of the placeholder by the replacement string.
-    ReplacePlaceholder( szPlaceholder_i, sReplacement.str(), sTemplateData_io );
+    ReplacePlaceholder( szPlaceholder_i, oReplacement.str(), sTemplateData_io );
   }
 }
 
@@ -2581,7 +3207,7 @@ void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
 
 void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
                                   const CDocumentation& oDocumentation_i,
-                                  void (CDocumentation::*WriteMethod_i)( const CDocPage*, std::ostream&, const SWriteInfo& ) const,
+                                  void (CDocumentation::*WriteMethod_i)( const CDocPage*, outbuf::COutBuffer&, const SWriteInfo& ) const,
                                   const CDocPage* pPage_i,
                                   const SWriteInfo& oWriteInfo_i,
                                   std::string& sTemplateData_io )
@@ -2590,15 +3216,17 @@ void escrido::ReplacePlaceholder( const char* szPlaceholder_i,
   size_t nReplPos = sTemplateData_io.find( szPlaceholder_i );
   if( nReplPos != std::string::npos )
   {
+    CTraceSpan oTraceSpan( "placeholder", szPlaceholder_i );
+
     // Check for indentation counter adjustment.
     AdjustReplaceIndent( nReplPos, sTemplateData_io, oWriteInfo_i );
 
     // Create replacement string.
-    std::stringstream sReplacement;
-    ( oDocumentation_i.*WriteMethod_i )( pPage_i, sReplacement, oWriteInfo_i );
+    outbuf::COutBuffer oReplacement;
+    ( oDocumentation_i.*WriteMethod_i )( pPage_i, oReplacement, oWriteInfo_i );
 
     // Replace all occurrences of the placeholder by the replacement string.
-    ReplacePlaceholder( szPlaceholder_i, sReplacement.str(), sTemplateData_io );
+    ReplacePlaceholder( szPlaceholder_i, oReplacement.str(), sTemplateData_io );
   }
 }
 
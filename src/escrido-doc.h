@@ -20,7 +20,9 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>   // std::unordered_map
 
+#include "symtable.h"
 #include "reftable.h"
 #include "content-unit.h"
 
@@ -66,6 +68,12 @@
 //                           *                   *
 //                           *********************
 
+// *********************
+// *                   *
+// *    SParseEvent    *
+// *                   *
+// *********************
+
 // *********************
 // *                   *
 // *  CDocumentation   *
@@ -82,6 +90,7 @@ namespace escrido
   class CDocPage;            // Basic documentation page. Parent class of all pages.
   class CPageMainpage;       // Documentation main page class.
   class CRefPage;            // Documentation page for the reference to an object (function, data type etc.).
+  struct SParseEvent;        // A recorded call of the parser into the documentation.
   class CDocumentation;      // A complete documentation.
 }
 
@@ -93,24 +102,20 @@ namespace escrido
 
 namespace escrido
 {
-  // Parser state types:
-  enum headline_parse_state : unsigned char
-  {
-    START,
-    PAGETYPE,
-    PAGETYPE_DQUOTED,
-    POST_PAGETYPE,
-    IDENTIFIER,
-    POST_IDENT,
-    TITLE
-  };
-
   /// Search index encoding.
   enum class search_index_encoding
   {
     JSON,
     JS
   };
+
+  /// Types of recorded parse events.
+  enum class parse_event_type : unsigned char
+  {
+    NEW_PAGE,       ///< A new page was opened (sText: page type tag).
+    HEADLINE,       ///< The headline of the page was parsed (sText: headline).
+    CONTENT_UNIT    ///< A content unit was pushed (oContUnit).
+  };
 }
 
 // -----------------------------------------------------------------------------
@@ -128,7 +133,8 @@ namespace escrido
   bool ReadTemp( const std::string& sTemplateDir_i,
                  const std::string& sFileName_i,
                  const std::string& sFallbackFileName_i,
-                 std::string& sTemplateData_o );
+                 std::string& sTemplateData_o,
+                 bool fOutput_i = true );
   void WriteOutput( const std::string& sFileName_i,
                     const std::string& sTemplateData_i );
 
@@ -141,25 +147,25 @@ namespace escrido
                            std::string& sTemplateData_io );
   void ReplacePlaceholder( const char* szPlaceholder_i,
                            const CDocPage& oPage_i,
-                           void (CDocPage::*WriteMethod_i)( std::ostream&, const SWriteInfo& ) const,
+                           void (CDocPage::*WriteMethod_i)( outbuf::COutBuffer&, const SWriteInfo& ) const,
                            const SWriteInfo& oWriteInfo_i,
                            std::string& sTemplateData_io );
   void ReplacePlaceholder( const char* szPlaceholder_i,
                            const CDocPage& oPage_i,
-                           void (CDocPage::*WriteMethod_i)( tag_type, std::ostream&, const SWriteInfo& ) const,
+                           void (CDocPage::*WriteMethod_i)( tag_type, outbuf::COutBuffer&, const SWriteInfo& ) const,
                            tag_type fTagType_i,
                            const SWriteInfo& oWriteInfo_i,
                            std::string& sTemplateData_io );
   void ReplacePlaceholder( const char* szPlaceholder_i,
                            const CDocPage& oPage_i,
-                           void (CDocPage::*WriteMethod_i)( tag_type, const std::string&, std::ostream&, const SWriteInfo& ) const,
+                           void (CDocPage::*WriteMethod_i)( tag_type, const std::string&, outbuf::COutBuffer&, const SWriteInfo& ) const,
                            tag_type fTagType_i,
                            const std::string& sIdentifier_i,
                            const SWriteInfo& oWriteInfo_i,
                            std::string& sTemplateData_io );
   void ReplacePlaceholder( const char* szPlaceholder_i,
                            const CDocumentation& oDocumentation_i,
-                           void (CDocumentation::*WriteMethod_i)( const CDocPage*, std::ostream&, const SWriteInfo& ) const,
+                           void (CDocumentation::*WriteMethod_i)( const CDocPage*, outbuf::COutBuffer&, const SWriteInfo& ) const,
                            const CDocPage* pPage_i,
                            const SWriteInfo& oWriteInfo_i,
                            std::string& sTemplateData_io );
@@ -179,12 +185,26 @@ class escrido::CGroupNode
 {
   public:
 
+    /// The pages of one page type within the group (in navigation order).
+    struct SPageTypeBucket
+    {
+      symbol_id nPageTypeID;              ///< Page type identifier (symbol).
+      std::string sPageTypeLit;           ///< Literal form of the page type name.
+      std::vector <size_t> anDocPageIdxList; ///< Indices of the pages (in the documentation page list).
+    };
+
     const std::string sGroupName;
     std::vector <size_t> naDocPageIdxList;
 
   private:
 
     std::vector <CGroupNode*> apChildNodeList;
+    symbol_id nGroupName;                 ///< Group name (symbol; NONE for the root).
+    std::unordered_map <symbol_id, CGroupNode*>
+      oChildNodeMap;                      ///< Child nodes by group name (symbol).
+    std::vector <SPageTypeBucket>
+      aoPageTypeBucketList;               ///< Pages by page type ("mainpage", "page", then in order of appearance).
+    size_t nFlatIdx;                      ///< Index in the flattened group list of the tree.
 
   public:
 
@@ -193,11 +213,17 @@ class escrido::CGroupNode
     ~CGroupNode();
 
     // Child node managment:
-    CGroupNode* AddChildGroup( const std::string& sGroupName_i );
-    CGroupNode* GetChildGroup( const std::string& sGroupName_i ) const;
+    CGroupNode* AddChildGroup( const std::string& sGroupName_i, CSymbolTable& oSymbolTable_io );
+    CGroupNode* GetChildGroup( const std::string& sGroupName_i, const CSymbolTable& oSymbolTable_i ) const;
     void Clear();
     void Order( const std::vector <CDocPage*>& apDocPageList_i,
-                const std::vector <std::string>& asRefList_i );
+                const std::vector <std::string>& asRefList_i,
+                const CSymbolTable& oSymbolTable_i );
+    const std::vector <SPageTypeBucket>& GetPageTypeBuckets() const;
+
+  private:
+
+    void FillPageTypeBuckets( const std::vector <CDocPage*>& apDocPageList_i );
 
   friend class CGroupTree;
 };
@@ -215,27 +241,45 @@ class escrido::CGroupNode
 
 class escrido::CGroupTree
 {
+  public:
+
+    /// Entry of the flattened group list (the group nodes in pre-order).
+    struct SFlatNode
+    {
+      const CGroupNode* pNode;            ///< The group node.
+      size_t nLvl;                        ///< Nesting level (0: root).
+      size_t nParentIdx;                  ///< List index of the parent node (npos for the root).
+      size_t nSubtreeEnd;                 ///< List index behind the last node of the subtree.
+    };
+
   private:
 
     const std::vector <CDocPage*>& apDocPageList;
 
     CGroupNode oRoot;
     size_t nMaxLvl;
+    std::vector <SFlatNode> aoFlatList;   ///< Group nodes in pre-order (see Flatten()).
 
   public:
 
     // Constructor:
     CGroupTree( const std::vector <CDocPage*>& apDocPageList_i );
 
-    void Update();
+    void Update( CSymbolTable& oSymbolTable_io );
     void Clear();
-    void Order( const std::vector <std::string>& asRefList_i );
+    void Order( const std::vector <std::string>& asRefList_i, const CSymbolTable& oSymbolTable_i );
 
     // Group access:
     const CGroupNode* FirstGroupNode( size_t& nLvl_o ) const;
     const CGroupNode* NextGroupNode( const CGroupNode* pLast_i, size_t& nLvl_o ) const;
+    const std::vector <SFlatNode>& GetFlatList() const;
+    size_t GetFlatIdx( const CGroupNode* pGroup_i ) const;
     size_t MaxLvl() const;
     std::vector <std::string> GetGroupNames( const CGroupNode* pGroup_i ) const;
+
+  private:
+
+    void Flatten();
 };
 
 // -----------------------------------------------------------------------------
@@ -299,29 +343,35 @@ class escrido::CDocPage
     std::string sIdent;            ///< The page identifier (as given in the headline).
     std::string sTitle;            ///< The page title (as given in the headline).
 
-    // Head line parsing state:
-    headline_parse_state fState;   ///< State for parsing headline.
+    // Interned page type and identifier (see InternSymbols()):
+    symbol_id nPageTypeID;         ///< Page type identifier (symbol).
+    symbol_id nIdent;              ///< Page identifier (symbol).
 
     // Content related:
     CContentUnit oContUnit;        ///< The documentation page's content unit.
 
   public:
 
-    // Constructor:
+    // Constructor and destructor:
     CDocPage();
     CDocPage( const char* szPageTypeLit_i,
               const char* szPageTypeID_i,
-              const char* szIdent_i,
-              headline_parse_state fState_i );
+              const char* szIdent_i );
+    virtual ~CDocPage();
 
     // Appending of content (while parsing):
     void AppendContentUnit( const CContentUnit& oContUnit_i );
 
+    // Headline parsing:
+    virtual void ParseHeadline( const char* pHeadline_i, size_t nLen_i );
+
     // Methods for accessing selected content:
-    virtual void AppendHeadlineChar( const char cIdentChar_i );
-    const std::string GetPageTypeLit() const;
-    const std::string GetPageTypeID() const;
+    const std::string& GetPageTypeLit() const;
+    const std::string& GetPageTypeID() const;
     const std::string& GetIdent() const;
+    symbol_id GetPageTypeSym() const;
+    symbol_id GetIdentSym() const;
+    void InternSymbols( CSymbolTable& oSymbolTable_io );
     const std::string& GetTitle() const;
     const CContentUnit& GetContentUnit() const;
     const std::string  GetBrief() const;
@@ -337,18 +387,18 @@ class escrido::CDocPage
     // Output method:
     virtual const std::string GetURL( const std::string& sOutputPostfix_i ) const;
 
-    void WriteHTMLMetaDataList( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLHeadline( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLParSectDet( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTagBlock( tag_type fTagType_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTagBlock( tag_type fTagType_i, const std::string& sIdentifier_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTagBlockList( tag_type fTagType_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLMetaDataList( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLHeadline( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLParSectDet( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLTagBlock( tag_type fTagType_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLTagBlock( tag_type fTagType_i, const std::string& sIdentifier_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteHTMLTagBlockList( tag_type fTagType_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
 
-    void WriteLaTeXHeadline( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXParSectDet( std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXTagBlock( tag_type fTagType_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXTagBlock( tag_type fTagType_i, const std::string& sIdentifier_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
-    void WriteLaTeXTagBlockList( tag_type fTagType_i, std::ostream& oOutStrm_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXHeadline( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXParSectDet( outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXTagBlock( tag_type fTagType_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXTagBlock( tag_type fTagType_i, const std::string& sIdentifier_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
+    void WriteLaTeXTagBlockList( tag_type fTagType_i, outbuf::COutBuffer& oOutBuf_i, const SWriteInfo& oWriteInfo_i ) const;
 
     // Appending to reference table:
     void AddToRefTable( CRefTable& oRefTable_o, const std::string& sOutputPostfix_i ) const;
@@ -377,6 +427,9 @@ class escrido::CPageMainpage : public CDocPage
     // Constructor, destructor:
     CPageMainpage();
 
+    // Headline parsing:
+    virtual void ParseHeadline( const char* pHeadline_i, size_t nLen_i );
+
     // Methods for accessing selected content:
 
     // Output method:
@@ -401,15 +454,32 @@ class escrido::CRefPage : public CDocPage
     // Constructor, destructor:
     CRefPage();
 
-    // Methods for accessing selected content:
-    virtual void AppendHeadlineChar( const char cIdentChar_i );
+    // Headline parsing:
+    virtual void ParseHeadline( const char* pHeadline_i, size_t nLen_i );
 
     // Output method:
     virtual const std::string GetURL( const std::string& sOutputPostfix_i ) const;
+};
 
-  private:
+// -----------------------------------------------------------------------------
+
+// STRUCT SParseEvent
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      A recorded call of the parser into the documentation.
+///
+/// \details    The sequence of events of a file can be replayed into a
+///             documentation without parsing the file again (see
+///             \ref CDocumentation::Replay()).
+// *****************************************************************************
 
-    void BuildPageTypeID();
+struct escrido::SParseEvent
+{
+  parse_event_type fType;     ///< Type of the event.
+  std::string      sText;     ///< Page type or headline characters.
+  CContentUnit     oContUnit; ///< Pushed content unit.
 };
 
 // -----------------------------------------------------------------------------
@@ -427,6 +497,9 @@ class escrido::CDocumentation
   private:
 
     std::vector <CDocPage*> paDocPageList; ///< List of all documentation pages contained.
+    bool fPageOwner;                       ///< Flag whether the pages are owned (and deleted) by this object.
+    CSymbolTable oSymbolTable;             ///< Symbol table of the pages (unused by a view).
+    CSymbolTable* pSymbolTable;            ///< Symbol table in use (a view uses the one of its documentation).
 
     mutable bool fGroupOrdered;            ///< Flag whether a group ordering is available for the documentation pages.
     mutable CGroupTree oGroupTree;         ///< Container for ordering of groups.
@@ -435,6 +508,18 @@ class escrido::CDocumentation
     mutable std::vector <size_t>
       anNavOrderPageIdxList;               ///< List of indices of paDocPageList in equal order as for the navigation.
 
+    std::vector <std::string>
+      saParseNSWhiteList;                  ///< White list of namespaces applied during parsing.
+    std::vector <std::string>
+      saParseGroupBlackList;               ///< Black list of groups applied during parsing.
+    bool fBackClosed;                      ///< Flag whether the last page registered is complete (see CloseDocPage()).
+    bool fBackDropped;                     ///< Flag whether the page being parsed has been dropped by the filters.
+    bool fBackNSKnown;                     ///< Flag whether the first namespace of the page being parsed has been found.
+    size_t nDroppedPageN;                  ///< Number of pages dropped by the filters during parsing.
+
+    std::vector <SParseEvent>*
+      paParseRecord;                       ///< List the parse events are recorded into (NULL: no recording).
+
   public:
 
     // Constructor, desctructor:
@@ -442,31 +527,65 @@ class escrido::CDocumentation
     ~CDocumentation();
 
     // Content managment (used during parsing):
+    void SetParseFilters( const std::vector<std::string>& saNSWhiteList_i,
+                          const std::vector<std::string>& saGroupBlackList_i );
     void PushContentUnit( const CContentUnit& oContUnit_i );
-    void NewDocPage( const char* szDocPageType_i );
+    void NewDocPage( const char* szDocPageType_i, bool fOutput_i = true );
+    void AppendHeadline( const char* szHeadline_i );
+    void CloseDocPage();
     CDocPage* Back();
+    size_t GetDroppedPageN() const;
+    void CountContent( size_t& nPageN_o, size_t& nBlockN_o, size_t& nChunkN_o ) const;
+    void Clear();
+
+    // Recording and replay of parse events:
+    void SetParseRecord( std::vector<SParseEvent>* paParseRecord_i );
+    std::vector<SParseEvent>* GetParseRecord() const;
+    void Replay( const std::vector<SParseEvent>& oaParseRecord_i );
 
     // Methods for accessing selected content:
     const std::vector <std::string> GetFeatureNames() const;
+    size_t GetDocPageN() const;
+    const CDocPage& GetDocPage( size_t nPageIdx_i ) const;
+    CSymbolTable& GetSymbolTable() const;
 
     // Special methods:
     void RemoveNamespaces( const std::vector<std::string>& saNSWhiteList_i );
     void RemoveGroups( const std::vector<std::string>& saGroupBlackList_i );
+    void CreateView( const std::vector<std::string>& saNSWhiteList_i,
+                     const std::vector<std::string>& saGroupBlackList_i,
+                     CDocumentation& oView_o ) const;
 
-    // Creation of reference table inside the write info object.
+    // Creation of reference table:
     void CreateRefTable( const std::string& sOutputPostfix_i,
-                         SWriteInfo& oWriteInfo_io ) const;
+                         CRefTable& oRefTable_o ) const;
+    void ResolveRefs( const CRefTable& oRefTable_i,
+                      std::vector<std::pair<std::string, std::string>>& asUnresolved_o ) const;
 
     // Output methods:
     void WriteHTMLDoc( const std::string& sTemplateDir_i,
                        const std::string& sOutputDir_i,
                        const std::string& sOutputPostfix_i,
-                       const SWriteInfo& oWriteInfo_i ) const;
+                       const SWriteInfo& oWriteInfo_i,
+                       const std::vector<bool>& faPageSelect_i = std::vector<bool>() ) const;
+    bool GetHTMLPage( const std::string& sURL_i,
+                      const std::string& sTemplateDir_i,
+                      const std::string& sOutputPostfix_i,
+                      const SWriteInfo& oWriteInfo_i,
+                      std::string& sPage_o ) const;
     void WriteHTMLSearchIndex( const std::string& sOutputDir_i,
                                const std::string& sOutputPath_i,
                                const std::string& sOutputPostfix_i,
                                const SWriteInfo& oWriteInfo_i,
                                const search_index_encoding fEncoding_i ) const;
+    void WriteHTMLSearchIndex( outbuf::COutBuffer& oOutBuf_i,
+                               const std::string& sOutputPostfix_i,
+                               const SWriteInfo& oWriteInfo_i,
+                               const search_index_encoding fEncoding_i ) const;
+    void WriteHTMLSearchIndex( std::ostream& oOutStrm_i,
+                               const std::string& sOutputPostfix_i,
+                               const SWriteInfo& oWriteInfo_i,
+                               const search_index_encoding fEncoding_i ) const;
     void WriteLaTeXDoc( const std::string& sTemplateDir_i,
                         const std::string& sOutputDir_i,
                         const SWriteInfo& oWriteInfo_i ) const;
@@ -477,23 +596,35 @@ class escrido::CDocumentation
   private:
 
     // Helper functions:
+    const CPageMainpage* FindMainpage() const;
+    bool BuildHTMLPage( const CDocPage* pPage_i,
+                        const CPageMainpage* pMainpage_i,
+                        const std::vector<std::string>& aoFeatureNames_i,
+                        const std::string& sTemplateDir_i,
+                        const SWriteInfo& oWriteInfo_i,
+                        std::string& sPage_o ) const;
     void WriteHTMLTableOfContent( const CDocPage* pWritePage_i,
-                                  std::ostream& oOutStrm_i,
+                                  outbuf::COutBuffer& oOutBuf_i,
                                   const SWriteInfo& oWriteInfo_i ) const;
-    void WriteHTMLTOCPageType( const CGroupNode& oGroup_i,
-                               const std::string& sPageTypeID_i,
+    void WriteHTMLTOCPageType( const CGroupNode::SPageTypeBucket& oBucket_i,
                                const CDocPage* pWritePage_i,
-                               std::ostream& oOutStrm_i,
+                               outbuf::COutBuffer& oOutBuf_i,
                                const SWriteInfo& oWriteInfo_i ) const;
     void WriteHTMLPaginatorURLPrev( const CDocPage* pWritePage_i,
-                                     std::ostream& oOutStrm_i,
+                                     outbuf::COutBuffer& oOutBuf_i,
                                      const SWriteInfo& oWriteInfo_i ) const;
     void WriteHTMLPaginatorURLNext( const CDocPage* pWritePage_i,
-                                     std::ostream& oOutStrm_i,
+                                     outbuf::COutBuffer& oOutBuf_i,
                                      const SWriteInfo& oWriteInfo_i ) const;
 
     std::string CleanAndJSONEscape( const std::string& sText_i ) const;
 
+    bool IsFilteredOut( const CDocPage* pDocPage_i,
+                        const std::vector<std::string>& saNSWhiteList_i,
+                        const std::vector<std::string>& saGroupBlackList_i ) const;
+    bool IsFilteredOut( const CContentUnit& oContUnit_i );
+    void DropBack();
+
     void FillGroupTreeOrdered() const;
     void FillNavOrderList() const;
 };
@@ -0,0 +1,331 @@
+// -----------------------------------------------------------------------------
+/// \file       html2latex.cpp
+///
+/// \brief      Module implementation file for the conversion of HTML content
+///             into LaTeX content in Escrido.
+// -----------------------------------------------------------------------------
+
+#include "html2latex.h"
+
+#include <algorithm>        // std::lower_bound
+
+// -----------------------------------------------------------------------------
+
+// CLASS CLaTeXConverter
+
+// -----------------------------------------------------------------------------
+
+/// Constructs a converter without rules.
+escrido::CLaTeXConverter::CLaTeXConverter()
+{
+  this->Clear();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Adds the built-in conversion rules (with lower precedence than
+///             the rules added before).
+// *****************************************************************************
+
+void escrido::CLaTeXConverter::AddDefaultRules()
+{
+  // Keep order of the exchange rules from high to low precedence:
+
+  // Very special commands:
+  this->AddRule( "LaTeX", "{\\LaTeX}" );
+
+  // HTML specific commands:
+  this->AddRule( "<HR>", "\\noindent\\rule{\\textwidth}{0.4pt} " );
+  this->AddRule( "<em>", "\\textit{" );
+  this->AddRule( "</em>", "}" );
+  this->AddRule( "<b>", "\\textbf{" );
+  this->AddRule( "</b>", "}" );
+  this->AddRule( "<sup>", "$^\\textrm{\\footnotesize " );
+  this->AddRule( "</sup>", "}$" );
+  this->AddRule( "<sub>", "$_\\textrm{\\footnotesize " );
+  this->AddRule( "</sub>", "}$" );
+
+  // HTML entities:
+  this->AddRule( "&amp;", "\\&" );
+  this->AddRule( "&gamma;", "$\\gamma$" );
+  this->AddRule( "&#42;", "*" );
+  this->AddRule( "&#124;", "{\\textbar}" );
+  this->AddRule( "&#47;", "/" );
+  this->AddRule( "&#64;", "@" );
+  this->AddRule( "&lt;", "{\\textless}" );
+  this->AddRule( "&gt;", "{\\textgreater}" );
+  this->AddRule( "&#8477;", "$\\mathbb{R}$" );
+
+  // Avoid certain LaTeX ligatures:
+  this->AddRule( "--", "-{}-" );
+
+  // Characters:
+  this->AddRule( "\\", "\\\\" );
+  this->AddRule( "$", "\\$" );
+  this->AddRule( "%", "\\%" );
+  this->AddRule( "_", "\\_" );
+  this->AddRule( "{", "\\{" );
+  this->AddRule( "}", "\\}" );
+  this->AddRule( "[", "{[}" );
+  this->AddRule( "]", "{]}" );
+  this->AddRule( "&", "\\&" );
+  this->AddRule( "#", "\\#" );
+  this->AddRule( "^", "{\\textasciicircum}" );
+  this->AddRule( "´", "'" );
+  this->AddRule( "°", "{\\textdegree}" );
+  this->AddRule( "|", "{\\textbar}" );
+  this->AddRule( "<", "{\\textless}" );
+  this->AddRule( ">", "{\\textgreater}" );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Adds a rule with lower precedence than all rules added before.
+///
+/// \details    If a rule with the same pattern exists already, the new rule is
+///             never applied. Empty patterns are ignored.
+///
+/// \param[in]  sPattern_i
+///             The text that is replaced.
+/// \param[in]  sReplacement_i
+///             The text it is replaced by.
+// *****************************************************************************
+
+void escrido::CLaTeXConverter::AddRule( const std::string& sPattern_i, const std::string& sReplacement_i )
+{
+  if( sPattern_i.empty() )
+    return;
+
+  const uint32_t nRuleIdx = static_cast<uint32_t>( aoRuleList.size() );
+  aoRuleList.push_back( SRule{ sPattern_i, sReplacement_i } );
+
+  // Insert the pattern into the trie: the first byte via the dispatch table,
+  // all further bytes via the edges of the nodes.
+  const unsigned char nFirst = static_cast<unsigned char>( sPattern_i[0] );
+  if( anFirstByteNode[nFirst] == NO_NODE )
+  {
+    anFirstByteNode[nFirst] = static_cast<uint32_t>( aoNodeList.size() );
+    aoNodeList.push_back( STrieNode{ {}, NO_RULE } );
+  }
+  uint32_t nNode = anFirstByteNode[nFirst];
+
+  for( size_t c = 1; c < sPattern_i.size(); ++c )
+  {
+    const unsigned char nByte = static_cast<unsigned char>( sPattern_i[c] );
+    std::vector <std::pair<unsigned char, uint32_t>>& aoEdgeList = aoNodeList[nNode].aoEdgeList;
+    std::vector <std::pair<unsigned char, uint32_t>>::iterator iEdge =
+      std::lower_bound( aoEdgeList.begin(), aoEdgeList.end(), std::make_pair( nByte, uint32_t( 0 ) ) );
+
+    if( iEdge != aoEdgeList.end() && iEdge->first == nByte )
+      nNode = iEdge->second;
+    else
+    {
+      const uint32_t nNewNode = static_cast<uint32_t>( aoNodeList.size() );
+      aoEdgeList.insert( iEdge, std::make_pair( nByte, nNewNode ) );
+      aoNodeList.push_back( STrieNode{ {}, NO_RULE } );
+      nNode = nNewNode;
+    }
+  }
+
+  if( aoNodeList[nNode].nRuleIdx == NO_RULE )
+    aoNodeList[nNode].nRuleIdx = nRuleIdx;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Adds the rules of a rule definition text (e.g. the content of a
+///             template file) with lower precedence than the rules added
+///             before.
+///
+/// \details    Each line contains a pattern and its replacement, separated by
+///             whitespaces. Values that contain whitespaces or start with a
+///             hash mark are enclosed by quotation marks (" or '). Empty lines
+///             and lines starting with a hash mark are ignored.
+///
+/// \return     std::string::npos on success or the number of the line
+///             (starting with 1) in which an error occurred first. The rules
+///             of the lines in front of it are added.
+// *****************************************************************************
+
+size_t escrido::CLaTeXConverter::ParseRules( const std::string& sRules_i )
+{
+  size_t nLine = 0;
+  for( size_t nPos = 0; nPos < sRules_i.size(); )
+  {
+    // Extract the next line.
+    size_t nEnd = sRules_i.find( '\n', nPos );
+    if( nEnd == std::string::npos )
+      nEnd = sRules_i.size();
+    const std::string sLine = sRules_i.substr( nPos, nEnd - nPos );
+    nPos = nEnd + 1;
+    nLine++;
+
+    // Split the line into values.
+    std::vector <std::string> asValueList;
+    bool fComment = false;
+    for( size_t c = 0; c < sLine.size(); )
+    {
+      const char cChar = sLine[c];
+      if( cChar == ' ' || cChar == '\t' || cChar == '\r' )
+      {
+        ++c;
+        continue;
+      }
+
+      if( cChar == '#' && asValueList.empty() )
+      {
+        fComment = true;
+        break;
+      }
+
+      if( cChar == '"' || cChar == '\'' )
+      {
+        // => The value is encapsulated within quotation marks.
+        const size_t nClose = sLine.find( cChar, c + 1 );
+        if( nClose == std::string::npos )
+          return nLine;
+        asValueList.push_back( sLine.substr( c + 1, nClose - c - 1 ) );
+        c = nClose + 1;
+      }
+      else
+      {
+        const size_t nValueEnd = sLine.find_first_of( " \t\r", c );
+        asValueList.push_back( sLine.substr( c, nValueEnd == std::string::npos ? std::string::npos : nValueEnd - c ) );
+        c = ( nValueEnd == std::string::npos ? sLine.size() : nValueEnd );
+      }
+    }
+
+    if( fComment || asValueList.empty() )
+      continue;
+
+    if( asValueList.size() != 2 || asValueList[0].empty() )
+      return nLine;
+
+    this->AddRule( asValueList[0], asValueList[1] );
+  }
+
+  return std::string::npos;
+}
+
+// .............................................................................
+
+/// Returns the number of rules.
+size_t escrido::CLaTeXConverter::GetRuleN() const
+{
+  return aoRuleList.size();
+}
+
+// .............................................................................
+
+/// Removes all rules.
+void escrido::CLaTeXConverter::Clear()
+{
+  aoRuleList.clear();
+  aoNodeList.assign( 1, STrieNode{ {}, NO_RULE } );
+  for( size_t b = 0; b < 256; ++b )
+    anFirstByteNode[b] = NO_NODE;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Converts a text and appends the result to an output buffer.
+///
+/// \param[in]  pText_i
+///             The text.
+/// \param[in]  nLen_i
+///             Length of the text.
+/// \param[in]  oOutBuf_i
+///             The output buffer.
+// *****************************************************************************
+
+void escrido::CLaTeXConverter::Convert( const char* pText_i, size_t nLen_i, outbuf::COutBuffer& oOutBuf_i ) const
+{
+  size_t nCopyStart = 0;
+  for( size_t nPos = 0; nPos < nLen_i; )
+  {
+    uint32_t nNode = anFirstByteNode[static_cast<unsigned char>( pText_i[nPos] )];
+    if( nNode == NO_NODE )
+    {
+      ++nPos;
+      continue;
+    }
+
+    // Follow the trie as far as the text matches and keep the matching rule
+    // of highest precedence.
+    uint32_t nBestRuleIdx = NO_RULE;
+    size_t nBestLen = 0;
+    for( size_t nEnd = nPos + 1; ; ++nEnd )
+    {
+      const STrieNode& oNode = aoNodeList[nNode];
+      if( oNode.nRuleIdx < nBestRuleIdx )
+      {
+        nBestRuleIdx = oNode.nRuleIdx;
+        nBestLen = nEnd - nPos;
+      }
+
+      if( nEnd == nLen_i || oNode.aoEdgeList.empty() )
+        break;
+
+      const unsigned char nByte = static_cast<unsigned char>( pText_i[nEnd] );
+      nNode = NO_NODE;
+      for( size_t e = 0; e < oNode.aoEdgeList.size() && oNode.aoEdgeList[e].first <= nByte; ++e )
+        if( oNode.aoEdgeList[e].first == nByte )
+        {
+          nNode = oNode.aoEdgeList[e].second;
+          break;
+        }
+      if( nNode == NO_NODE )
+        break;
+    }
+
+    if( nBestRuleIdx == NO_RULE )
+    {
+      ++nPos;
+      continue;
+    }
+
+    // Copy the unmatched text in front of the pattern and the replacement.
+    oOutBuf_i.append( pText_i + nCopyStart, nPos - nCopyStart );
+    oOutBuf_i.append( aoRuleList[nBestRuleIdx].sReplacement );
+    nPos += nBestLen;
+    nCopyStart = nPos;
+  }
+
+  oOutBuf_i.append( pText_i + nCopyStart, nLen_i - nCopyStart );
+}
+
+// .............................................................................
+
+/// Converts a text and appends the result to an output buffer.
+void escrido::CLaTeXConverter::Convert( const std::string& sText_i, outbuf::COutBuffer& oOutBuf_i ) const
+{
+  this->Convert( sText_i.data(), sText_i.size(), oOutBuf_i );
+}
+
+// .............................................................................
+
+/// Converts a text and returns the result.
+std::string escrido::CLaTeXConverter::Convert( const std::string& sText_i ) const
+{
+  outbuf::COutBuffer oOutBuf;
+  this->Convert( sText_i.data(), sText_i.size(), oOutBuf );
+  return oOutBuf.str();
+}
+
+// .............................................................................
+
+/// Returns a converter with the built-in rules only.
+const escrido::CLaTeXConverter& escrido::CLaTeXConverter::GetDefault()
+{
+  static const CLaTeXConverter oDefault = []()
+  {
+    CLaTeXConverter oConverter;
+    oConverter.AddDefaultRules();
+    return oConverter;
+  }();
+  return oDefault;
+}
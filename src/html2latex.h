@@ -0,0 +1,107 @@
+#ifndef HTML2LATEX_ALLREADY_READ_IN
+#define HTML2LATEX_ALLREADY_READ_IN
+
+// -----------------------------------------------------------------------------
+/// \file       html2latex.h
+///
+/// \brief      Module header for the conversion of HTML content into LaTeX
+///             content in Escrido.
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+#include <cstdint>          // uint32_t
+
+#include "outbuf.h"
+
+// -----------------------------------------------------------------------------
+
+// CLASSES OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+// *********************
+// *                   *
+// *  CLaTeXConverter  *
+// *                   *
+// *********************
+
+namespace escrido
+{
+  class CLaTeXConverter;
+}
+
+// -----------------------------------------------------------------------------
+
+// CLASS CLaTeXConverter
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      A set of replacement rules that converts HTML content into
+///             LaTeX content.
+///
+/// \details    The text is scanned once from left to right. At every position
+///             the rule of highest precedence (i.e. the rule that was added
+///             first) whose pattern matches is applied and scanning continues
+///             behind the matched pattern; replaced text is never scanned
+///             again. Characters that are not matched by any rule are copied.
+///
+///             The rules are compiled into a trie of their patterns. Its root
+///             is a dispatch table over the first byte, so characters that
+///             cannot start a pattern are copied without any comparison.
+// *****************************************************************************
+
+class escrido::CLaTeXConverter
+{
+  private:
+
+    /// Replacement rule.
+    struct SRule
+    {
+      std::string sPattern;                   ///< Text that is replaced.
+      std::string sReplacement;               ///< Text it is replaced by.
+    };
+
+    /// Trie node (one per pattern prefix).
+    struct STrieNode
+    {
+      std::vector <std::pair<unsigned char, uint32_t>>
+        aoEdgeList;                           ///< Child nodes by next byte (sorted by byte).
+      uint32_t nRuleIdx;                      ///< Index of the rule whose pattern ends here (NO_RULE: none).
+    };
+
+    static const uint32_t NO_NODE = 0;        ///< Dispatch table entry of bytes that start no pattern.
+    static const uint32_t NO_RULE = 0xFFFFFFFF; ///< Trie node without rule.
+
+    std::vector <SRule> aoRuleList;           ///< Rules in order of precedence.
+    std::vector <STrieNode> aoNodeList;       ///< Trie nodes (index 0: root).
+    uint32_t anFirstByteNode[256];            ///< Trie nodes of the first byte of the patterns (NO_NODE: none).
+
+  public:
+
+    // Constructor:
+    CLaTeXConverter();
+
+    // Rules:
+    void AddDefaultRules();
+    void AddRule( const std::string& sPattern_i, const std::string& sReplacement_i );
+    size_t ParseRules( const std::string& sRules_i );
+    size_t GetRuleN() const;
+    void Clear();
+
+    // Conversion:
+    void Convert( const char* pText_i, size_t nLen_i, outbuf::COutBuffer& oOutBuf_i ) const;
+    void Convert( const std::string& sText_i, outbuf::COutBuffer& oOutBuf_i ) const;
+    std::string Convert( const std::string& sText_i ) const;
+
+    static const CLaTeXConverter& GetDefault();
+};
+
+#endif /* HTML2LATEX_ALLREADY_READ_IN */
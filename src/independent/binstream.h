@@ -0,0 +1,93 @@
+#ifndef BINSTREAM_READ_ONCE
+#define BINSTREAM_READ_ONCE
+
+// *****************************************************************************
+/// \file       binstream.h
+///
+/// \brief      Provides functions for writing plain values and strings into a
+///             binary buffer and for reading them back with bounds checks.
+///
+/// \details    Values are stored in the byte order of the machine. The
+///             buffers are meant for caches on the same machine, not for
+///             exchange.
+// *****************************************************************************
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <cstring>           // memcpy()
+#include <cstdint>           // uint32_t
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+/// Binary buffer namespace.
+namespace binstream
+{
+  template <typename T> void Write( std::string& sBuffer_io, const T& oValue_i );
+  void WriteString( std::string& sBuffer_io, const std::string& sValue_i );
+
+  template <typename T> bool Read( const char*& pPos_io, const char* pEnd_i, T& oValue_o );
+  bool ReadString( const char*& pPos_io, const char* pEnd_i, std::string& sValue_o );
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS IMPLEMENTATION
+
+// -----------------------------------------------------------------------------
+
+/// Appends a plain value (integer, enum, bool) to a buffer.
+template <typename T>
+inline void binstream::Write( std::string& sBuffer_io, const T& oValue_i )
+{
+  sBuffer_io.append( reinterpret_cast<const char*>( &oValue_i ), sizeof( T ) );
+}
+
+// .............................................................................
+
+/// Appends a string (length and characters) to a buffer.
+inline void binstream::WriteString( std::string& sBuffer_io, const std::string& sValue_i )
+{
+  Write( sBuffer_io, static_cast<uint32_t>( sValue_i.size() ) );
+  sBuffer_io.append( sValue_i );
+}
+
+// .............................................................................
+
+/// Reads a plain value from a buffer position. Returns 'false' if the end of
+/// the buffer would be exceeded.
+template <typename T>
+inline bool binstream::Read( const char*& pPos_io, const char* pEnd_i, T& oValue_o )
+{
+  if( pEnd_i - pPos_io < static_cast<ptrdiff_t>( sizeof( T ) ) )
+    return false;
+
+  memcpy( &oValue_o, pPos_io, sizeof( T ) );
+  pPos_io += sizeof( T );
+  return true;
+}
+
+// .............................................................................
+
+/// Reads a string from a buffer position. Returns 'false' if the end of the
+/// buffer would be exceeded.
+inline bool binstream::ReadString( const char*& pPos_io, const char* pEnd_i, std::string& sValue_o )
+{
+  uint32_t nLen;
+  if( !Read( pPos_io, pEnd_i, nLen ) || static_cast<size_t>( pEnd_i - pPos_io ) < nLen )
+    return false;
+
+  sValue_o.assign( pPos_io, nLen );
+  pPos_io += nLen;
+  return true;
+}
+
+#endif /* BINSTREAM_READ_ONCE */
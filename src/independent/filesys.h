@@ -168,8 +168,10 @@ namespace filesys
   void ConcatPaths( const char* szCanonDir_i, const char* szCanonPath_i, std::string& sCanonOutPath_o );
 
   // Accessing files and directories on the drive:
-  bool GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o );
-  bool GetFilesInfo( const char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o );
+  bool GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o,
+                     unsigned int nThreadN_i = 1, const std::vector<std::string>& saExclude_i = std::vector<std::string>() );
+  bool GetFilesInfo( const char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o,
+                     unsigned int nThreadN_i = 1, const std::vector<std::string>& saExclude_i = std::vector<std::string>() );
 
   // Helper functions:
   char* strtoupper( char* szString_i );
@@ -950,6 +952,16 @@ inline void filesys::ConcatPaths( const char* szCanonDir_i, const char* szCanonP
 #include <fcntl.h>              // flock, fcntl()
 #include <ext/stdio_filebuf.h>  // __gnu_cxx::stdio_filebuf
 
+// GetFilesInfo(): directory reading (in parallel):
+#include <unistd.h>             // close()
+#include <sys/stat.h>           // fstatat()
+#include <thread>               // std::thread
+#include <atomic>               // std::atomic
+#include <algorithm>            // std::min
+#ifdef __linux__
+#include <sys/syscall.h>        // SYS_getdents64
+#endif
+
 // -----------------------------------------------------------------------------
 
 // UNIX: GLOBAL MACROS AND CONSTANTS
@@ -964,6 +976,33 @@ namespace filesys
 
 // -----------------------------------------------------------------------------
 
+// UNIX: INTERNAL TYPES AND FUNCTIONS
+
+// -----------------------------------------------------------------------------
+
+namespace filesys
+{
+  /// A directory item that matches a path section (see \ref ReadDirItems()).
+  struct SDirItem
+  {
+    std::string sName;      ///< Name of the item.
+    item_type   fItemType;  ///< Type of the item.
+    bool        fLink;      ///< Flag whether the item is a symbolic link.
+  };
+
+  bool ReadDirItems( const std::string& sDirPath_i, const char* szPattern_i,
+                     bool fWildcard_i, bool fLastSec_i,
+                     int (*pStrCmp_i)(const char*, const char*),
+                     const std::vector<std::string>& saExclude_i,
+                     int (*pExclCmp_i)(const char*, const char*),
+                     std::vector<SDirItem>& oaItem_o );
+  bool IsExcluded( const std::string& sDirPath_i, const char* szName_i,
+                   const std::vector<std::string>& saExclude_i,
+                   int (*pExclCmp_i)(const char*, const char*) );
+}
+
+// -----------------------------------------------------------------------------
+
 // UNIX: CLASS iflstream
 
 // -----------------------------------------------------------------------------
@@ -1602,6 +1641,229 @@ inline void filesys::oflstream::close()
 
 // -----------------------------------------------------------------------------
 
+// *****************************************************************************
+/// \brief      Reads the items of a directory that match a path section.
+///
+/// \details    On Linux, the directory entries are read in large blocks with
+///             the getdents64 system call. Other Unix systems use the POSIX
+///             readdir() function. The item type is taken from the d_type field
+///             of the directory entry. Only if the file system does not
+///             provide it, fstatat() is called relative to the open directory
+///             (and only for items whose name matches).
+///
+///             The items are returned in the order of the directory stream.
+///             The function is thread safe and is called in parallel by
+///             \ref GetFilesInfo().
+///
+/// \param[in]  sDirPath_i
+///             Path of the directory (ending with a slash).
+/// \param[in]  szPattern_i
+///             Path section that the item names are compared against.
+/// \param[in]  fWildcard_i
+///             Flag whether the path section contains wildcards.
+/// \param[in]  fLastSec_i
+///             Flag whether the path section is the last one. (Files are only
+///             matched in the last section.)
+/// \param[in]  pStrCmp_i
+///             Comparison function applied to the path section and the item
+///             names.
+/// \param[in]  saExclude_i
+///             List of exclude patterns (see \ref IsExcluded()).
+/// \param[in]  pExclCmp_i
+///             Comparison function applied to the exclude patterns.
+/// \param[out] oaItem_o
+///             List of matching items.
+///
+/// \return     'true' if the directory could be opened, 'false' otherwise.
+// *****************************************************************************
+
+inline bool filesys::ReadDirItems( const std::string& sDirPath_i, const char* szPattern_i,
+                                   bool fWildcard_i, bool fLastSec_i,
+                                   int (*pStrCmp_i)(const char*, const char*),
+                                   const std::vector<std::string>& saExclude_i,
+                                   int (*pExclCmp_i)(const char*, const char*),
+                                   std::vector<SDirItem>& oaItem_o )
+{
+  oaItem_o.clear();
+
+  // Classifies one directory entry and eventually adds it to the result list.
+  auto AddEntry = [&]( int nDirFd_i, const char* szName_i, unsigned char fDType_i )
+  {
+    // Skip items "." and ".." that may occur from wildcard evaluation.
+    if( fWildcard_i &&
+        ( strcmp( szName_i, "." ) == 0 ||
+          strcmp( szName_i, ".." ) == 0 ) )
+      return;
+
+    // Do the name comparison first to avoid any extra work on items that are
+    // not of interest.
+    if( pStrCmp_i( szPattern_i, szName_i ) != 0 )
+      return;
+
+    // Distinguish between directory-like items and file-like items.
+    // See http://man7.org/linux/man-pages/man3/readdir.3.html.
+    item_type fItemType;
+    switch( fDType_i )
+    {
+      // Directory.
+      case DT_DIR:
+        fItemType = item_type::DIRECTORY;
+        break;
+
+      // Symbolic link (treated as directory).
+      case DT_LNK:
+        fItemType = item_type::DIRECTORY;
+        break;
+
+      // Regular file.
+      case DT_REG:
+        fItemType = item_type::FILE;
+        break;
+
+      case DT_UNKNOWN:
+      {
+        // According to http://man7.org/linux/man-pages/man3/readdir.3.html
+        // not all file systems do support the d_type argument. The case of
+        // an unknown item type is checked by a stat call relative to the
+        // directory.
+        struct stat oStat;
+        if( fstatat( nDirFd_i, szName_i, &oStat, 0 ) == 0 && S_ISDIR( oStat.st_mode ) )
+          fItemType = item_type::DIRECTORY;
+        else
+          fItemType = item_type::FILE;
+        break;
+      }
+
+      // Block device, character device, named pipe (FIFO), UNIX domain socket.
+      default:
+        fItemType = item_type::OTHER;
+        break;
+    }
+
+    // Check whether the item shall be added to the result list.
+    // Add files only when this is the last path section.
+    if( ( fItemType == item_type::DIRECTORY ) ||
+        ( fItemType == item_type::FILE && fLastSec_i ) )
+      if( !IsExcluded( sDirPath_i, szName_i, saExclude_i, pExclCmp_i ) )
+      {
+        oaItem_o.resize( oaItem_o.size() + 1 );
+        oaItem_o.back().sName = szName_i;
+        oaItem_o.back().fItemType = fItemType;
+        oaItem_o.back().fLink = ( fDType_i == DT_LNK );
+      }
+  };
+
+#ifdef __linux__
+
+  // Layout of the records returned by the getdents64 system call.
+  struct SLinuxDirent64
+  {
+    unsigned long long d_ino;
+    long long          d_off;
+    unsigned short     d_reclen;
+    unsigned char      d_type;
+    char               d_name[1];
+  };
+
+  int nDirFd = open( sDirPath_i.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+  if( nDirFd < 0 )
+    return false;
+
+  // Read the directory entries block-wise.
+  alignas( 8 ) char aBuf[32768];
+  while( true )
+  {
+    long nRead = syscall( SYS_getdents64, nDirFd, aBuf, sizeof( aBuf ) );
+    if( nRead <= 0 )
+      break;
+
+    for( long nOff = 0; nOff < nRead; )
+    {
+      const SLinuxDirent64* pEntry = reinterpret_cast<const SLinuxDirent64*>( aBuf + nOff );
+      AddEntry( nDirFd, pEntry->d_name, pEntry->d_type );
+      nOff += pEntry->d_reclen;
+    }
+  }
+
+  close( nDirFd );
+  return true;
+
+#else
+
+  DIR* pDir = opendir( sDirPath_i.c_str() );
+  if( pDir == NULL )
+    return false;
+
+  // (readdir() is thread safe as long as the directory stream is not shared.)
+  struct dirent* pEntry;
+  while( ( pEntry = readdir( pDir ) ) != NULL )
+    AddEntry( dirfd( pDir ), pEntry->d_name, pEntry->d_type );
+
+  closedir( pDir );
+  return true;
+
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Checks whether a directory item matches one of the exclude
+///             patterns.
+///
+/// \details    Patterns without a slash are compared against the item name
+///             only (e.g. ".git" or "*_gen.h"). Patterns with a slash are
+///             compared against the complete path of the item in canonical
+///             form (e.g. "src/vendor" or "/usr/src/build*"). Wildcards may be
+///             used in both forms.
+///
+/// \param[in]  sDirPath_i
+///             Path of the directory (ending with a slash) that holds the item.
+/// \param[in]  szName_i
+///             Name of the item.
+/// \param[in]  saExclude_i
+///             List of exclude patterns.
+/// \param[in]  pExclCmp_i
+///             Comparison function applied to the patterns.
+///
+/// \return     'true' if the item is excluded, 'false' otherwise.
+// *****************************************************************************
+
+inline bool filesys::IsExcluded( const std::string& sDirPath_i, const char* szName_i,
+                                 const std::vector<std::string>& saExclude_i,
+                                 int (*pExclCmp_i)(const char*, const char*) )
+{
+  std::string sPath;
+  for( size_t e = 0; e < saExclude_i.size(); e++ )
+  {
+    if( saExclude_i[e].find( '/' ) == std::string::npos )
+    {
+      if( pExclCmp_i( saExclude_i[e].c_str(), szName_i ) == 0 )
+        return true;
+    }
+    else
+    {
+      // Create the canonical path of the item on first demand (i.e. w/o
+      // a leading "./").
+      if( sPath.empty() )
+      {
+        if( sDirPath_i.compare( 0, 2, "./" ) == 0 )
+          sPath.assign( sDirPath_i, 2, std::string::npos );
+        else
+          sPath = sDirPath_i;
+        sPath += szName_i;
+      }
+
+      if( pExclCmp_i( saExclude_i[e].c_str(), sPath.c_str() ) == 0 )
+        return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
 // *****************************************************************************
 /// \brief      Evaluates a canonical path (that may include wildcards) into a
 ///             list of accessible files or directories that exist on the drive.
@@ -1610,6 +1872,16 @@ inline void filesys::oflstream::close()
 ///             given (absolute or relative) path exist on the file system and
 ///             whether they are accessible.
 ///
+///             Items that match one of the exclude patterns are dropped as soon
+///             as they are found. Excluded directories are therefore never
+///             opened.
+///
+///             The path is evaluated section by section. All directories that
+///             match up to the current section are independent of each other
+///             and can be read by several threads in parallel. The results are
+///             merged in a fixed order afterwards, i.e. the result list is
+///             independent of the number of threads.
+///
 /// \remark     The function is mainly used for expanding paths that include
 ///             wildcards. Since it cycles through each directories entries, it
 ///             is rather slow. For checking if a file exists and is accessible
@@ -1624,6 +1896,9 @@ inline void filesys::oflstream::close()
 ///             - * : Match any number of unknown characters (regardless of
 ///                   the position where it appears, including at the start
 ///                   and/or multiple times)
+///             - ** : As complete path section: match the directory itself
+///                    and all of its subdirectories at any depth (symbolic
+///                    links are not followed)
 ///             Note that the string is changed by the function.
 /// \param[in]  fCaseType_i
 ///             Flag what letter case convention is used for matching the
@@ -1639,26 +1914,62 @@ inline void filesys::oflstream::close()
 ///             matching the canonical path name. If one element was found to
 ///             match the canonical path exactly (amongst other that only match
 ///             with respect to case insensitivity), it is placed at position 0.
+/// \param[in]  nThreadN_i
+///             Maximum number of threads used for reading directories. A value
+///             of 0 uses the number of hardware threads.
+/// \param[in]  saExclude_i
+///             List of exclude patterns (see \ref IsExcluded()).
 ///
 /// \return     'true' if any file or directory element was found, 'false'
 ///             if no such element exists.
 // *****************************************************************************
 
-inline bool filesys::GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o )
+inline bool filesys::GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o,
+                                   unsigned int nThreadN_i, const std::vector<std::string>& saExclude_i )
 {
   // Eventually reset case sensitivity flag.
   if( fCaseType_i == case_type::OS_CONVENTION )
     fCaseType_i = case_type::CASE_SENSITIVE;
 
-  // Variables of types from <dirent.h>.
-  DIR *pDir, *pCheckDir;
-  struct dirent oEntry;
-  struct dirent* pResult;
+  // Eventually set the number of threads.
+  if( nThreadN_i == 0 )
+    nThreadN_i = std::max( 1u, std::thread::hardware_concurrency() );
 
   // Pointers to the comparison functions (as used and case sensitive version).
   int (*pStrCmp)(const char*, const char*);
   int (*pStrCmpCaseSensitive)(const char*, const char*);
 
+  // Pointer to the comparison function of the exclude patterns.
+  int (*pExclCmp)(const char*, const char*) =
+    ( fCaseType_i == case_type::CASE_SENSITIVE ) ? &strglobcmp : &strtoupperglobcmp;
+
+  // Reads the matching items of the stack elements [nBeg_i, nEnd_i). The stack
+  // elements are distributed over the threads by a shared counter.
+  auto ReadStackDirs = [&]( size_t nBeg_i, size_t nEnd_i,
+                            const char* szPattern_i, bool fWildcard_i, bool fLastSec_i,
+                            int (*pStrCmp_i)(const char*, const char*),
+                            std::vector< std::vector<SDirItem> >& oaaItem_o )
+  {
+    oaaItem_o.resize( nEnd_i - nBeg_i );
+
+    std::atomic<size_t> nNext( nBeg_i );
+    auto ReadWorker = [&]()
+    {
+      for( size_t s = nNext++; s < nEnd_i; s = nNext++ )
+        if( oaFileInfo_o[s].fMatch )
+          ReadDirItems( oaFileInfo_o[s].sPath, szPattern_i, fWildcard_i, fLastSec_i, pStrCmp_i,
+                        saExclude_i, pExclCmp, oaaItem_o[s - nBeg_i] );
+    };
+
+    const size_t nThreadN = std::min<size_t>( nThreadN_i, nEnd_i - nBeg_i );
+    std::vector<std::thread> oaThread;
+    for( size_t t = 1; t < nThreadN; t++ )
+      oaThread.emplace_back( ReadWorker );
+    ReadWorker();
+    for( size_t t = 0; t < oaThread.size(); t++ )
+      oaThread[t].join();
+  };
+
   // Split cursors.
   char* pBeg = szCanonPath_i;
   char* pEnd;
@@ -1696,6 +2007,45 @@ inline bool filesys::GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, s
     fLastSec = ( *pEnd == '\0' );
     *pEnd = '\0';
 
+    // Recursive wildcard section: keep all elements of the stack and add all
+    // of their subdirectories level by level.
+    if( strcmp( pBeg, "**" ) == 0 )
+    {
+      size_t nLevelBeg = 0;
+      size_t nLevelEnd = oaFileInfo_o.size();
+      while( nLevelBeg < nLevelEnd )
+      {
+        std::vector< std::vector<SDirItem> > oaaItem;
+        ReadStackDirs( nLevelBeg, nLevelEnd, "*", true, false, &strglobcmp, oaaItem );
+
+        for( size_t s = nLevelBeg; s < nLevelEnd; s++ )
+        {
+          const std::vector<SDirItem>& oaItem = oaaItem[s - nLevelBeg];
+          for( size_t i = 0; i < oaItem.size(); i++ )
+            if( oaItem[i].fItemType == item_type::DIRECTORY && !oaItem[i].fLink )
+            {
+              // => Append new element to the stack.
+              SFileInfo oSubDir = oaFileInfo_o[s];
+              oSubDir.sPath += oaItem[i].sName;
+              oSubDir.sPath.push_back( '/' );
+              oaFileInfo_o.push_back( oSubDir );
+            }
+        }
+
+        nLevelBeg = nLevelEnd;
+        nLevelEnd = oaFileInfo_o.size();
+      }
+
+      // Break off or shift pBeg.
+      if( fLastSec )
+        break;
+      else
+      {
+        pBeg = pEnd + 1;
+        continue;
+      }
+    }
+
     // Check whether wildcards are involved in this section.
     bool fWildcard = ( strpbrk( pBeg, "?*" ) != NULL );
 
@@ -1731,9 +2081,14 @@ inline bool filesys::GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, s
       pStrCmpCaseSensitive = &strcmp;
     }
 
-    // Loop over all elements that are currently in the stack.
-    // The stack may get expanded during this process.
+    // Read the matching items of all directories that are currently in the
+    // stack.
     const size_t nStackN = oaFileInfo_o.size();
+    std::vector< std::vector<SDirItem> > oaaItem;
+    ReadStackDirs( 0, nStackN, pBeg, fWildcard, fLastSec, pStrCmp, oaaItem );
+
+    // Merge the items into the stack in stack order.
+    // The stack may get expanded during this process.
     for( size_t s = 0; s < nStackN; s++ )
       if( oaFileInfo_o[s].fMatch )
       {
@@ -1748,173 +2103,77 @@ inline bool filesys::GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, s
         // construction but it's more consistent to do it here.)
         path_type fBasePathType = oaFileInfo_o[s].fPathType;
 
-        // Open path section with POSIX "opendir()" function.
         bool fFirst = true;
-        if( ( pDir = opendir( oaFileInfo_o[s].sPath.c_str() ) ) )
+        for( size_t i = 0; i < oaaItem[s].size(); i++ )
         {
-          // Loop over all files within the path section.
-          // Use multithreading safe reenrent version of POSIX "readdir()".
-          while( readdir_r( pDir, &oEntry, &pResult ) == 0 )
+          const char* szName = oaaItem[s][i].sName.c_str();
+          const item_type fItemType = oaaItem[s][i].fItemType;
+
+          if( fFirst )
           {
-            // Break off if all items of the directory were read.
-            if( pResult == NULL )
-              break;
+            fFirst = false;
 
-            // Skip items "." and ".." that may occur from wildcard evaluation.
-            if( fWildcard &&
-                ( strcmp( oEntry.d_name, "." ) == 0 ||
-                  strcmp( oEntry.d_name, ".." ) == 0 ) )
-              continue;
+            // => Modify stack element s.
 
-            // Distinguish between directory-like items and file-like items.
-            // See http://man7.org/linux/man-pages/man3/readdir.3.html.
-            item_type fItemType;
-            switch( oEntry.d_type )
-            {
-              // Block device.
-              case DT_BLK:
-                fItemType = item_type::OTHER;
-                break;
+            // Append entry name and eventually a slash to the path.
+            oaFileInfo_o[s].sPath += szName;
+            if( fItemType == item_type::DIRECTORY )
+              oaFileInfo_o[s].sPath.push_back( '/' );
 
-              // Character device.
-              case DT_CHR:
-                fItemType = item_type::OTHER;
-                break;
+            // Set item type.
+            oaFileInfo_o[s].fItemType = fItemType;
 
-              // Directory.
-              case DT_DIR:
-                fItemType = item_type::DIRECTORY;
-                break;
+            // Check whether the path matches only case insensitively.
+            if( fCaseType_i == case_type::CASE_INSENSITIVE )
+              if( fBasePathMatchType == match_type::EXACT )
+                if( pStrCmpCaseSensitive( pBeg, szName ) != 0 )
+                  oaFileInfo_o[s].fMatchType = match_type::CASE_VAR;
+          }
+          else
+          {
+            // => Append new element to the stack.
+            oaFileInfo_o.resize( oaFileInfo_o.size() + 1 );
 
-              // Named pipe (FIFO).
-              case DT_FIFO:
-                fItemType = item_type::OTHER;
-                break;
+            // Set path name as combination of the base path plus the entry name.
+            oaFileInfo_o.back().sPath.assign( oaFileInfo_o[s].sPath, 0, nBasePathLen );
+            oaFileInfo_o.back().sPath += szName;
+            if( fItemType == item_type::DIRECTORY )
+              oaFileInfo_o.back().sPath += '/';
 
-              // Symbolic link (treated as directory).
-              case DT_LNK:
-                fItemType = item_type::DIRECTORY;
-                break;
+            // Set operating system dependent format type of the path.
+            oaFileInfo_o.back().fOSType = os::UNIX;
 
-              // Regular file.
-              case DT_REG:
-                fItemType = item_type::FILE;
-                break;
+            // Set path type.
+            oaFileInfo_o.back().fPathType = fBasePathType;
 
-              // UNIX domain socket.
-              case DT_SOCK:
-                fItemType = item_type::OTHER;
+            // Set item type.
+            oaFileInfo_o.back().fItemType = fItemType;
+
+            // Check whether the path matches exactly or only case insensitively.
+            switch( fCaseType_i )
+            {
+              case case_type::CASE_SENSITIVE:
+                oaFileInfo_o.back().fMatchType = match_type::EXACT;
                 break;
 
-              case DT_UNKNOWN:
+              case case_type::CASE_INSENSITIVE:
               {
-                // According to http://man7.org/linux/man-pages/man3/readdir.3.html
-                // not all file systems do support the d_type argument. The case of
-                // an unknown item type should therefore be checked as well.
+                if( fBasePathMatchType == match_type::EXACT )
                 {
-                  // Do an early name comparison here to avoid extra work of
-                  // creating extra the check path strings.
-                  if( pStrCmp( pBeg, oEntry.d_name ) == 0 )
-                  {
-                    // Create a full path string. To do this operation here will
-                    // slightly decrease the performance but it is only meant as
-                    // fallback solution for rare file systems. Optimize the
-                    // runtime performance of the function, if this block is
-                    // called often.
-                    std::string sCheckPath;
-                    sCheckPath.assign( oaFileInfo_o[s].sPath, 0, nBasePathLen );
-                    sCheckPath += oEntry.d_name;
-
-                    // Try opening the check path as directory.
-                    if( ( pCheckDir = opendir( sCheckPath.c_str() ) ) )
-                    {
-                      fItemType = item_type::DIRECTORY;
-                      closedir( pCheckDir );
-                    }
-                    else
-                      fItemType = item_type::FILE;
-                  }
+                  if( pStrCmpCaseSensitive( pBeg, szName ) == 0 )
+                    oaFileInfo_o.back().fMatchType = match_type::EXACT;
                   else
-                    // Use item type "OTHER" here for discriminating wrongly named paths.
-                    fItemType = item_type::OTHER;
+                    oaFileInfo_o.back().fMatchType = match_type::CASE_VAR;
                 }
+                else
+                  oaFileInfo_o.back().fMatchType = match_type::CASE_VAR;
                 break;
               }
             }
 
-            // Check whether the item shall be added to the result list.
-            // Add files only when this is the last path section.
-            if( ( fItemType == item_type::DIRECTORY ) ||
-                ( fItemType == item_type::FILE && fLastSec ) )
-              if( pStrCmp( pBeg, oEntry.d_name ) == 0 )
-                if( fFirst )
-                {
-                  fFirst = false;
-
-                  // => Modify stack element s.
-
-                  // Append entry name and eventually a slash to the path.
-                  oaFileInfo_o[s].sPath += oEntry.d_name;
-                  if( fItemType == item_type::DIRECTORY )
-                    oaFileInfo_o[s].sPath.push_back( '/' );
-
-                  // Set item type.
-                  oaFileInfo_o[s].fItemType = fItemType;
-
-                  // Check whether the path matches only case insensitively.
-                  if( fCaseType_i == case_type::CASE_INSENSITIVE )
-                    if( fBasePathMatchType == match_type::EXACT )
-                      if( pStrCmpCaseSensitive( pBeg, oEntry.d_name ) != 0 )
-                        oaFileInfo_o[s].fMatchType = match_type::CASE_VAR;
-                }
-                else
-                {
-                  // => Append new element to the stack.
-                  oaFileInfo_o.resize( oaFileInfo_o.size() + 1 );
-
-                  // Set path name as combination of the base path plus the entry name.
-                  oaFileInfo_o.back().sPath.assign( oaFileInfo_o[s].sPath, 0, nBasePathLen );
-                  oaFileInfo_o.back().sPath += oEntry.d_name;
-                  if( fItemType == item_type::DIRECTORY )
-                    oaFileInfo_o.back().sPath += '/';
-
-                  // Set operating system dependent format type of the path.
-                  oaFileInfo_o.back().fOSType = os::UNIX;
-
-                  // Set path type.
-                  oaFileInfo_o.back().fPathType = fBasePathType;
-
-                  // Set item type.
-                  oaFileInfo_o.back().fItemType = fItemType;
-
-                  // Check whether the path matches exactly or only case insensitively.
-                  switch( fCaseType_i )
-                  {
-                    case case_type::CASE_SENSITIVE:
-                      oaFileInfo_o.back().fMatchType = match_type::EXACT;
-                      break;
-
-                    case case_type::CASE_INSENSITIVE:
-                    {
-                      if( fBasePathMatchType == match_type::EXACT )
-                      {
-                        if( pStrCmpCaseSensitive( pBeg, oEntry.d_name ) == 0 )
-                          oaFileInfo_o.back().fMatchType = match_type::EXACT;
-                        else
-                          oaFileInfo_o.back().fMatchType = match_type::CASE_VAR;
-                      }
-                      else
-                        oaFileInfo_o.back().fMatchType = match_type::CASE_VAR;
-                      break;
-                    }
-                  }
-
-                  // Set match to true.
-                  oaFileInfo_o.back().fMatch = true;
-                }
+            // Set match to true.
+            oaFileInfo_o.back().fMatch = true;
           }
-
-          closedir( pDir );
         }
 
         // Check if the search returned any match and mark the stack
@@ -2205,12 +2464,18 @@ inline void filesys::oflstream::close()
 ///             matching the canonical path name. If one element was found to
 ///             match the canonical path exactly (amongst other that only match
 ///             with respect to case insensitivity), it is placed at position 0.
+/// \param[in]  nThreadN_i
+///             Ignored. (Directories are read serially on Windows.)
+/// \param[in]  saExclude_i
+///             Ignored. (Exclude patterns and recursive wildcards are not
+///             supported on Windows yet.)
 ///
 /// \return     'true' if any file or directory element was found, 'false'
 ///             if no such element exists.
 // *****************************************************************************
 
-inline bool filesys::GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o )
+inline bool filesys::GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o,
+                                   unsigned int nThreadN_i, const std::vector<std::string>& saExclude_i )
 {
   // Eventually reset case sensitivity flag.
   if( fCaseType_i == case_type::OS_CONVENTION )
@@ -2542,7 +2807,8 @@ inline bool filesys::GetFilesInfo( char* szCanonPath_i, case_type fCaseType_i, s
 ///             additional memory allocation and value duplication.
 // *****************************************************************************
 
-inline bool filesys::GetFilesInfo( const char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o )
+inline bool filesys::GetFilesInfo( const char* szCanonPath_i, case_type fCaseType_i, std::vector<SFileInfo>& oaFileInfo_o,
+                                   unsigned int nThreadN_i, const std::vector<std::string>& saExclude_i )
 {
   // Create a input string duplicate buffer string.
   const size_t nStrLen = strlen( szCanonPath_i );
@@ -2553,7 +2819,7 @@ inline bool filesys::GetFilesInfo( const char* szCanonPath_i, case_type fCaseTyp
   memcpy( pBuf, szCanonPath_i, nStrLen );
 
   // Call non-const argument version of GetFilesInfo().
-  bool fReturn = GetFilesInfo( pBuf, fCaseType_i, oaFileInfo_o );
+  bool fReturn = GetFilesInfo( pBuf, fCaseType_i, oaFileInfo_o, nThreadN_i, saExclude_i );
 
   // Free buffer memory and return.
   free( pBuf );
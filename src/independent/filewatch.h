@@ -0,0 +1,250 @@
+#ifndef FILEWATCH_READ_ONCE
+#define FILEWATCH_READ_ONCE
+
+// *****************************************************************************
+/// \file       filewatch.h
+///
+/// \brief      Provides a minimal abstraction layer for watching directories
+///             for file changes and for querying file modification stamps.
+///
+/// \details    On Linux the directories are watched by inotify. On other
+///             systems CWatcher::Wait() just sleeps for the timeout and
+///             reports a possible change, so that the caller falls back to
+///             polling the file stamps.
+// *****************************************************************************
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+#include <thread>            // std::this_thread::sleep_for
+#include <chrono>
+#include <sys/stat.h>        // stat()
+
+#ifdef __linux__
+#include <unistd.h>          // read(), close()
+#include <poll.h>            // poll()
+#include <sys/inotify.h>     // inotify_init1(), inotify_add_watch()
+#endif
+
+// -----------------------------------------------------------------------------
+
+// CLASSES OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+// *********************
+// *                   *
+// *     CWatcher      *
+// *                   *
+// *********************
+
+/// File watching namespace.
+namespace filewatch
+{
+  class CWatcher;
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+namespace filewatch
+{
+  bool GetFileStamp( const std::string& sPath_i, long long& nMTime_o, long long& nSize_o );
+}
+
+// -----------------------------------------------------------------------------
+
+// CLASS CWatcher
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Watches a set of directories for changes of the files inside.
+// *****************************************************************************
+
+class filewatch::CWatcher
+{
+  private:
+
+    int nFd;                                  ///< inotify file descriptor (-1: not initialized).
+    std::vector <std::string> asDirList;      ///< Directories watched.
+
+  public:
+
+    // Constructor, destructor:
+    CWatcher();
+    ~CWatcher();
+
+    // Watching:
+    bool Init();
+    bool AddDir( const std::string& sDirPath_i );
+    bool Wait( int nTimeoutMs_i, bool& fStructural_o );
+    bool IsNative() const;
+};
+
+// -----------------------------------------------------------------------------
+
+// CLASS CWatcher: IMPLEMENTATION
+
+// -----------------------------------------------------------------------------
+
+inline filewatch::CWatcher::CWatcher() :
+  nFd ( -1 )
+{}
+
+// .............................................................................
+
+inline filewatch::CWatcher::~CWatcher()
+{
+#ifdef __linux__
+  if( nFd >= 0 )
+    close( nFd );
+#endif
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Initializes the watcher.
+///
+/// \return     'true' if the directories can be watched by the operating
+///             system, 'false' if the watcher falls back to polling.
+// *****************************************************************************
+
+inline bool filewatch::CWatcher::Init()
+{
+#ifdef __linux__
+  nFd = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+#endif
+  return nFd >= 0;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Adds a directory to the watch list. Directories that are
+///             already watched are ignored.
+///
+/// \return     'false' if the directory could not be watched, 'true'
+///             otherwise.
+// *****************************************************************************
+
+inline bool filewatch::CWatcher::AddDir( const std::string& sDirPath_i )
+{
+  for( size_t d = 0; d < asDirList.size(); d++ )
+    if( asDirList[d] == sDirPath_i )
+      return true;
+  asDirList.push_back( sDirPath_i );
+
+#ifdef __linux__
+  if( nFd >= 0 )
+    return inotify_add_watch( nFd, sDirPath_i.c_str(),
+                              IN_CLOSE_WRITE | IN_MODIFY | IN_ATTRIB |
+                              IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO ) >= 0;
+#endif
+  return true;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Waits for changes inside of the watched directories and
+///             consumes all pending events.
+///
+/// \param[in]  nTimeoutMs_i
+///             Maximal waiting time in milliseconds (-1: infinite).
+/// \param[out] fStructural_o
+///             Returns whether files were created, deleted or moved, i.e.
+///             whether wildcard paths must be resolved again.
+///
+/// \return     'true' if there were (or may have been) changes, 'false' if
+///             the timeout elapsed without any event.
+// *****************************************************************************
+
+inline bool filewatch::CWatcher::Wait( int nTimeoutMs_i, bool& fStructural_o )
+{
+  fStructural_o = false;
+
+#ifdef __linux__
+  if( nFd >= 0 )
+  {
+    pollfd oPollFd;
+    oPollFd.fd = nFd;
+    oPollFd.events = POLLIN;
+    if( poll( &oPollFd, 1, nTimeoutMs_i ) <= 0 )
+      return false;
+
+    // Consume all events.
+    alignas( inotify_event ) char acBuffer[4096];
+    ssize_t nLen;
+    while( ( nLen = read( nFd, acBuffer, sizeof( acBuffer ) ) ) > 0 )
+      for( char* pPos = acBuffer; pPos < acBuffer + nLen; )
+      {
+        const inotify_event* pEvent = reinterpret_cast<const inotify_event*>( pPos );
+        if( pEvent->mask & ( IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_Q_OVERFLOW ) )
+          fStructural_o = true;
+        pPos += sizeof( inotify_event ) + pEvent->len;
+      }
+
+    return true;
+  }
+#endif
+
+  // Polling fallback: every timeout is a potential change.
+  std::this_thread::sleep_for( std::chrono::milliseconds( nTimeoutMs_i < 0 ? 1000 : nTimeoutMs_i ) );
+  fStructural_o = true;
+  return true;
+}
+
+// .............................................................................
+
+/// Returns whether the directories are watched by the operating system.
+inline bool filewatch::CWatcher::IsNative() const
+{
+  return nFd >= 0;
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS IMPLEMENTATION
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Retrieves the modification time and the size of a file.
+///
+/// \param[in]  sPath_i
+///             Path of the file.
+/// \param[out] nMTime_o
+///             Modification time (in nanoseconds, if available).
+/// \param[out] nSize_o
+///             Size of the file in bytes.
+///
+/// \return     'true' if the file exists, 'false' otherwise.
+// *****************************************************************************
+
+inline bool filewatch::GetFileStamp( const std::string& sPath_i, long long& nMTime_o, long long& nSize_o )
+{
+  struct stat oStat;
+  if( stat( sPath_i.c_str(), &oStat ) != 0 )
+    return false;
+
+#ifdef __linux__
+  nMTime_o = static_cast<long long>( oStat.st_mtim.tv_sec ) * 1000000000LL + oStat.st_mtim.tv_nsec;
+#else
+  nMTime_o = static_cast<long long>( oStat.st_mtime ) * 1000000000LL;
+#endif
+  nSize_o = static_cast<long long>( oStat.st_size );
+
+  return true;
+}
+
+#endif /* FILEWATCH_READ_ONCE */
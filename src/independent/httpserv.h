@@ -0,0 +1,378 @@
+#ifndef HTTPSERV_READ_ONCE
+#define HTTPSERV_READ_ONCE
+
+// *****************************************************************************
+/// \file       httpserv.h
+///
+/// \brief      Provides a minimal single-threaded HTTP/1.0 server on the local
+///             loopback interface (for previews).
+///
+/// \details    Only GET and HEAD requests are supported. Every connection
+///             serves a single request and is closed afterwards. The server is
+///             available on POSIX systems only; on other systems
+///             CServer::Open() fails.
+// *****************************************************************************
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <cstring>           // memset()
+#include <cctype>            // isxdigit()
+#include <cerrno>            // errno, EINTR
+
+#ifndef _WIN32
+#include <unistd.h>          // close(), read()
+#include <poll.h>            // poll()
+#include <netinet/in.h>      // sockaddr_in
+#include <arpa/inet.h>       // htons(), htonl()
+#include <sys/socket.h>      // socket(), bind(), listen(), accept(), send()
+#endif
+
+// -----------------------------------------------------------------------------
+
+// CLASSES OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+// *********************
+// *                   *
+// *     SRequest      *
+// *                   *
+// *********************
+
+// *********************
+// *                   *
+// *      CServer      *
+// *                   *
+// *********************
+
+/// HTTP server namespace.
+namespace httpserv
+{
+  struct SRequest;
+  class CServer;
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+namespace httpserv
+{
+  const char* GetContentType( const std::string& sPath_i );
+  std::string URLDecode( const std::string& sText_i );
+}
+
+// -----------------------------------------------------------------------------
+
+// STRUCT SRequest
+
+// -----------------------------------------------------------------------------
+
+/// A received request.
+struct httpserv::SRequest
+{
+  int         nConn;      ///< Connection socket (-1: no request).
+  std::string sMethod;    ///< Request method, e.g. "GET".
+  std::string sPath;      ///< Decoded request path without query string, e.g. "/index.html".
+};
+
+// -----------------------------------------------------------------------------
+
+// CLASS CServer
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Listening socket of the server.
+// *****************************************************************************
+
+class httpserv::CServer
+{
+  private:
+
+    int nFd;                          ///< Listening socket (-1: not open).
+
+  public:
+
+    // Constructor, destructor:
+    CServer();
+    ~CServer();
+
+    // Serving:
+    bool Open( unsigned short nPort_i );
+    bool Accept( int nTimeoutMs_i, SRequest& oRequest_o );
+    void Respond( SRequest& oRequest_io,
+                  int nStatus_i,
+                  const char* szContentType_i,
+                  const std::string& sBody_i ) const;
+};
+
+// -----------------------------------------------------------------------------
+
+// CLASS CServer: IMPLEMENTATION
+
+// -----------------------------------------------------------------------------
+
+inline httpserv::CServer::CServer() :
+  nFd ( -1 )
+{}
+
+// .............................................................................
+
+inline httpserv::CServer::~CServer()
+{
+#ifndef _WIN32
+  if( nFd >= 0 )
+    close( nFd );
+#endif
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Opens the listening socket on the loopback interface.
+///
+/// \param[in]  nPort_i
+///             TCP port.
+///
+/// \return     'true' on success, 'false' otherwise.
+// *****************************************************************************
+
+inline bool httpserv::CServer::Open( unsigned short nPort_i )
+{
+#ifndef _WIN32
+  nFd = socket( AF_INET, SOCK_STREAM, 0 );
+  if( nFd < 0 )
+    return false;
+
+  int nReuse = 1;
+  setsockopt( nFd, SOL_SOCKET, SO_REUSEADDR, &nReuse, sizeof( nReuse ) );
+
+  sockaddr_in oAddr;
+  memset( &oAddr, 0, sizeof( oAddr ) );
+  oAddr.sin_family = AF_INET;
+  oAddr.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+  oAddr.sin_port = htons( nPort_i );
+
+  if( bind( nFd, reinterpret_cast<sockaddr*>( &oAddr ), sizeof( oAddr ) ) != 0 ||
+      listen( nFd, 16 ) != 0 )
+  {
+    close( nFd );
+    nFd = -1;
+    return false;
+  }
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Waits for a request.
+///
+/// \param[in]  nTimeoutMs_i
+///             Maximal waiting time in milliseconds.
+/// \param[out] oRequest_o
+///             Returns the request. The request must be answered by
+///             \ref Respond().
+///
+/// \return     'true' if a request was received, 'false' otherwise.
+// *****************************************************************************
+
+inline bool httpserv::CServer::Accept( int nTimeoutMs_i, SRequest& oRequest_o )
+{
+  oRequest_o.nConn = -1;
+
+#ifndef _WIN32
+  pollfd oPollFd;
+  oPollFd.fd = nFd;
+  oPollFd.events = POLLIN;
+  if( poll( &oPollFd, 1, nTimeoutMs_i ) <= 0 )
+    return false;
+
+  const int nConn = accept( nFd, NULL, NULL );
+  if( nConn < 0 )
+    return false;
+
+#ifdef SO_NOSIGPIPE
+  // No SIGPIPE if the client closes the connection early (systems without
+  // MSG_NOSIGNAL, see Respond()).
+  int nNoSigPipe = 1;
+  setsockopt( nConn, SOL_SOCKET, SO_NOSIGPIPE, &nNoSigPipe, sizeof( nNoSigPipe ) );
+#endif
+
+  // Read the request head (the request line is sufficient).
+  std::string sHead;
+  char acBuffer[2048];
+  while( sHead.find( "\r\n" ) == std::string::npos && sHead.size() < 8192 )
+  {
+    oPollFd.fd = nConn;
+    if( poll( &oPollFd, 1, 2000 ) <= 0 )
+      break;
+    const ssize_t nLen = read( nConn, acBuffer, sizeof( acBuffer ) );
+    if( nLen <= 0 )
+      break;
+    sHead.append( acBuffer, nLen );
+  }
+
+  // Parse the request line: METHOD PATH VERSION
+  const size_t nLineEnd = sHead.find( "\r\n" );
+  const size_t nSep1 = sHead.find( ' ' );
+  const size_t nSep2 = ( nSep1 == std::string::npos ? std::string::npos : sHead.find( ' ', nSep1 + 1 ) );
+  if( nLineEnd == std::string::npos || nSep2 == std::string::npos || nSep2 > nLineEnd )
+  {
+    close( nConn );
+    return false;
+  }
+
+  oRequest_o.nConn = nConn;
+  oRequest_o.sMethod = sHead.substr( 0, nSep1 );
+  oRequest_o.sPath = sHead.substr( nSep1 + 1, nSep2 - nSep1 - 1 );
+  const size_t nQueryPos = oRequest_o.sPath.find_first_of( "?#" );
+  if( nQueryPos != std::string::npos )
+    oRequest_o.sPath.resize( nQueryPos );
+  oRequest_o.sPath = URLDecode( oRequest_o.sPath );
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Sends the response to a request and closes the connection.
+///
+/// \details    If the client closed the connection already (e.g. a cancelled
+///             reload of the browser), the rest of the response is discarded.
+///
+/// \param[in,out] oRequest_io
+///             The request.
+/// \param[in]  nStatus_i
+///             HTTP status code (200, 400, 404 or 405).
+/// \param[in]  szContentType_i
+///             Content type of the body.
+/// \param[in]  sBody_i
+///             The body.
+// *****************************************************************************
+
+inline void httpserv::CServer::Respond( SRequest& oRequest_io,
+                                       int nStatus_i,
+                                       const char* szContentType_i,
+                                       const std::string& sBody_i ) const
+{
+#ifndef _WIN32
+  if( oRequest_io.nConn < 0 )
+    return;
+
+  const char* szStatus = "200 OK";
+  switch( nStatus_i )
+  {
+    case 400: szStatus = "400 Bad Request"; break;
+    case 404: szStatus = "404 Not Found"; break;
+    case 405: szStatus = "405 Method Not Allowed"; break;
+  }
+
+  std::string sResponse = std::string( "HTTP/1.0 " ) + szStatus + "\r\n" +
+                          "Content-Type: " + szContentType_i + "\r\n" +
+                          "Content-Length: " + std::to_string( sBody_i.size() ) + "\r\n" +
+                          "Cache-Control: no-cache\r\n" +
+                          "Connection: close\r\n\r\n";
+  if( oRequest_io.sMethod != "HEAD" )
+    sResponse += sBody_i;
+
+#ifdef MSG_NOSIGNAL
+  const int nSendFlags = MSG_NOSIGNAL;   // EPIPE instead of SIGPIPE on a closed connection.
+#else
+  const int nSendFlags = 0;
+#endif
+
+  const char* pPos = sResponse.data();
+  size_t nRemain = sResponse.size();
+  while( nRemain > 0 )
+  {
+    const ssize_t nLen = send( oRequest_io.nConn, pPos, nRemain, nSendFlags );
+    if( nLen < 0 && errno == EINTR )
+      continue;
+    if( nLen <= 0 )
+      break;                             // Connection closed by the client (EPIPE etc.).
+    pPos += nLen;
+    nRemain -= nLen;
+  }
+
+  close( oRequest_io.nConn );
+  oRequest_io.nConn = -1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS IMPLEMENTATION
+
+// -----------------------------------------------------------------------------
+
+/// Returns the content type of a file by its file ending.
+inline const char* httpserv::GetContentType( const std::string& sPath_i )
+{
+  static const char* const aszTypeList[][2] =
+  {
+    { ".html", "text/html; charset=utf-8" },
+    { ".htm",  "text/html; charset=utf-8" },
+    { ".css",  "text/css; charset=utf-8" },
+    { ".js",   "text/javascript; charset=utf-8" },
+    { ".json", "application/json" },
+    { ".svg",  "image/svg+xml" },
+    { ".png",  "image/png" },
+    { ".jpg",  "image/jpeg" },
+    { ".jpeg", "image/jpeg" },
+    { ".gif",  "image/gif" },
+    { ".ico",  "image/x-icon" },
+    { ".woff", "font/woff" },
+    { ".woff2","font/woff2" },
+    { ".txt",  "text/plain; charset=utf-8" }
+  };
+
+  const size_t nDotPos = sPath_i.rfind( '.' );
+  if( nDotPos != std::string::npos )
+    for( size_t t = 0; t < sizeof( aszTypeList ) / sizeof( aszTypeList[0] ); t++ )
+      if( sPath_i.compare( nDotPos, std::string::npos, aszTypeList[t][0] ) == 0 )
+        return aszTypeList[t][1];
+
+  return "application/octet-stream";
+}
+
+// .............................................................................
+
+/// Decodes percent-encoded characters of an URL path.
+inline std::string httpserv::URLDecode( const std::string& sText_i )
+{
+  std::string sResult;
+  sResult.reserve( sText_i.size() );
+  for( size_t c = 0; c < sText_i.size(); c++ )
+  {
+    if( sText_i[c] == '%' && c + 2 < sText_i.size() &&
+        isxdigit( static_cast<unsigned char>( sText_i[c + 1] ) ) &&
+        isxdigit( static_cast<unsigned char>( sText_i[c + 2] ) ) )
+    {
+      sResult += static_cast<char>( std::stoi( sText_i.substr( c + 1, 2 ), NULL, 16 ) );
+      c += 2;
+    }
+    else
+      sResult += sText_i[c];
+  }
+
+  return sResult;
+}
+
+#endif /* HTTPSERV_READ_ONCE */
@@ -0,0 +1,366 @@
+#ifndef OUTBUF_READ_ONCE
+#define OUTBUF_READ_ONCE
+
+// *****************************************************************************
+/// \file       outbuf.h
+///
+/// \brief      Provides a lightweight append-only text output buffer as a
+///             fast replacement of std::ostream for document generation.
+///
+/// \details    Appending to a COutBuffer is a plain string append: there is no
+///             locale, no sentry object and no virtual stream buffer. Numbers
+///             are formatted like by a default std::ostream. Indentation is
+///             taken from a precomputed string of blanks.
+///
+///             For code that works on std::ostream objects the buffer can be
+///             attached to a stream (compatibility adapter): its content is
+///             then passed on to the stream whenever it exceeds a threshold,
+///             on Flush() and on destruction.
+// *****************************************************************************
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <cstring>           // strlen()
+#include <cstdio>            // snprintf()
+#include <ostream>           // std::ostream, std::endl, std::flush
+
+#include "strview.h"
+
+// -----------------------------------------------------------------------------
+
+// CLASSES OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+// *********************
+// *                   *
+// *    COutBuffer     *
+// *                   *
+// *********************
+
+/// Output buffer namespace.
+namespace outbuf
+{
+  class COutBuffer;
+}
+
+// -----------------------------------------------------------------------------
+
+// CLASS COutBuffer
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Append-only text output buffer.
+// *****************************************************************************
+
+class outbuf::COutBuffer
+{
+  private:
+
+    std::string sBuffer;                      ///< The buffered text.
+    std::ostream* pOutStrm;                   ///< Stream the text is passed on to (NULL: none).
+
+    static const size_t nFlushSize = 65536;   ///< Buffer size at which the text is passed on to the stream.
+
+  public:
+
+    // Constructors, destructor:
+    COutBuffer();
+    explicit COutBuffer( std::ostream& oOutStrm_i );
+    ~COutBuffer();
+    COutBuffer( const COutBuffer& ) = delete;
+    COutBuffer& operator=( const COutBuffer& ) = delete;
+
+    // Appending:
+    void append( const char* pData_i, size_t nLen_i );
+    void append( const char* szText_i );
+    void append( const std::string& sText_i );
+    void append( const strview::CStrView& sText_i );
+    void append( size_t nCount_i, char cChar_i );
+    void push_back( char cChar_i );
+    void indent( size_t nIndent_i );
+
+    COutBuffer& operator<<( const char* szText_i );
+    COutBuffer& operator<<( const std::string& sText_i );
+    COutBuffer& operator<<( const strview::CStrView& sText_i );
+    COutBuffer& operator<<( char cChar_i );
+    COutBuffer& operator<<( int nValue_i );
+    COutBuffer& operator<<( unsigned int nValue_i );
+    COutBuffer& operator<<( long nValue_i );
+    COutBuffer& operator<<( unsigned long nValue_i );
+    COutBuffer& operator<<( long long nValue_i );
+    COutBuffer& operator<<( unsigned long long nValue_i );
+    COutBuffer& operator<<( double dValue_i );
+    COutBuffer& operator<<( std::ostream& (*Manipulator_i)( std::ostream& ) );
+
+    // Access:
+    const std::string& str() const;
+    size_t size() const;
+    bool empty() const;
+    void clear();
+    void Flush();
+
+  private:
+
+    void AutoFlush();
+};
+
+// -----------------------------------------------------------------------------
+
+// CLASS COutBuffer IMPLEMENTATION
+
+// -----------------------------------------------------------------------------
+
+/// Constructs an empty buffer that collects the text (see str()).
+inline outbuf::COutBuffer::COutBuffer():
+  pOutStrm( NULL )
+{}
+
+// .............................................................................
+
+/// Constructs a buffer that passes its text on to a stream.
+inline outbuf::COutBuffer::COutBuffer( std::ostream& oOutStrm_i ):
+  pOutStrm( &oOutStrm_i )
+{
+  sBuffer.reserve( nFlushSize );
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer::~COutBuffer()
+{
+  this->Flush();
+}
+
+// .............................................................................
+
+/// Appends a character sequence of given length.
+inline void outbuf::COutBuffer::append( const char* pData_i, size_t nLen_i )
+{
+  sBuffer.append( pData_i, nLen_i );
+  this->AutoFlush();
+}
+
+// .............................................................................
+
+/// Appends a C string.
+inline void outbuf::COutBuffer::append( const char* szText_i )
+{
+  this->append( szText_i, strlen( szText_i ) );
+}
+
+// .............................................................................
+
+/// Appends a string.
+inline void outbuf::COutBuffer::append( const std::string& sText_i )
+{
+  this->append( sText_i.data(), sText_i.size() );
+}
+
+// .............................................................................
+
+/// Appends the characters of a string view.
+inline void outbuf::COutBuffer::append( const strview::CStrView& sText_i )
+{
+  this->append( sText_i.data(), sText_i.size() );
+}
+
+// .............................................................................
+
+/// Appends a character repeatedly.
+inline void outbuf::COutBuffer::append( size_t nCount_i, char cChar_i )
+{
+  sBuffer.append( nCount_i, cChar_i );
+  this->AutoFlush();
+}
+
+// .............................................................................
+
+/// Appends a single character.
+inline void outbuf::COutBuffer::push_back( char cChar_i )
+{
+  sBuffer.push_back( cChar_i );
+  this->AutoFlush();
+}
+
+// .............................................................................
+
+/// Appends an indentation of the given number of blanks.
+inline void outbuf::COutBuffer::indent( size_t nIndent_i )
+{
+  // Precomputed blanks; deeper indentations are appended piecewise.
+  static const char szBlanks[] = "                                                                ";
+  static const size_t nBlanksLen = sizeof( szBlanks ) - 1;
+
+  while( nIndent_i > nBlanksLen )
+  {
+    sBuffer.append( szBlanks, nBlanksLen );
+    nIndent_i -= nBlanksLen;
+  }
+  sBuffer.append( szBlanks, nIndent_i );
+  this->AutoFlush();
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( const char* szText_i )
+{
+  this->append( szText_i );
+  return *this;
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( const std::string& sText_i )
+{
+  this->append( sText_i );
+  return *this;
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( const strview::CStrView& sText_i )
+{
+  this->append( sText_i );
+  return *this;
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( char cChar_i )
+{
+  this->push_back( cChar_i );
+  return *this;
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( int nValue_i )
+{
+  return *this << static_cast<long long>( nValue_i );
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( unsigned int nValue_i )
+{
+  return *this << static_cast<unsigned long long>( nValue_i );
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( long nValue_i )
+{
+  return *this << static_cast<long long>( nValue_i );
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( unsigned long nValue_i )
+{
+  return *this << static_cast<unsigned long long>( nValue_i );
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( long long nValue_i )
+{
+  char szNum[24];
+  const int nLen = snprintf( szNum, sizeof( szNum ), "%lld", nValue_i );
+  this->append( szNum, nLen );
+  return *this;
+}
+
+// .............................................................................
+
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( unsigned long long nValue_i )
+{
+  char szNum[24];
+  const int nLen = snprintf( szNum, sizeof( szNum ), "%llu", nValue_i );
+  this->append( szNum, nLen );
+  return *this;
+}
+
+// .............................................................................
+
+/// Appends a floating point number formatted like by a default std::ostream
+/// (six significant digits).
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( double dValue_i )
+{
+  char szNum[32];
+  const int nLen = snprintf( szNum, sizeof( szNum ), "%g", dValue_i );
+  this->append( szNum, nLen );
+  return *this;
+}
+
+// .............................................................................
+
+/// Accepts the stream manipulators std::endl (appends a line break) and
+/// std::flush (passes the text on to the stream). Other manipulators are
+/// ignored.
+inline outbuf::COutBuffer& outbuf::COutBuffer::operator<<( std::ostream& (*Manipulator_i)( std::ostream& ) )
+{
+  if( Manipulator_i == static_cast<std::ostream& (*)( std::ostream& )>( std::endl ) )
+    this->push_back( '\n' );
+  else
+    if( Manipulator_i == static_cast<std::ostream& (*)( std::ostream& )>( std::flush ) )
+      this->Flush();
+  return *this;
+}
+
+// .............................................................................
+
+/// Returns the buffered text (not yet passed on to a stream).
+inline const std::string& outbuf::COutBuffer::str() const
+{
+  return sBuffer;
+}
+
+// .............................................................................
+
+inline size_t outbuf::COutBuffer::size() const
+{
+  return sBuffer.size();
+}
+
+// .............................................................................
+
+inline bool outbuf::COutBuffer::empty() const
+{
+  return sBuffer.empty();
+}
+
+// .............................................................................
+
+inline void outbuf::COutBuffer::clear()
+{
+  sBuffer.clear();
+}
+
+// .............................................................................
+
+/// Passes the buffered text on to the stream, if attached.
+inline void outbuf::COutBuffer::Flush()
+{
+  if( pOutStrm != NULL && !sBuffer.empty() )
+  {
+    pOutStrm->write( sBuffer.data(), sBuffer.size() );
+    sBuffer.clear();
+  }
+}
+
+// .............................................................................
+
+inline void outbuf::COutBuffer::AutoFlush()
+{
+  if( pOutStrm != NULL && sBuffer.size() >= nFlushSize )
+    this->Flush();
+}
+
+#endif /* OUTBUF_READ_ONCE */
@@ -0,0 +1,250 @@
+#ifndef STRVIEW_READ_ONCE
+#define STRVIEW_READ_ONCE
+
+// *****************************************************************************
+/// \file       strview.h
+///
+/// \brief      Provides a lightweight non-owning view on a character sequence
+///             as a replacement of std::string_view (C++17).
+///
+/// \details    A CStrView consists of a pointer and a length only. It does not
+///             own the characters, so it is valid only as long as the string it
+///             refers to is neither changed nor destroyed. Taking a view,
+///             trimming it or taking a part of it never allocates; a copy is
+///             only created by str().
+// *****************************************************************************
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <cstring>           // strlen(), memcmp()
+#include <ostream>           // std::ostream
+
+// -----------------------------------------------------------------------------
+
+// CLASSES OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+// *********************
+// *                   *
+// *     CStrView      *
+// *                   *
+// *********************
+
+/// String view namespace.
+namespace strview
+{
+  class CStrView;
+
+  bool operator==( const CStrView& sLeft_i, const CStrView& sRight_i );
+  bool operator!=( const CStrView& sLeft_i, const CStrView& sRight_i );
+  std::ostream& operator<<( std::ostream& oOutStrm_i, const CStrView& sView_i );
+}
+
+// -----------------------------------------------------------------------------
+
+// CLASS CStrView
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Non-owning view on a character sequence.
+// *****************************************************************************
+
+class strview::CStrView
+{
+  private:
+
+    const char* pData;                        ///< First character.
+    size_t nLen;                              ///< Number of characters.
+
+  public:
+
+    static const size_t npos = static_cast<size_t>( -1 );
+
+    // Constructors:
+    CStrView();
+    CStrView( const char* pData_i, size_t nLen_i );
+    CStrView( const char* szText_i );
+    CStrView( const std::string& sText_i );
+
+    // Access:
+    const char* data() const;
+    size_t size() const;
+    bool empty() const;
+    char operator[]( size_t nPos_i ) const;
+    const char* begin() const;
+    const char* end() const;
+    char front() const;
+    char back() const;
+
+    // Parts:
+    CStrView substr( size_t nPos_i, size_t nLen_i = npos ) const;
+    void remove_prefix( size_t nLen_i );
+    void remove_suffix( size_t nLen_i );
+    std::string str() const;
+};
+
+// -----------------------------------------------------------------------------
+
+// CLASS CStrView IMPLEMENTATION
+
+// -----------------------------------------------------------------------------
+
+/// Constructs an empty view.
+inline strview::CStrView::CStrView():
+  pData( "" ),
+  nLen( 0 )
+{}
+
+// .............................................................................
+
+/// Constructs a view on a character sequence of given length.
+inline strview::CStrView::CStrView( const char* pData_i, size_t nLen_i ):
+  pData( pData_i ),
+  nLen( nLen_i )
+{}
+
+// .............................................................................
+
+/// Constructs a view on a C string.
+inline strview::CStrView::CStrView( const char* szText_i ):
+  pData( szText_i ),
+  nLen( strlen( szText_i ) )
+{}
+
+// .............................................................................
+
+/// Constructs a view on a string.
+inline strview::CStrView::CStrView( const std::string& sText_i ):
+  pData( sText_i.data() ),
+  nLen( sText_i.size() )
+{}
+
+// .............................................................................
+
+inline const char* strview::CStrView::data() const
+{
+  return pData;
+}
+
+// .............................................................................
+
+inline size_t strview::CStrView::size() const
+{
+  return nLen;
+}
+
+// .............................................................................
+
+inline bool strview::CStrView::empty() const
+{
+  return nLen == 0;
+}
+
+// .............................................................................
+
+inline char strview::CStrView::operator[]( size_t nPos_i ) const
+{
+  return pData[nPos_i];
+}
+
+// .............................................................................
+
+inline const char* strview::CStrView::begin() const
+{
+  return pData;
+}
+
+// .............................................................................
+
+inline const char* strview::CStrView::end() const
+{
+  return pData + nLen;
+}
+
+// .............................................................................
+
+inline char strview::CStrView::front() const
+{
+  return pData[0];
+}
+
+// .............................................................................
+
+inline char strview::CStrView::back() const
+{
+  return pData[nLen - 1];
+}
+
+// .............................................................................
+
+/// Returns a view on a part of the view (limited to its end).
+inline strview::CStrView strview::CStrView::substr( size_t nPos_i, size_t nLen_i ) const
+{
+  if( nPos_i > nLen )
+    nPos_i = nLen;
+  if( nLen_i > nLen - nPos_i )
+    nLen_i = nLen - nPos_i;
+  return CStrView( pData + nPos_i, nLen_i );
+}
+
+// .............................................................................
+
+/// Removes characters from the front of the view.
+inline void strview::CStrView::remove_prefix( size_t nLen_i )
+{
+  pData += nLen_i;
+  nLen -= nLen_i;
+}
+
+// .............................................................................
+
+/// Removes characters from the back of the view.
+inline void strview::CStrView::remove_suffix( size_t nLen_i )
+{
+  nLen -= nLen_i;
+}
+
+// .............................................................................
+
+/// Returns a copy of the characters.
+inline std::string strview::CStrView::str() const
+{
+  return std::string( pData, nLen );
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS IMPLEMENTATION
+
+// -----------------------------------------------------------------------------
+
+/// Compares the characters of two views (a string is compared via its view).
+inline bool strview::operator==( const CStrView& sLeft_i, const CStrView& sRight_i )
+{
+  return sLeft_i.size() == sRight_i.size() &&
+         ( sLeft_i.size() == 0 || memcmp( sLeft_i.data(), sRight_i.data(), sLeft_i.size() ) == 0 );
+}
+
+// .............................................................................
+
+inline bool strview::operator!=( const CStrView& sLeft_i, const CStrView& sRight_i )
+{
+  return !( sLeft_i == sRight_i );
+}
+
+// .............................................................................
+
+/// Writes the characters of a view into a stream.
+inline std::ostream& strview::operator<<( std::ostream& oOutStrm_i, const CStrView& sView_i )
+{
+  return oOutStrm_i.write( sView_i.data(), sView_i.size() );
+}
+
+#endif /* STRVIEW_READ_ONCE */
@@ -0,0 +1,250 @@
+// -----------------------------------------------------------------------------
+/// \file       libescrido.cpp
+///
+/// \brief      Module implementation file for the library interface of
+///             Escrido, i.e. the embedding of the documentation generation
+///             into other programs.
+// -----------------------------------------------------------------------------
+
+#include "libescrido.h"
+
+#include <fstream>          // std::ifstream
+#include <iostream>         // std::cerr, std::endl
+
+#include "doc-parser.h"
+
+// -----------------------------------------------------------------------------
+
+// STRUCT SOutputSettings
+
+// -----------------------------------------------------------------------------
+
+escrido::SOutputSettings::SOutputSettings():
+  sTemplateDir     ( "./template/" ),
+  sWDOutputPostfix ( ".html" ),
+  fInternalTags    ( true ),
+  fSearchIndex     ( false ),
+  fSearchIdxEncode ( search_index_encoding::JSON ),
+  sSeachIndexFile  ( "srchidx.json" ),
+  fProgress        ( false )
+{}
+
+// -----------------------------------------------------------------------------
+
+// CLASS CContext
+
+// -----------------------------------------------------------------------------
+
+escrido::CContext::CContext()
+{}
+
+// .............................................................................
+
+/// Sets the output settings.
+void escrido::CContext::SetSettings( const SOutputSettings& oSettings_i )
+{
+  oSettings = oSettings_i;
+  pWriteInfo.reset();
+}
+
+// .............................................................................
+
+/// Returns the output settings.
+const escrido::SOutputSettings& escrido::CContext::GetSettings() const
+{
+  return oSettings;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Reads an input file and parses it into the documentation.
+///
+/// \param[in]  sPath_i
+///             Path of the file.
+///
+/// \return     'true' on success, 'false' if the file cannot be opened or
+///             contains syntax errors.
+// *****************************************************************************
+
+bool escrido::CContext::ParseFile( const std::string& sPath_i )
+{
+  std::ifstream oInFile( sPath_i.c_str(), std::ifstream::in | std::ifstream::binary );
+  if( !oInFile.is_open() )
+  {
+    std::cerr << "error: file \"" << sPath_i << "\" cannot be opened" << std::endl;
+    return false;
+  }
+
+  // (Attention: the extra brackets arround the first constructor are essential; DO NOT REMOVE;)
+  const std::string sFileData( (std::istreambuf_iterator<char>( oInFile )),
+                               std::istreambuf_iterator<char>() );
+  oInFile.close();
+
+  return ParseBuffer( sFileData );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Parses the content of an input file into the documentation.
+///
+/// \details    Content in front of the first page head of the buffer belongs
+///             to the last page of the previous buffer, as with files.
+///
+/// \param[in]  sData_i
+///             The file content.
+///
+/// \return     'true' on success, 'false' if there were syntax errors.
+// *****************************************************************************
+
+bool escrido::CContext::ParseBuffer( const std::string& sData_i )
+{
+  pWriteInfo.reset();
+  return ParseDocumentation( sData_i, oDocumentation, oSettings.fProgress );
+}
+
+// .............................................................................
+
+/// Removes all parsed pages (the filters and settings are kept).
+void escrido::CContext::Clear()
+{
+  oView.Clear();
+  oDocumentation.Clear();
+  pWriteInfo.reset();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Restricts the output to a subset of the pages. The parsed
+///             documentation itself is not changed, so the filters can be
+///             changed at any time.
+///
+/// \param[in]  saNSWhiteList_i
+///             Namespaces the output is restricted to (all if empty).
+/// \param[in]  saGroupBlackList_i
+///             Groups that are excluded from output.
+// *****************************************************************************
+
+void escrido::CContext::Filter( const std::vector<std::string>& saNSWhiteList_i,
+                                const std::vector<std::string>& saGroupBlackList_i )
+{
+  saNSWhiteList = saNSWhiteList_i;
+  saGroupBlackList = saGroupBlackList_i;
+  pWriteInfo.reset();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Completes the parsed documentation, applies the filters and
+///             creates the reference table.
+///
+/// \details    This is done automatically by the output methods, if
+///             required. The references are resolved as well (see
+///             GetUnresolvedRefs()).
+// *****************************************************************************
+
+void escrido::CContext::BuildRefs()
+{
+  oDocumentation.CloseDocPage();
+
+  oView.Clear();
+  if( !saNSWhiteList.empty() || !saGroupBlackList.empty() )
+    oDocumentation.CreateView( saNSWhiteList, saGroupBlackList, oView );
+
+  pWriteInfo.reset();
+  pRefTable.reset( new CRefTable( GetDocumentation().GetSymbolTable() ) );
+  GetDocumentation().CreateRefTable( oSettings.sWDOutputPostfix, *pRefTable );
+  GetDocumentation().ResolveRefs( *pRefTable, asUnresolvedRefs );
+  pWriteInfo.reset( new SWriteInfo( *pRefTable, oSettings.asRelabel ) );
+  pWriteInfo->fInternalTags = oSettings.fInternalTags;
+  pWriteInfo->fProgress = oSettings.fProgress;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Creates the HTML document of a single page or the search index
+///             in memory.
+///
+/// \param[in]  sURL_i
+///             URL of the page or of the search index (relative to the HTML
+///             directory).
+/// \param[out] sDocument_o
+///             Returns the document.
+///
+/// \return     'true' on success, 'false' if no page with this URL exists or
+///             its template cannot be read.
+// *****************************************************************************
+
+bool escrido::CContext::RenderPage( const std::string& sURL_i, std::string& sDocument_o )
+{
+  if( !pWriteInfo )
+    BuildRefs();
+
+  if( oSettings.fSearchIndex && sURL_i == oSettings.sSeachIndexFile )
+  {
+    outbuf::COutBuffer oOutBuf;
+    GetDocumentation().WriteHTMLSearchIndex( oOutBuf, oSettings.sWDOutputPostfix, *pWriteInfo, oSettings.fSearchIdxEncode );
+    sDocument_o = oOutBuf.str();
+    return true;
+  }
+
+  return GetDocumentation().GetHTMLPage( sURL_i, oSettings.sTemplateDir, oSettings.sWDOutputPostfix, *pWriteInfo, sDocument_o );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Writes the HTML documents, the search index (if enabled) and
+///             the LaTeX document.
+///
+/// \param[in]  sWDOutputDir_i
+///             Output directory of the HTML documents (with trailing
+///             separator; no HTML output if empty).
+/// \param[in]  sLOutputDir_i
+///             Output directory of the LaTeX document (with trailing
+///             separator; no LaTeX output if empty).
+// *****************************************************************************
+
+void escrido::CContext::WriteSite( const std::string& sWDOutputDir_i,
+                                   const std::string& sLOutputDir_i )
+{
+  if( !pWriteInfo )
+    BuildRefs();
+
+  const CDocumentation& oOutputDoc = GetDocumentation();
+
+  if( !sWDOutputDir_i.empty() )
+  {
+    oOutputDoc.WriteHTMLDoc( oSettings.sTemplateDir, sWDOutputDir_i, oSettings.sWDOutputPostfix, *pWriteInfo );
+    if( oSettings.fSearchIndex )
+      oOutputDoc.WriteHTMLSearchIndex( sWDOutputDir_i, oSettings.sSeachIndexFile, oSettings.sWDOutputPostfix,
+                                       *pWriteInfo, oSettings.fSearchIdxEncode );
+  }
+
+  if( !sLOutputDir_i.empty() )
+    oOutputDoc.WriteLaTeXDoc( oSettings.sTemplateDir, sLOutputDir_i, *pWriteInfo );
+}
+
+// .............................................................................
+
+/// Returns the documentation used for output (the filtered view, if filters
+/// are set).
+const escrido::CDocumentation& escrido::CContext::GetDocumentation() const
+{
+  if( !saNSWhiteList.empty() || !saGroupBlackList.empty() )
+    return oView;
+  return oDocumentation;
+}
+
+// .............................................................................
+
+/// Returns the unresolved references (pairs of page identifier and reference
+/// identifier) found by the last BuildRefs().
+const std::vector<std::pair<std::string, std::string>>& escrido::CContext::GetUnresolvedRefs() const
+{
+  return asUnresolvedRefs;
+}
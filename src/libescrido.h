@@ -0,0 +1,148 @@
+#ifndef LIBESCRIDO_ALLREADY_READ_IN
+#define LIBESCRIDO_ALLREADY_READ_IN
+
+// -----------------------------------------------------------------------------
+/// \file       libescrido.h
+///
+/// \brief      Module header for the library interface of Escrido, i.e. the
+///             embedding of the documentation generation into other programs.
+///
+/// \details    The library (target "lib" of the makefile) contains all modules
+///             except of the command line program. A CContext object holds a
+///             parsed documentation together with its output settings, so a
+///             long-running program can keep the parsed state and render
+///             pages or write the documentation repeatedly.
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+#include <memory>           // std::unique_ptr
+
+#include "escrido-doc.h"
+
+// -----------------------------------------------------------------------------
+
+// CLASSES OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+// *********************
+// *                   *
+// *  SOutputSettings  *
+// *                   *
+// *********************
+
+// *********************
+// *                   *
+// *     CContext      *
+// *                   *
+// *********************
+
+namespace escrido
+{
+  struct SOutputSettings;
+  class CContext;
+}
+
+// -----------------------------------------------------------------------------
+
+// STRUCT SOutputSettings
+
+// -----------------------------------------------------------------------------
+
+/// Output settings of a context (equal to the configuration file options of
+/// the same names).
+struct escrido::SOutputSettings
+{
+  std::string sTemplateDir;                   ///< Template directory name.
+  std::string sWDOutputPostfix;               ///< Output postfix (file ending) of webdocument files.
+  bool fInternalTags;                         ///< Flag whether internal tags are shown.
+  std::vector <std::pair<std::string, std::string>>
+    asRelabel;                                ///< List of fixed terms that shall be relabeled.
+  bool fSearchIndex;                          ///< Flag whether an index list for static search shall be generated.
+  search_index_encoding fSearchIdxEncode;     ///< Search index encoding type.
+  std::string sSeachIndexFile;                ///< Name of the search index file.
+  bool fProgress;                             ///< Flag whether parsing and writing is reported on the console.
+
+  SOutputSettings();
+};
+
+// -----------------------------------------------------------------------------
+
+// CLASS CContext
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      A documentation generation context: the parsed documentation,
+///             its filters, its reference table and its output settings.
+///
+/// \details    Contexts are independent of each other and of the command line
+///             program. Parsing is serialized between threads (the scanner is
+///             not reentrant), everything else can run in parallel on
+///             different contexts. A single context must not be used by
+///             several threads at once. (The run statistics are shared: their
+///             output counters are atomic, phases are only timed by the
+///             command line program.)
+///
+///             By default a context writes no progress messages to the
+///             console (see SOutputSettings::fProgress); errors and warnings
+///             are still reported on std::cerr.
+///
+///             The reference table is built on demand by the output methods
+///             and is rebuilt after parsing, filtering or changing the
+///             settings.
+// *****************************************************************************
+
+class escrido::CContext
+{
+  private:
+
+    CDocumentation oDocumentation;            ///< The parsed documentation.
+    CDocumentation oView;                     ///< Filtered view of the documentation (if filters are set).
+    std::vector <std::string> saNSWhiteList;  ///< Namespaces the output is restricted to.
+    std::vector <std::string> saGroupBlackList; ///< Groups excluded from output.
+    SOutputSettings oSettings;                ///< Output settings.
+    std::unique_ptr <CRefTable> pRefTable;    ///< Reference table (NULL: not built).
+    std::unique_ptr <SWriteInfo> pWriteInfo;  ///< Write info referring to the reference table (NULL: not built).
+    std::vector <std::pair<std::string, std::string>>
+      asUnresolvedRefs;                       ///< Unresolved references (page and reference identifier).
+
+  public:
+
+    // Constructor:
+    CContext();
+    CContext( const CContext& ) = delete;
+    CContext& operator=( const CContext& ) = delete;
+
+    // Settings:
+    void SetSettings( const SOutputSettings& oSettings_i );
+    const SOutputSettings& GetSettings() const;
+
+    // Parsing:
+    bool ParseFile( const std::string& sPath_i );
+    bool ParseBuffer( const std::string& sData_i );
+    void Clear();
+
+    // Filtering and references:
+    void Filter( const std::vector<std::string>& saNSWhiteList_i,
+                 const std::vector<std::string>& saGroupBlackList_i );
+    void BuildRefs();
+
+    // Output:
+    bool RenderPage( const std::string& sURL_i, std::string& sDocument_o );
+    void WriteSite( const std::string& sWDOutputDir_i,
+                    const std::string& sLOutputDir_i = std::string() );
+
+    // Access:
+    const CDocumentation& GetDocumentation() const;
+    const std::vector<std::pair<std::string, std::string>>& GetUnresolvedRefs() const;
+};
+
+#endif /* LIBESCRIDO_ALLREADY_READ_IN */
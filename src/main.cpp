@@ -17,13 +17,22 @@
 #include <string>
 #include <iostream>         // cin, cout, cerr, endl
 #include <fstream>          // ifstream
+#include <cstring>          // memchr
+#include <cstdlib>          // strtol
+#include <cerrno>           // errno, ERANGE
+#include <map>
+#include <set>
+#include <chrono>
+#include <memory>           // unique_ptr
 
 #include "filesys.h"
+#include "filewatch.h"
+#include "httpserv.h"
 
 #include "escrido-doc.h"
-
-// Declare yyparse: required for yacc under Ubuntu 12.x (at least)
-extern int yyparse();
+#include "doc-parser.h"
+#include "parse-cache.h"
+#include "stats.h"
 
 // -----------------------------------------------------------------------------
 
@@ -53,28 +62,68 @@ namespace escrido
   bool fHelp    = false;                        ///< Flag if the program outputs help information.
   std::string sConfigFile;                      ///< Configuration file name (if specified).
   std::vector <std::string> saIncludePaths;     ///< Include file names.
-  std::vector <std::string> saNamespaces;       ///< List of namespaces the output shall be restricted to.
-  std::vector <std::string> saExludeGroups;     ///< List of groups that shall be excluded from output.
-  bool fInternalTags = true;                    ///< Flag whether internal tags are shown.
-  std::vector <std::pair<std::string, std::string>>
-    asRelabel;                                  ///< List of fixed terms that shall be relabeled.
-  std::string sTemplateDir = "./template/";     ///< Template directory name.
-  bool fWDOutput = true;                        ///< Flag whether web document output shall be created.
-  std::string sWDOutputDir = "./html/";         ///< Output directory name for web document files.
-  std::string sWDOutputPostfix = ".html";       ///< Output postfix (file ending) of webdocument files.
-  bool fLOutput = false;                        ///< Flag whether LaTeX output shall be created.
-  std::string sLOutputDir = "./latex/";         ///< Output directory name for LaTeX document files.
+  std::vector <std::string> saExcludePaths;     ///< Exclude patterns of files and directories.
+  unsigned int nScanThreads = 1;                ///< Number of threads for resolving include paths (0: number of hardware threads).
+  std::string sScanThreads;                     ///< Number of threads from the command line (if specified; checked after reading the configuration file).
+
+  /// Output options: the settings that an output variant can change.
+  struct SOutputOptions
+  {
+    std::vector <std::string> saNamespaces;       ///< List of namespaces the output shall be restricted to.
+    std::vector <std::string> saExludeGroups;     ///< List of groups that shall be excluded from output.
+    bool fInternalTags = true;                    ///< Flag whether internal tags are shown.
+    std::vector <std::pair<std::string, std::string>>
+      asRelabel;                                  ///< List of fixed terms that shall be relabeled.
+    std::string sTemplateDir = "./template/";     ///< Template directory name.
+    bool fWDOutput = true;                        ///< Flag whether web document output shall be created.
+    std::string sWDOutputDir = "./html/";         ///< Output directory name for web document files.
+    std::string sWDOutputPostfix = ".html";       ///< Output postfix (file ending) of webdocument files.
+    bool fLOutput = false;                        ///< Flag whether LaTeX output shall be created.
+    std::string sLOutputDir = "./latex/";         ///< Output directory name for LaTeX document files.
+    bool fSearchIndex = false;                    ///< Flag whether an index list for static search shall be generated.
+    search_index_encoding fSearchIdxEncode
+      = search_index_encoding::JSON;              ///< Search index encoding type.
+    std::string sSeachIndexFile = "srchidx.json"; ///< Name of the search index file.
+  };
+  SOutputOptions oOutputOptions;                ///< Output options currently applied.
+
+  // (Short names of the output options for the argument and configuration
+  // file parsers.)
+  std::vector <std::string>& saNamespaces = oOutputOptions.saNamespaces;
+  std::vector <std::string>& saExludeGroups = oOutputOptions.saExludeGroups;
+  bool& fInternalTags = oOutputOptions.fInternalTags;
+  std::vector <std::pair<std::string, std::string>>& asRelabel = oOutputOptions.asRelabel;
+  std::string& sTemplateDir = oOutputOptions.sTemplateDir;
+  bool& fWDOutput = oOutputOptions.fWDOutput;
+  std::string& sWDOutputDir = oOutputOptions.sWDOutputDir;
+  std::string& sWDOutputPostfix = oOutputOptions.sWDOutputPostfix;
+  bool& fLOutput = oOutputOptions.fLOutput;
+  std::string& sLOutputDir = oOutputOptions.sLOutputDir;
+  bool& fSearchIndex = oOutputOptions.fSearchIndex;
+  search_index_encoding& fSearchIdxEncode = oOutputOptions.fSearchIdxEncode;
+  std::string& sSeachIndexFile = oOutputOptions.sSeachIndexFile;
+
   bool fDebug   = false;                        ///< Output debug information.
+  bool fStats   = false;                        ///< Output run statistics.
+  std::string sStatsJSONFile;                   ///< File name for run statistics in JSON format (if specified).
+  std::string sTraceFile;                       ///< File name for trace events in Chrome trace format (if specified).
+  bool fWatch   = false;                        ///< Flag whether the input files are watched and the output is regenerated on changes.
+  unsigned int nServePort = 0;                  ///< Port of the documentation server on localhost (0: no server).
+  std::string sServePort;                       ///< Port of the documentation server from the command line (if specified; checked after reading the arguments).
+  std::string sParseCacheFile;                  ///< File name of the parse cache (if specified).
 
-  bool fSearchIndex = false;                    ///< Flag whether an index list for static search shall be generated.
-  search_index_encoding fSearchIdxEncode
-    = search_index_encoding::JSON;              ///< Search index encoding type.
-  std::string sSeachIndexFile = "srchidx.json"; ///< Name of the search index file.
+  /// Output variant: a named set of output options (from the configuration
+  /// file) that is applied on top of the general settings.
+  struct SOutputVariant
+  {
+    std::string sName;                          ///< Name of the variant.
+    std::vector <std::pair<std::string, std::string>>
+      asOptions;                                ///< Option names and their (unparsed) values.
+  };
+  std::vector <SOutputVariant> oaOutputVariants;///< Output variants.
 
   CDocumentation oDocumentation;                ///< The code documentation content.
-
-  // Parsing buffers:
-  CContentUnit oParseContUnit;                  ///< Content unit that is written to while parsing.
+  CParseCache oParseCache;                      ///< Parse results of input files from previous runs.
 }
 
 // -----------------------------------------------------------------------------
@@ -86,11 +135,21 @@ namespace escrido
 namespace escrido
 {
   void AppendBlankSepStrings( char* szAppend_i, std::vector <std::string>& saStingList_o );
+  bool ParseThreadNumber( const char* szValue_i, unsigned int& nThreadN_o );
+  bool ParsePortNumber( const char* szValue_i, unsigned int& nPort_o );
   void UnderlinedOut( const std::string& sOutput_i );
+  bool HasDocMarkers( const std::string& sData_i );
+  void ResolveIncludePath( const std::string& sIncludePath_i, std::vector<filesys::SFileInfo>& oaFileInfo_o );
+  bool ParseInputFile( const std::string& sPath_i );
+  void WriteParseCache();
+  void ResolveRefs( const CDocumentation& oDocumentation_i, const SWriteInfo& oWriteInfo_i );
+  void GenerateOutput( const CDocumentation& oDocumentation_i,
+                       const std::vector<bool>& faPageSelect_i = std::vector<bool>() );
+  void GenerateOutputVariants();
+  std::string GetNavSignature( const CDocumentation& oDocumentation_i );
+  int WatchInputFiles();
 }
 
-extern void InitScanner( const std::string* pSrc_i );  // Lex initialization.
-
 // -----------------------------------------------------------------------------
 
 // INCLUSIONS
@@ -155,6 +214,53 @@ int main( int argc, char* argv[] )
     argscan::InterpArgs( argc, argv, szArgScanError );
   }
 
+  // Check the number of threads from the command line. (Its value overrules
+  // the configuration file, too.)
+  if( !sScanThreads.empty() && !ParseThreadNumber( sScanThreads.c_str(), nScanThreads ) )
+  {
+    std::cerr << "Error: invalid number of threads \"" << sScanThreads << "\"" << std::endl;
+    return 1;
+  }
+
+  // Check the port of the documentation server.
+  if( !sServePort.empty() && !ParsePortNumber( sServePort.c_str(), nServePort ) )
+  {
+    std::cerr << "Error: invalid server port \"" << sServePort << "\" (must be 1 to 65535)" << std::endl;
+    return 1;
+  }
+
+  // Bring exclude patterns that are paths into canonical form. (Patterns
+  // without slashes are plain name patterns.)
+  for( size_t e = 0; e < saExcludePaths.size(); e++ )
+    if( saExcludePaths[e].find( '/' ) != std::string::npos )
+    {
+      std::string sCanonicalPath;
+      if( filesys::GetCanonicalPath( saExcludePaths[e].c_str(), sCanonicalPath ) )
+        saExcludePaths[e] = sCanonicalPath;
+    }
+
+  // Time the phases and start recording of trace events, if demanded.
+  oRunStats.fEnabled = fStats || !sStatsJSONFile.empty() || !sTraceFile.empty();
+  if( !sTraceFile.empty() )
+    oRunStats.StartTrace();
+
+  // Pages that do not comply to the namespace white list or the groups black
+  // list are dropped while parsing. (If output variants are defined, each
+  // variant applies its own filters on the complete documentation.)
+  if( oaOutputVariants.empty() )
+    escrido::oDocumentation.SetParseFilters( saNamespaces, saExludeGroups );
+
+  // Load the parse results of previous runs.
+  if( !sParseCacheFile.empty() )
+    if( !oParseCache.Load( sParseCacheFile ) )
+      std::cerr << "warning: parse cache file \"" << sParseCacheFile << "\" is invalid and is created anew" << std::endl;
+
+  // In watch mode, parsing and output generation are repeated on every change
+  // of the input files until the program is terminated. The documentation
+  // server works the same way but renders pages only on request.
+  if( fWatch || nServePort != 0 )
+    return WatchInputFiles();
+
   // Read files and parse them.
   for( size_t i = 0; i < saIncludePaths.size(); i++ )
   {
@@ -164,68 +270,204 @@ int main( int argc, char* argv[] )
 
     // Get list of files defined by the include paths list.
     std::vector<filesys::SFileInfo> oaFileInfo;
-    {
-      std::string sCanonicalPath;
-      if( filesys::GetCanonicalPath( saIncludePaths[i].c_str(), sCanonicalPath ) )
-        GetFilesInfo( sCanonicalPath.c_str(), filesys::case_type::OS_CONVENTION, oaFileInfo );
-    }
+    ResolveIncludePath( saIncludePaths[i], oaFileInfo );
 
     // Walk every file of the result list.
     for( size_t f = 0; f < oaFileInfo.size(); f++ )
       if( oaFileInfo[f].fItemType == filesys::item_type::FILE )
-      {
-        // Output currently processed file:
-        UnderlinedOut( oaFileInfo[f].sPath );
+        ParseInputFile( oaFileInfo[f].sPath );
+  }
 
-        // Read file into a string.
-        std::string sFileData;
-        {
-          // Open input file for binary reading ("raw mode");
-          std::ifstream oInFile( oaFileInfo[f].sPath.c_str(), std::ifstream::in | std::ifstream::binary );
-          if( !oInFile.is_open() )
-          {
-            std::cerr << "error: file \"" << oaFileInfo[f].sPath << "\" cannot be opened" << std::endl;
-            continue;
-          }
+  // Complete the last page.
+  escrido::oDocumentation.CloseDocPage();
+  WriteParseCache();
 
-          // Use iterator-template way of read the file completely (good 'best practice" method);
-          // (Attention: the extra brackets arround the first constructor are essential; DO NOT REMOVE;)
-          sFileData.assign( (std::istreambuf_iterator<char>( oInFile )),
-                            std::istreambuf_iterator<char>() );
+  // Collect statistics of the parsed documentation.
+  oRunStats.nPagesDropped = escrido::oDocumentation.GetDroppedPageN();
+  escrido::oDocumentation.CountContent( oRunStats.nPages, oRunStats.nBlocks, oRunStats.nChunks );
 
-          // Close file again.
-          oInFile.close();
-        }
+  // Program output.
+  std::cout << oRunStats.nFilesScanned << " file(s) scanned, "
+            << oRunStats.nFilesSkipped << " file(s) skipped (no documentation markers)" << std::endl;
+  if( oRunStats.nFilesCached > 0 )
+    std::cout << oRunStats.nFilesCached << " file(s) taken from the parse cache" << std::endl;
+  if( escrido::oDocumentation.GetDroppedPageN() > 0 )
+    std::cout << escrido::oDocumentation.GetDroppedPageN() << " page(s) filtered out by namespace or group" << std::endl;
+  std::cout << std::endl;
 
-        // Initialize scanner with the input string.
-        InitScanner( &sFileData );
+  // Debug output.
+  if( fDebug )
+    escrido::oDocumentation.DebugOutput();
 
-        // Perform parsing.
-        yyparse();
+  if( oaOutputVariants.empty() )
+    GenerateOutput( escrido::oDocumentation );
+  else
+    GenerateOutputVariants();
 
-        // Output
-        std::cout << std::endl;
-      }
+  // Output statistics.
+  if( fStats )
+    oRunStats.WriteTable( std::cout );
+  if( !sStatsJSONFile.empty() )
+    if( !oRunStats.WriteJSON( sStatsJSONFile ) )
+      std::cerr << "error: statistics file \"" << sStatsJSONFile << "\" cannot be written" << std::endl;
+  if( !sTraceFile.empty() )
+    if( !oRunStats.WriteTrace( sTraceFile ) )
+      std::cerr << "error: trace file \"" << sTraceFile << "\" cannot be written" << std::endl;
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Appends the blank space separted path declarations to the input
+///             paths array.
+///
+/// \param[in]  szAppend_i
+///             C string that is broken into seperate substrings that are
+///             appended to the output list.
+/// \param[out] saStingList_o
+///             Output list of C++ strings.
+// *****************************************************************************
+
+void escrido::AppendBlankSepStrings( char* szAppend_i, std::vector <std::string>& saStingList_o )
+{
+  // Split into token seperated by blank spaces.
+  char* pPos = strtok( szAppend_i, " \t" );
+  while( pPos != NULL )
+  {
+    saStingList_o.push_back( pPos );
+    pPos = strtok( NULL, " \t" );
   }
+}
 
-  // Program output.
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Reads a number of threads, e.g. of the include path resolution.
+///
+/// \details    The value 0 stands for the number of hardware threads. Values
+///             above nMaxThreadN are limited to it.
+///
+/// \param[in]  szValue_i
+///             The text of the number.
+/// \param[out] nThreadN_o
+///             The number of threads (unchanged on failure).
+///
+/// \return     false, if the text is not a non-negative integer number.
+// *****************************************************************************
+
+bool escrido::ParseThreadNumber( const char* szValue_i, unsigned int& nThreadN_o )
+{
+  const long nMaxThreadN = 256;
+
+  char* pEnd;
+  errno = 0;
+  const long nValue = strtol( szValue_i, &pEnd, 10 );
+  if( pEnd == szValue_i || *pEnd != '\0' || nValue < 0 )
+    return false;
+
+  nThreadN_o = static_cast<unsigned int>( ( errno == ERANGE || nValue > nMaxThreadN ) ? nMaxThreadN : nValue );
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Reads a TCP port number.
+///
+/// \param[in]  szValue_i
+///             The text of the number.
+/// \param[out] nPort_o
+///             The port number (unchanged on failure).
+///
+/// \return     false, if the text is not an integer number from 1 to 65535.
+// *****************************************************************************
+
+bool escrido::ParsePortNumber( const char* szValue_i, unsigned int& nPort_o )
+{
+  char* pEnd;
+  errno = 0;
+  const long nValue = strtol( szValue_i, &pEnd, 10 );
+  if( pEnd == szValue_i || *pEnd != '\0' || errno == ERANGE || nValue < 1 || nValue > 65535 )
+    return false;
+
+  nPort_o = static_cast<unsigned int>( nValue );
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+
+void escrido::UnderlinedOut( const std::string& sOutput_i )
+{
+  std::cout << sOutput_i << std::endl;
+  const size_t nLen = sOutput_i.length();
+  for( size_t l = 0; l < nLen; l++ )
+    std::cout << "-";
   std::cout << std::endl;
+}
 
-  // Debug output.
-  if( fDebug )
-    escrido::oDocumentation.DebugOutput();
+// -----------------------------------------------------------------------------
 
-  // Remove all content unit that do not comply to the namespace white list.
-  if( !saNamespaces.empty() )
-    escrido::oDocumentation.RemoveNamespaces( saNamespaces );
+// *****************************************************************************
+/// \brief      Checks whether a file content contains at least one opening
+///             sequence of a documentation unit ("/*#" or "//#").
+///
+/// \details    This is a fast pre-filter that allows to skip files without any
+///             documentation before initializing the scanner on them. The
+///             search jumps from slash to slash using memchr() and only then
+///             compares the two following characters.
+///
+/// \param[in]  sData_i
+///             The file content.
+///
+/// \return     true, if a documentation marker was found, false otherwise.
+// *****************************************************************************
 
-  // Remove all content unit that do not comply to the groups black list.
-  if( !saExludeGroups.empty() )
-    escrido::oDocumentation.RemoveGroups( saExludeGroups );
+bool escrido::HasDocMarkers( const std::string& sData_i )
+{
+  const char* pPos = sData_i.data();
+  const char* pEnd = pPos + sData_i.size();
+
+  // A marker has three characters, so the search can stop two characters
+  // before the end.
+  while( pEnd - pPos >= 3 )
+  {
+    pPos = static_cast<const char*>( memchr( pPos, '/', pEnd - pPos - 2 ) );
+    if( pPos == NULL )
+      return false;
 
-  // Create write info container with the reference table
-  SWriteInfo oWriteInfo( asRelabel );
-  escrido::oDocumentation.CreateRefTable( sWDOutputPostfix, oWriteInfo );
+    if( ( pPos[1] == '*' || pPos[1] == '/' ) && pPos[2] == '#' )
+      return true;
+
+    pPos++;
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Writes the output documents (HTML, search index, LaTeX) of a
+///             documentation with the current output settings.
+///
+/// \param[in]  oDocumentation_i
+///             The documentation to write.
+/// \param[in]  faPageSelect_i
+///             Flags of the pages whose HTML documents are written. (All
+///             pages if empty.) The search index and the LaTeX document are
+///             always written completely.
+// *****************************************************************************
+
+void escrido::GenerateOutput( const CDocumentation& oDocumentation_i,
+                              const std::vector<bool>& faPageSelect_i )
+{
+  // Create the reference table and the write info container
+  CRefTable oRefTable( oDocumentation_i.GetSymbolTable() );
+  oDocumentation_i.CreateRefTable( sWDOutputPostfix, oRefTable );
+  SWriteInfo oWriteInfo( oRefTable, asRelabel );
+  ResolveRefs( oDocumentation_i, oWriteInfo );
 
   // Store more information into the write info
   oWriteInfo.fInternalTags = fInternalTags;
@@ -235,10 +477,11 @@ int main( int argc, char* argv[] )
   {
     std::cout << "Writing HTML document(s) into '" << sWDOutputDir << "':" << std::endl
               << std::endl;
-    escrido::oDocumentation.WriteHTMLDoc( sTemplateDir,
-                                          sWDOutputDir,
-                                          sWDOutputPostfix,
-                                          oWriteInfo );
+    oDocumentation_i.WriteHTMLDoc( sTemplateDir,
+                                   sWDOutputDir,
+                                   sWDOutputPostfix,
+                                   oWriteInfo,
+                                   faPageSelect_i );
 
     if( fSearchIndex )
     {
@@ -246,11 +489,11 @@ int main( int argc, char* argv[] )
                 << "Writing search index file into '" << sWDOutputDir << "':" << std::endl
                 << std::endl;
 
-      escrido::oDocumentation.WriteHTMLSearchIndex( sWDOutputDir,
-                                                    sSeachIndexFile,
-                                                    sWDOutputPostfix,
-                                                    oWriteInfo,
-                                                    fSearchIdxEncode );
+      oDocumentation_i.WriteHTMLSearchIndex( sWDOutputDir,
+                                             sSeachIndexFile,
+                                             sWDOutputPostfix,
+                                             oWriteInfo,
+                                             fSearchIdxEncode );
     }
 
     std::cout << std::endl;
@@ -261,46 +504,635 @@ int main( int argc, char* argv[] )
   {
     std::cout << "Writing LaTeX document into '" << sLOutputDir << "':" << std::endl
               << std::endl;
-    escrido::oDocumentation.WriteLaTeXDoc( sTemplateDir,
-                                           sLOutputDir,
-                                           oWriteInfo );
+    oDocumentation_i.WriteLaTeXDoc( sTemplateDir,
+                                    sLOutputDir,
+                                    oWriteInfo );
     std::cout << std::endl;
   }
+}
 
-  return 0;
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Resolves the references of a documentation against the
+///             reference table of a write info object and reports the
+///             unresolved ones.
+// *****************************************************************************
+
+void escrido::ResolveRefs( const CDocumentation& oDocumentation_i, const SWriteInfo& oWriteInfo_i )
+{
+  std::vector <std::pair<std::string, std::string>> asUnresolved;
+  oDocumentation_i.ResolveRefs( oWriteInfo_i.oRefTable, asUnresolved );
+
+  for( size_t r = 0; r < asUnresolved.size(); r++ )
+    std::cerr << "warning: unresolved reference '" << asUnresolved[r].second
+              << "' on page '" << asUnresolved[r].first << "'" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 // *****************************************************************************
-/// \brief      Appends the blank space separted path declarations to the input
-///             paths array.
+/// \brief      Resolves an include path (with wildcards) into a list of files
+///             and directories.
 ///
-/// \param[in]  szAppend_i
-///             C string that is broken into seperate substrings that are
-///             appended to the output list.
-/// \param[out] saStingList_o
-///             Output list of C++ strings.
+/// \param[in]  sIncludePath_i
+///             The include path.
+/// \param[out] oaFileInfo_o
+///             List of the matching files and directories.
 // *****************************************************************************
 
-void escrido::AppendBlankSepStrings( char* szAppend_i, std::vector <std::string>& saStingList_o )
+void escrido::ResolveIncludePath( const std::string& sIncludePath_i, std::vector<filesys::SFileInfo>& oaFileInfo_o )
 {
-  // Split into token seperated by blank spaces.
-  char* pPos = strtok( szAppend_i, " \t" );
-  while( pPos != NULL )
+  CPhaseTimer oTimer( "resolve include paths" );
+
+  std::string sCanonicalPath;
+  if( filesys::GetCanonicalPath( sIncludePath_i.c_str(), sCanonicalPath ) )
+    GetFilesInfo( sCanonicalPath.c_str(), filesys::case_type::OS_CONVENTION, oaFileInfo_o, nScanThreads, saExcludePaths );
+}
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Reads an input file and parses it into the documentation.
+///
+/// \param[in]  sPath_i
+///             Path of the file.
+///
+/// \return     true, if the file was parsed, false if it could not be opened
+///             or does not contain any documentation unit.
+// *****************************************************************************
+
+bool escrido::ParseInputFile( const std::string& sPath_i )
+{
+  // Read file into a string.
+  std::string sFileData;
   {
-    saStingList_o.push_back( pPos );
-    pPos = strtok( NULL, " \t" );
+    CPhaseTimer oTimer( "read files" );
+
+    // Open input file for binary reading ("raw mode");
+    std::ifstream oInFile( sPath_i.c_str(), std::ifstream::in | std::ifstream::binary );
+    if( !oInFile.is_open() )
+    {
+      std::cerr << "error: file \"" << sPath_i << "\" cannot be opened" << std::endl;
+      return false;
+    }
+
+    // Use iterator-template way of read the file completely (good 'best practice" method);
+    // (Attention: the extra brackets arround the first constructor are essential; DO NOT REMOVE;)
+    sFileData.assign( (std::istreambuf_iterator<char>( oInFile )),
+                      std::istreambuf_iterator<char>() );
+
+    // Close file again.
+    oInFile.close();
+  }
+  oRunStats.nBytesRead += sFileData.size();
+
+  // Skip files that do not contain any documentation unit at all without
+  // running the scanner on them.
+  if( !HasDocMarkers( sFileData ) )
+  {
+    oRunStats.nFilesSkipped++;
+    return false;
+  }
+  oRunStats.nFilesScanned++;
+
+  // Output currently processed file:
+  UnderlinedOut( sPath_i );
+
+  // Replay the parse events of an unchanged file from the parse cache.
+  long long nMTime = 0, nSize = 0;
+  uint64_t nHash = 0;
+  const bool fCache = ( !sParseCacheFile.empty() && filewatch::GetFileStamp( sPath_i, nMTime, nSize ) );
+  std::vector<SParseEvent> oaParseRecord;
+  if( fCache )
+  {
+    CPhaseTimer oTimer( "parse cache" );
+    nSize = static_cast<long long>( sFileData.size() );
+    nHash = CParseCache::Hash( sFileData );
+    if( oParseCache.Lookup( sPath_i, nSize, nMTime, nHash, oaParseRecord ) )
+    {
+      escrido::oDocumentation.Replay( oaParseRecord );
+      oRunStats.nFilesCached++;
+      std::cout << "(from parse cache)" << std::endl
+                << std::endl;
+      return true;
+    }
+  }
+
+  // Perform parsing. (For the parse cache the events are recorded and passed
+  // on to an outer recording, if there is one.)
+  bool fParsed;
+  std::vector<SParseEvent>* paOuterParseRecord = escrido::oDocumentation.GetParseRecord();
+  if( fCache )
+    escrido::oDocumentation.SetParseRecord( &oaParseRecord );
+  {
+    CPhaseTimer oTimer( "parse" );
+    CTraceSpan oTraceSpan( "parse file", sPath_i );
+    fParsed = ParseDocumentation( sFileData, escrido::oDocumentation );
+  }
+  if( fCache )
+  {
+    escrido::oDocumentation.SetParseRecord( paOuterParseRecord );
+    if( paOuterParseRecord != NULL )
+      paOuterParseRecord->insert( paOuterParseRecord->end(), oaParseRecord.begin(), oaParseRecord.end() );
+
+    // Files with syntax errors are parsed again next time (to show the
+    // errors again).
+    if( fParsed )
+      oParseCache.Store( sPath_i, nSize, nMTime, nHash, oaParseRecord );
   }
+
+  // Output
+  std::cout << std::endl;
+
+  return true;
 }
 
 // -----------------------------------------------------------------------------
 
-void escrido::UnderlinedOut( const std::string& sOutput_i )
+/// Writes the parse cache file, if a parse cache is used.
+void escrido::WriteParseCache()
 {
-  std::cout << sOutput_i << std::endl;
-  const size_t nLen = sOutput_i.length();
-  for( size_t l = 0; l < nLen; l++ )
-    std::cout << "-";
-  std::cout << std::endl;
+  if( !sParseCacheFile.empty() )
+    if( !oParseCache.Write( sParseCacheFile ) )
+      std::cerr << "error: parse cache file \"" << sParseCacheFile << "\" cannot be written" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Writes all output variants of the configuration file from the
+///             parsed documentation.
+// *****************************************************************************
+
+void escrido::GenerateOutputVariants()
+{
+  // Generate every output variant from the same parsed documentation.
+  for( size_t v = 0; v < oaOutputVariants.size(); v++ )
+  {
+    // Save the general output options.
+    const SOutputOptions oOutputOptionsGen = oOutputOptions;
+
+    // Apply the options of the variant. (Relabel declarations of a variant
+    // replace the general ones.)
+    bool fRelabelCleared = false;
+    for( size_t o = 0; o < oaOutputVariants[v].asOptions.size(); o++ )
+    {
+      std::string sLine = oaOutputVariants[v].asOptions[o].second;
+      if( oaOutputVariants[v].asOptions[o].first == "RELABEL" && !fRelabelCleared )
+      {
+        asRelabel.clear();
+        fRelabelCleared = true;
+      }
+      config_file_parser::ParseConfigOption( oaOutputVariants[v].asOptions[o].first, sLine );
+    }
+
+    // Output
+    std::cout << "Output variant '" << oaOutputVariants[v].sName << "':" << std::endl
+              << std::endl;
+    CTraceSpan oTraceSpan( "variant", oaOutputVariants[v].sName );
+
+    // Create a view of the documentation with the pages of this variant and
+    // write it.
+    CDocumentation oView;
+    {
+      CPhaseTimer oTimer( "filter pages" );
+      escrido::oDocumentation.CreateView( saNamespaces, saExludeGroups, oView );
+    }
+    GenerateOutput( oView );
+
+    // Restore the general output options.
+    oOutputOptions = oOutputOptionsGen;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Returns a string that contains everything of a documentation
+///             that is written into more than its own HTML page: the
+///             reference table, the page order with the table of content
+///             entries and the feature names.
+///
+/// \details    Used by the watch mode: if the signature is unchanged, only the
+///             HTML pages of changed files need to be written again.
+// *****************************************************************************
+
+std::string escrido::GetNavSignature( const CDocumentation& oDocumentation_i )
+{
+  CRefTable oRefTable( oDocumentation_i.GetSymbolTable() );
+  oDocumentation_i.CreateRefTable( sWDOutputPostfix, oRefTable );
+  SWriteInfo oWriteInfo( oRefTable, asRelabel );
+  oWriteInfo.fInternalTags = fInternalTags;
+  oWriteInfo.nIndent = 0;
+
+  std::string sSignature;
+  for( size_t r = 0; r < oWriteInfo.oRefTable.GetRefN(); r++ )
+    sSignature += oWriteInfo.oRefTable.GetIdent( r ) + '\t' +
+                  oWriteInfo.oRefTable.GetLink( r ) + '\t' +
+                  oWriteInfo.oRefTable.GetText( r ) + '\n';
+
+  for( size_t p = 0; p < oDocumentation_i.GetDocPageN(); p++ )
+  {
+    const CDocPage& oPage = oDocumentation_i.GetDocPage( p );
+    sSignature += oPage.GetIdent() + '\t' + oPage.GetPageTypeID() + '\t' + oPage.GetTitle();
+    const std::vector<std::string> asGroupList = oPage.GetGroupNames();
+    for( size_t g = 0; g < asGroupList.size(); g++ )
+      sSignature += '\t' + asGroupList[g];
+    sSignature += '\t' + oPage.GetClearTextBrief( oWriteInfo ) + '\n';
+  }
+
+  const std::vector<std::string> asFeatureList = oDocumentation_i.GetFeatureNames();
+  std::set<std::string> asFeatureSet( asFeatureList.begin(), asFeatureList.end() );
+  for( std::set<std::string>::const_iterator iFeature = asFeatureSet.begin(); iFeature != asFeatureSet.end(); ++iFeature )
+    sSignature += *iFeature + '\n';
+
+  return sSignature;
+}
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Watch mode: parses the input files, writes the output and then
+///             watches the input files and the template directory for changes
+///             to regenerate the output. The function does not return unless
+///             watching fails.
+///
+/// \details    The parse events of every file are recorded (see
+///             \ref CDocumentation::Replay()), so only changed files are
+///             parsed again and the documentation is reassembled from the
+///             records. Only the HTML pages of changed files are written
+///             again, unless the change affects other pages as well (see
+///             \ref GetNavSignature()), the mainpage or the templates, in
+///             which case everything is written again. The search index and
+///             the LaTeX document are always written completely.
+///
+///             With a server port set, no output is written. Instead, the HTML
+///             pages and the search index are served on localhost. Each page
+///             is rendered on its first request and cached until it is
+///             invalidated by a change by the same rules. Other files (e.g.
+///             style sheets and scripts) are served from the HTML output
+///             directory.
+///
+/// \return     Exit code of the program.
+// *****************************************************************************
+
+int escrido::WatchInputFiles()
+{
+  // Stamp and parse record of an input file.
+  struct SWatchFile
+  {
+    long long nMTime;
+    long long nSize;
+    std::vector <SParseEvent> oaParseRecord;
+  };
+  std::map <std::string, SWatchFile> oFileMap;
+  std::vector <std::string> asFileList;       // Input files in parsing order.
+  std::set <std::string> asDirtyFileSet;      // Files parsed (again) since the last output.
+  std::string sTemplateStamp;
+  std::string sNavSignature;
+
+  httpserv::CServer oServer;
+  std::unique_ptr <CRefTable> pRefTable;       // Reference table for serving pages.
+  std::unique_ptr <SWriteInfo> pWriteInfo;     // Write info for serving pages.
+  std::map <std::string, std::string> oPageCache; // Rendered documents by URL.
+
+  filewatch::CWatcher oWatcher;
+  if( !oWatcher.Init() )
+    std::cout << "No file system notifications available: polling for changes every second" << std::endl
+              << std::endl;
+
+  // Resolves the include paths and adds the directories of all files to the
+  // watcher.
+  auto ResolveFiles = [&]()
+  {
+    asFileList.clear();
+    for( size_t i = 0; i < saIncludePaths.size(); i++ )
+    {
+      std::vector<filesys::SFileInfo> oaFileInfo;
+      ResolveIncludePath( saIncludePaths[i], oaFileInfo );
+      for( size_t f = 0; f < oaFileInfo.size(); f++ )
+        if( oaFileInfo[f].fItemType == filesys::item_type::FILE )
+        {
+          asFileList.push_back( oaFileInfo[f].sPath );
+
+          const size_t nSepPos = oaFileInfo[f].sPath.find_last_of( "/\\" );
+          oWatcher.AddDir( nSepPos == std::string::npos ? std::string( "." ) : oaFileInfo[f].sPath.substr( 0, nSepPos + 1 ) );
+        }
+    }
+  };
+
+  // Returns a stamp of all files of the template directory.
+  auto GetTemplateStamp = [&]()
+  {
+    std::string sStamp;
+    std::vector<filesys::SFileInfo> oaFileInfo;
+    ResolveIncludePath( sTemplateDir + "*", oaFileInfo );
+    for( size_t f = 0; f < oaFileInfo.size(); f++ )
+    {
+      long long nMTime = 0, nSize = 0;
+      filewatch::GetFileStamp( oaFileInfo[f].sPath, nMTime, nSize );
+      sStamp += oaFileInfo[f].sPath + '\t' + std::to_string( nMTime ) + '\t' + std::to_string( nSize ) + '\n';
+    }
+    return sStamp;
+  };
+
+  // Parses all new and changed files. Returns whether any file changed.
+  auto ParseChangedFiles = [&]()
+  {
+    bool fChanged = false;
+    for( size_t f = 0; f < asFileList.size(); f++ )
+    {
+      long long nMTime, nSize;
+      if( !filewatch::GetFileStamp( asFileList[f], nMTime, nSize ) )
+        continue;
+
+      std::map<std::string, SWatchFile>::iterator iFile = oFileMap.find( asFileList[f] );
+      if( iFile != oFileMap.end() && iFile->second.nMTime == nMTime && iFile->second.nSize == nSize )
+        continue;
+
+      SWatchFile& oFile = oFileMap[asFileList[f]];
+      oFile.nMTime = nMTime;
+      oFile.nSize = nSize;
+      oFile.oaParseRecord.clear();
+
+      escrido::oDocumentation.SetParseRecord( &oFile.oaParseRecord );
+      ParseInputFile( asFileList[f] );
+      escrido::oDocumentation.SetParseRecord( NULL );
+
+      asDirtyFileSet.insert( asFileList[f] );
+      fChanged = true;
+    }
+
+    // Forget files that are no longer included.
+    const std::set<std::string> asFileSet( asFileList.begin(), asFileList.end() );
+    for( std::map<std::string, SWatchFile>::iterator iFile = oFileMap.begin(); iFile != oFileMap.end(); )
+      if( asFileSet.count( iFile->first ) == 0 )
+      {
+        if( !iFile->second.oaParseRecord.empty() )
+          fChanged = true;
+        iFile = oFileMap.erase( iFile );
+      }
+      else
+        ++iFile;
+
+    if( fChanged )
+      WriteParseCache();
+
+    return fChanged;
+  };
+
+  // Reassembles the documentation from the parse records. Returns the
+  // identifiers of the pages that contain content of changed files.
+  auto Assemble = [&]()
+  {
+    std::set<std::string> asDirtyPageSet;
+
+    escrido::oDocumentation.Clear();
+    for( size_t f = 0; f < asFileList.size(); f++ )
+    {
+      std::map<std::string, SWatchFile>::const_iterator iFile = oFileMap.find( asFileList[f] );
+      if( iFile == oFileMap.end() )
+        continue;
+
+      const std::vector<SParseEvent>& oaParseRecord = iFile->second.oaParseRecord;
+      size_t nFirstPage = escrido::oDocumentation.GetDocPageN();
+      escrido::oDocumentation.Replay( oaParseRecord );
+
+      if( asDirtyFileSet.count( asFileList[f] ) > 0 )
+      {
+        // Content in front of the first page head continues the previous page.
+        if( nFirstPage > 0 && !oaParseRecord.empty() && oaParseRecord.front().fType == parse_event_type::CONTENT_UNIT )
+          nFirstPage--;
+        for( size_t p = nFirstPage; p < escrido::oDocumentation.GetDocPageN(); p++ )
+          asDirtyPageSet.insert( escrido::oDocumentation.GetDocPage( p ).GetIdent() );
+      }
+    }
+    escrido::oDocumentation.CloseDocPage();
+
+    asDirtyFileSet.clear();
+    return asDirtyPageSet;
+  };
+
+  // Creates the write info for serving pages from the current documentation.
+  auto PrepareWriteInfo = [&]()
+  {
+    pWriteInfo.reset();
+    pRefTable.reset( new CRefTable( escrido::oDocumentation.GetSymbolTable() ) );
+    escrido::oDocumentation.CreateRefTable( sWDOutputPostfix, *pRefTable );
+    pWriteInfo.reset( new SWriteInfo( *pRefTable, asRelabel ) );
+    escrido::ResolveRefs( escrido::oDocumentation, *pWriteInfo );
+    pWriteInfo->fInternalTags = fInternalTags;
+  };
+
+  // Answers a request of the documentation server.
+  auto ServeRequest = [&]( httpserv::SRequest& oRequest_io )
+  {
+    if( oRequest_io.sMethod != "GET" && oRequest_io.sMethod != "HEAD" )
+    {
+      oServer.Respond( oRequest_io, 405, "text/plain", "Method not allowed\n" );
+      return;
+    }
+
+    // Path relative to the HTML directory.
+    std::string sURL = oRequest_io.sPath.substr( oRequest_io.sPath.empty() ? 0 : 1 );
+    if( sURL.empty() )
+      sURL = "index" + sWDOutputPostfix;
+    if( sURL.find( ".." ) != std::string::npos )
+    {
+      oServer.Respond( oRequest_io, 400, "text/plain", "Bad request\n" );
+      return;
+    }
+
+    std::cout << oRequest_io.sMethod << " /" << sURL << " ";
+
+    // Rendered pages and the search index are kept in the cache.
+    std::map<std::string, std::string>::const_iterator iCached = oPageCache.find( sURL );
+    if( iCached != oPageCache.end() )
+    {
+      std::cout << "(cached)" << std::endl;
+      oServer.Respond( oRequest_io, 200, httpserv::GetContentType( sURL ), iCached->second );
+      return;
+    }
+
+    std::string sDocument;
+    if( fSearchIndex && sURL == sSeachIndexFile )
+    {
+      outbuf::COutBuffer oOutBuf;
+      escrido::oDocumentation.WriteHTMLSearchIndex( oOutBuf, sWDOutputPostfix, *pWriteInfo, fSearchIdxEncode );
+      sDocument = oOutBuf.str();
+    }
+    else if( !escrido::oDocumentation.GetHTMLPage( sURL, sTemplateDir, sWDOutputPostfix, *pWriteInfo, sDocument ) )
+    {
+      // Other files are served from the HTML output directory.
+      // (A directory can be opened but not read: the read throws.)
+      std::ifstream oInFile( ( sWDOutputDir + sURL ).c_str(), std::ifstream::in | std::ifstream::binary );
+      bool fRead = oInFile.is_open();
+      if( fRead )
+        try
+        {
+          sDocument.assign( (std::istreambuf_iterator<char>( oInFile )),
+                            std::istreambuf_iterator<char>() );
+        }
+        catch( const std::ios_base::failure& )
+        {
+          fRead = false;
+        }
+      if( !fRead )
+      {
+        std::cout << "(not found)" << std::endl;
+        oServer.Respond( oRequest_io, 404, "text/plain", "Not found\n" );
+        return;
+      }
+
+      std::cout << "(file)" << std::endl;
+      oServer.Respond( oRequest_io, 200, httpserv::GetContentType( sURL ), sDocument );
+      return;
+    }
+
+    std::cout << "(rendered)" << std::endl;
+    oServer.Respond( oRequest_io, 200, httpserv::GetContentType( sURL ), sDocument );
+    oPageCache[sURL].swap( sDocument );
+  };
+
+  // Initial run.
+  std::cout << "Scanning file(s):" << std::endl
+            << std::endl;
+  ResolveFiles();
+  ParseChangedFiles();
+  Assemble();
+  sTemplateStamp = GetTemplateStamp();
+  oWatcher.AddDir( sTemplateDir );
+
+  if( nServePort != 0 )
+  {
+    if( !oServer.Open( static_cast<unsigned short>( nServePort ) ) )
+    {
+      std::cerr << "error: server port " << nServePort << " cannot be opened" << std::endl;
+      return 1;
+    }
+    sNavSignature = GetNavSignature( escrido::oDocumentation );
+    PrepareWriteInfo();
+
+    std::cout << "Serving " << escrido::oDocumentation.GetDocPageN() << " page(s) on http://127.0.0.1:" << nServePort << "/" << std::endl;
+  }
+  else if( oaOutputVariants.empty() )
+  {
+    sNavSignature = GetNavSignature( escrido::oDocumentation );
+    GenerateOutput( escrido::oDocumentation );
+  }
+  else
+    GenerateOutputVariants();
+
+  std::cout << "Watching " << asFileList.size() << " file(s) for changes (press Ctrl+C to stop)" << std::endl
+            << std::endl;
+
+  std::chrono::steady_clock::time_point oLastCheck = std::chrono::steady_clock::now();
+  for( ;; )
+  {
+    bool fStructural;
+    if( nServePort != 0 )
+    {
+      // Answer requests and look for changes in between.
+      httpserv::SRequest oRequest;
+      if( oServer.Accept( 200, oRequest ) )
+        ServeRequest( oRequest );
+
+      // (When polling, the files are checked at most once per second.)
+      if( !oWatcher.IsNative() && std::chrono::steady_clock::now() - oLastCheck < std::chrono::seconds( 1 ) )
+        continue;
+      oLastCheck = std::chrono::steady_clock::now();
+
+      if( !oWatcher.Wait( 0, fStructural ) )
+        continue;
+    }
+    else if( !oWatcher.Wait( -1, fStructural ) )
+      continue;
+
+    // Wait until a burst of events (e.g. from saving in an editor) is over.
+    if( oWatcher.IsNative() )
+    {
+      bool fStructuralMore;
+      while( oWatcher.Wait( 100, fStructuralMore ) )
+        fStructural = fStructural || fStructuralMore;
+    }
+
+    const std::chrono::steady_clock::time_point oStartTime = std::chrono::steady_clock::now();
+
+    // Files may have been created or removed: resolve the include paths again.
+    if( fStructural )
+      ResolveFiles();
+
+    const bool fSourceChanged = ParseChangedFiles();
+    const std::string sNewTemplateStamp = GetTemplateStamp();
+    const bool fTemplateChanged = ( sNewTemplateStamp != sTemplateStamp );
+    if( !fSourceChanged && !fTemplateChanged )
+      continue;
+    sTemplateStamp = sNewTemplateStamp;
+
+    const std::set<std::string> asDirtyPageSet = Assemble();
+
+    // Server: drop the cached documents of the changed files or all of them.
+    size_t nPageN = escrido::oDocumentation.GetDocPageN();
+    if( nServePort != 0 )
+    {
+      PrepareWriteInfo();
+
+      const std::string sNewNavSignature = GetNavSignature( escrido::oDocumentation );
+      if( fTemplateChanged || sNewNavSignature != sNavSignature || asDirtyPageSet.count( "mainpage" ) > 0 )
+      {
+        sNavSignature = sNewNavSignature;
+        oPageCache.clear();
+      }
+      else
+      {
+        nPageN = 0;
+        oPageCache.erase( sSeachIndexFile );
+        for( size_t p = 0; p < escrido::oDocumentation.GetDocPageN(); p++ )
+          if( asDirtyPageSet.count( escrido::oDocumentation.GetDocPage( p ).GetIdent() ) > 0 )
+          {
+            oPageCache.erase( escrido::oDocumentation.GetDocPage( p ).GetURL( sWDOutputPostfix ) );
+            nPageN++;
+          }
+      }
+
+      const double dMilliseconds = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - oStartTime ).count();
+      std::cout << "Invalidated " << nPageN << " of " << escrido::oDocumentation.GetDocPageN()
+                << " page(s) in " << static_cast<long>( dMilliseconds ) << " ms" << std::endl
+                << std::endl;
+      continue;
+    }
+
+    // Write either the pages of the changed files or everything.
+    if( oaOutputVariants.empty() )
+    {
+      const std::string sNewNavSignature = GetNavSignature( escrido::oDocumentation );
+      if( fTemplateChanged || sNewNavSignature != sNavSignature || asDirtyPageSet.count( "mainpage" ) > 0 )
+      {
+        sNavSignature = sNewNavSignature;
+        GenerateOutput( escrido::oDocumentation );
+      }
+      else
+      {
+        std::vector<bool> faPageSelect( escrido::oDocumentation.GetDocPageN(), false );
+        nPageN = 0;
+        for( size_t p = 0; p < faPageSelect.size(); p++ )
+          if( asDirtyPageSet.count( escrido::oDocumentation.GetDocPage( p ).GetIdent() ) > 0 )
+          {
+            faPageSelect[p] = true;
+            nPageN++;
+          }
+        GenerateOutput( escrido::oDocumentation, faPageSelect );
+      }
+    }
+    else
+      GenerateOutputVariants();
+
+    const double dMilliseconds = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - oStartTime ).count();
+    std::cout << "Regenerated " << nPageN << " of " << escrido::oDocumentation.GetDocPageN()
+              << " page(s) in " << static_cast<long>( dMilliseconds ) << " ms" << std::endl
+              << std::endl;
+  }
+
+  return 0;
 }
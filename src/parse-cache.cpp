@@ -0,0 +1,413 @@
+// -----------------------------------------------------------------------------
+/// \file       parse-cache.cpp
+///
+/// \brief      Module implementation file for the persistent parse cache of
+///             Escrido, i.e. the binary storage of the parse results of input
+///             files.
+// -----------------------------------------------------------------------------
+
+#include "parse-cache.h"
+
+#include <cstdio>           // std::rename, std::remove
+#include <cstring>          // memcmp
+#include <fstream>          // std::ifstream, std::ofstream
+
+#ifdef FILESYS_UNIX
+#include <fcntl.h>          // open
+#include <unistd.h>         // close
+#include <sys/mman.h>       // mmap, munmap
+#include <sys/stat.h>       // fstat
+#endif
+
+#include "binstream.h"
+
+// -----------------------------------------------------------------------------
+
+// LOCAL CONSTANTS
+
+// -----------------------------------------------------------------------------
+
+namespace
+{
+  /// Identifier at the beginning of a cache file.
+  const char szCacheMagic[8] = { 'E', 'S', 'C', 'P', 'C', 'A', 'C', 'H' };
+
+  /// Version of the cache file format. (Must be increased whenever the
+  /// serialization or the parse results of the scanner and parser change.)
+  const uint32_t nCacheVersion = 3;
+}
+
+// -----------------------------------------------------------------------------
+
+// CLASS CParseCache
+
+// -----------------------------------------------------------------------------
+
+escrido::CParseCache::CParseCache():
+  pMapping    ( NULL ),
+  nMappingLen ( 0 ),
+  fModified   ( false )
+{}
+
+// .............................................................................
+
+escrido::CParseCache::~CParseCache()
+{
+  Unmap();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Loads the cache file.
+///
+/// \param[in]  sFileName_i
+///             Name of the cache file.
+///
+/// \return     'true' if the cache file was loaded or does not exist yet,
+///             'false' if it is invalid or of another format version (the
+///             cache starts empty then).
+// *****************************************************************************
+
+bool escrido::CParseCache::Load( const std::string& sFileName_i )
+{
+  oEntryMap.clear();
+  sFileData.clear();
+  Unmap();
+
+  const char* pPos = NULL;
+  const char* pEnd = NULL;
+
+#ifdef FILESYS_UNIX
+  const int nFd = open( sFileName_i.c_str(), O_RDONLY );
+  if( nFd < 0 )
+    return true;
+
+  struct stat oStat;
+  if( fstat( nFd, &oStat ) == 0 && oStat.st_size > 0 )
+  {
+    void* pMap = mmap( NULL, oStat.st_size, PROT_READ, MAP_PRIVATE, nFd, 0 );
+    if( pMap != MAP_FAILED )
+    {
+      pMapping = pMap;
+      nMappingLen = oStat.st_size;
+      pPos = static_cast<const char*>( pMapping );
+      pEnd = pPos + nMappingLen;
+    }
+  }
+  close( nFd );
+#else
+  std::ifstream oInFile( sFileName_i.c_str(), std::ifstream::in | std::ifstream::binary );
+  if( !oInFile.is_open() )
+    return true;
+  sFileData.assign( (std::istreambuf_iterator<char>( oInFile )),
+                    std::istreambuf_iterator<char>() );
+  pPos = sFileData.data();
+  pEnd = pPos + sFileData.size();
+#endif
+
+  if( pPos == NULL || !ReadEntries( pPos, pEnd ) )
+  {
+    oEntryMap.clear();
+    sFileData.clear();
+    Unmap();
+    return false;
+  }
+
+  return true;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Writes the cache file, if any entry was stored, updated or
+///             dropped.
+///
+/// \param[in]  sFileName_i
+///             Name of the cache file.
+///
+/// \return     'true' on success, 'false' if the file cannot be written.
+// *****************************************************************************
+
+bool escrido::CParseCache::Write( const std::string& sFileName_i )
+{
+  bool fChanged = fModified;
+  for( std::map<std::string, SEntry>::const_iterator iEntry = oEntryMap.begin(); iEntry != oEntryMap.end(); ++iEntry )
+    if( !iEntry->second.fUsed )
+      fChanged = true;
+  if( !fChanged )
+    return true;
+
+  // Drop unused entries.
+  for( std::map<std::string, SEntry>::iterator iEntry = oEntryMap.begin(); iEntry != oEntryMap.end(); )
+    if( !iEntry->second.fUsed )
+      iEntry = oEntryMap.erase( iEntry );
+    else
+      ++iEntry;
+
+  const std::string sTmpFileName = sFileName_i + ".tmp";
+  {
+    std::ofstream oOutFile( sTmpFileName.c_str(), std::ofstream::out | std::ofstream::binary | std::ofstream::trunc );
+    if( !oOutFile.is_open() )
+      return false;
+
+    std::string sHead( szCacheMagic, sizeof( szCacheMagic ) );
+    binstream::Write( sHead, nCacheVersion );
+    binstream::Write( sHead, static_cast<uint32_t>( oEntryMap.size() ) );
+    oOutFile.write( sHead.data(), sHead.size() );
+
+    // Unchanged entries are copied unmodified from the mapping.
+    for( std::map<std::string, SEntry>::const_iterator iEntry = oEntryMap.begin(); iEntry != oEntryMap.end(); ++iEntry )
+    {
+      const SEntry& oEntry = iEntry->second;
+      std::string sEntryHead;
+      binstream::WriteString( sEntryHead, iEntry->first );
+      binstream::Write( sEntryHead, oEntry.nSize );
+      binstream::Write( sEntryHead, oEntry.nMTime );
+      binstream::Write( sEntryHead, oEntry.nHash );
+      binstream::Write( sEntryHead, static_cast<uint32_t>( oEntry.nDataLen ) );
+      oOutFile.write( sEntryHead.data(), sEntryHead.size() );
+      oOutFile.write( oEntry.pData, oEntry.nDataLen );
+    }
+
+    oOutFile.close();
+    if( oOutFile.fail() )
+    {
+      std::remove( sTmpFileName.c_str() );
+      return false;
+    }
+  }
+
+  // Replace the old file. (The mapping of the old file stays valid on POSIX
+  // systems; on other systems the file is not mapped.)
+#ifndef FILESYS_UNIX
+  std::remove( sFileName_i.c_str() );
+#endif
+  if( std::rename( sTmpFileName.c_str(), sFileName_i.c_str() ) != 0 )
+  {
+    std::remove( sTmpFileName.c_str() );
+    return false;
+  }
+
+  fModified = false;
+  return true;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Looks up the parse events of a file.
+///
+/// \param[in]  sPath_i
+///             Path of the file.
+/// \param[in]  nSize_i
+///             Size of the file content.
+/// \param[in]  nMTime_i
+///             Modification time of the file.
+/// \param[in]  nHash_i
+///             Hash of the file content (see \ref Hash()).
+/// \param[out] oaParseRecord_o
+///             Returns the parse events of the file.
+///
+/// \return     'true' if a valid entry was found, 'false' otherwise.
+// *****************************************************************************
+
+bool escrido::CParseCache::Lookup( const std::string& sPath_i,
+                                   long long nSize_i,
+                                   long long nMTime_i,
+                                   uint64_t nHash_i,
+                                   std::vector<SParseEvent>& oaParseRecord_o )
+{
+  std::map<std::string, SEntry>::iterator iEntry = oEntryMap.find( sPath_i );
+  if( iEntry == oEntryMap.end() )
+    return false;
+
+  SEntry& oEntry = iEntry->second;
+  if( oEntry.nSize != nSize_i || oEntry.nHash != nHash_i ||
+      !DeserializeRecord( oEntry.pData, oEntry.pData + oEntry.nDataLen, oaParseRecord_o ) )
+  {
+    oaParseRecord_o.clear();
+    return false;
+  }
+
+  // The content is unchanged: only update the modification time.
+  if( oEntry.nMTime != nMTime_i )
+  {
+    oEntry.nMTime = nMTime_i;
+    fModified = true;
+  }
+  oEntry.fUsed = true;
+
+  return true;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Stores the parse events of a file.
+///
+/// \param[in]  sPath_i
+///             Path of the file.
+/// \param[in]  nSize_i
+///             Size of the file content.
+/// \param[in]  nMTime_i
+///             Modification time of the file.
+/// \param[in]  nHash_i
+///             Hash of the file content (see \ref Hash()).
+/// \param[in]  oaParseRecord_i
+///             The parse events of the file.
+// *****************************************************************************
+
+void escrido::CParseCache::Store( const std::string& sPath_i,
+                                  long long nSize_i,
+                                  long long nMTime_i,
+                                  uint64_t nHash_i,
+                                  const std::vector<SParseEvent>& oaParseRecord_i )
+{
+  SEntry& oEntry = oEntryMap[sPath_i];
+  oEntry.nSize = nSize_i;
+  oEntry.nMTime = nMTime_i;
+  oEntry.nHash = nHash_i;
+  oEntry.sData.clear();
+  SerializeRecord( oaParseRecord_i, oEntry.sData );
+  oEntry.pData = oEntry.sData.data();
+  oEntry.nDataLen = oEntry.sData.size();
+  oEntry.fUsed = true;
+
+  fModified = true;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Calculates the hash of a file content (64 bit FNV-1a).
+// *****************************************************************************
+
+uint64_t escrido::CParseCache::Hash( const std::string& sData_i )
+{
+  uint64_t nHash = 14695981039346656037ULL;
+  const unsigned char* pPos = reinterpret_cast<const unsigned char*>( sData_i.data() );
+  const unsigned char* pEnd = pPos + sData_i.size();
+  for( ; pPos < pEnd; ++pPos )
+  {
+    nHash ^= *pPos;
+    nHash *= 1099511628211ULL;
+  }
+
+  return nHash;
+}
+
+// .............................................................................
+
+void escrido::CParseCache::Unmap()
+{
+#ifdef FILESYS_UNIX
+  if( pMapping != NULL )
+    munmap( pMapping, nMappingLen );
+#endif
+  pMapping = NULL;
+  nMappingLen = 0;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Reads the header and the entry index of a cache file content.
+///             The serialized parse events are not decoded.
+///
+/// \return     'true' on success, 'false' if the content is invalid.
+// *****************************************************************************
+
+bool escrido::CParseCache::ReadEntries( const char* pPos_i, const char* pEnd_i )
+{
+  const char* pPos = pPos_i;
+  if( pEnd_i - pPos < static_cast<ptrdiff_t>( sizeof( szCacheMagic ) ) ||
+      memcmp( pPos, szCacheMagic, sizeof( szCacheMagic ) ) != 0 )
+    return false;
+  pPos += sizeof( szCacheMagic );
+
+  uint32_t nVersion, nEntryN;
+  if( !binstream::Read( pPos, pEnd_i, nVersion ) || nVersion != nCacheVersion ||
+      !binstream::Read( pPos, pEnd_i, nEntryN ) )
+    return false;
+
+  for( uint32_t e = 0; e < nEntryN; e++ )
+  {
+    std::string sPath;
+    SEntry oEntry;
+    uint32_t nDataLen;
+    if( !binstream::ReadString( pPos, pEnd_i, sPath ) ||
+        !binstream::Read( pPos, pEnd_i, oEntry.nSize ) ||
+        !binstream::Read( pPos, pEnd_i, oEntry.nMTime ) ||
+        !binstream::Read( pPos, pEnd_i, oEntry.nHash ) ||
+        !binstream::Read( pPos, pEnd_i, nDataLen ) ||
+        static_cast<size_t>( pEnd_i - pPos ) < nDataLen )
+      return false;
+
+    oEntry.pData = pPos;
+    oEntry.nDataLen = nDataLen;
+    oEntry.fUsed = false;
+    pPos += nDataLen;
+
+    oEntryMap[sPath] = oEntry;
+  }
+
+  return true;
+}
+
+// .............................................................................
+
+/// Appends the binary representation of a list of parse events to a buffer.
+void escrido::CParseCache::SerializeRecord( const std::vector<SParseEvent>& oaParseRecord_i, std::string& sBuffer_io )
+{
+  binstream::Write( sBuffer_io, static_cast<uint32_t>( oaParseRecord_i.size() ) );
+  for( size_t e = 0; e < oaParseRecord_i.size(); e++ )
+  {
+    const SParseEvent& oEvent = oaParseRecord_i[e];
+    binstream::Write( sBuffer_io, oEvent.fType );
+    if( oEvent.fType == parse_event_type::CONTENT_UNIT )
+      oEvent.oContUnit.Serialize( sBuffer_io );
+    else
+      binstream::WriteString( sBuffer_io, oEvent.sText );
+  }
+}
+
+// .............................................................................
+
+/// Restores a list of parse events from its binary representation. Returns
+/// 'false' if the data is corrupted.
+bool escrido::CParseCache::DeserializeRecord( const char* pPos_i, const char* pEnd_i, std::vector<SParseEvent>& oaParseRecord_o )
+{
+  const char* pPos = pPos_i;
+  uint32_t nEventN;
+  if( !binstream::Read( pPos, pEnd_i, nEventN ) ||
+      nEventN > static_cast<size_t>( pEnd_i - pPos ) )
+    return false;
+
+  oaParseRecord_o.resize( nEventN );
+  for( size_t e = 0; e < oaParseRecord_o.size(); e++ )
+  {
+    SParseEvent& oEvent = oaParseRecord_o[e];
+    if( !binstream::Read( pPos, pEnd_i, oEvent.fType ) )
+      return false;
+
+    switch( oEvent.fType )
+    {
+      case parse_event_type::CONTENT_UNIT:
+        if( !oEvent.oContUnit.Deserialize( pPos, pEnd_i ) )
+          return false;
+        break;
+
+      case parse_event_type::NEW_PAGE:
+      case parse_event_type::HEADLINE:
+        if( !binstream::ReadString( pPos, pEnd_i, oEvent.sText ) )
+          return false;
+        break;
+
+      default:
+        return false;
+    }
+  }
+
+  return pPos == pEnd_i;
+}
@@ -0,0 +1,120 @@
+#ifndef PARSE_CACHE_ALLREADY_READ_IN
+#define PARSE_CACHE_ALLREADY_READ_IN
+
+// -----------------------------------------------------------------------------
+/// \file       parse-cache.h
+///
+/// \brief      Module header for the persistent parse cache of Escrido, i.e.
+///             the binary storage of the parse results of input files.
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>          // uint64_t
+
+#include "escrido-doc.h"
+
+// -----------------------------------------------------------------------------
+
+// CLASSES OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+// *********************
+// *                   *
+// *    CParseCache    *
+// *                   *
+// *********************
+
+namespace escrido
+{
+  class CParseCache;
+}
+
+// -----------------------------------------------------------------------------
+
+// CLASS CParseCache
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Cache of the parse events of input files (see
+///             \ref CDocumentation::Replay()) that is stored in a binary file.
+///
+/// \details    Every entry is keyed by the file path, the file size, the
+///             modification time and a hash of the file content. An entry is
+///             valid if size and hash of the file content match; a differing
+///             modification time alone (e.g. after a checkout) only updates
+///             the entry.
+///
+///             On POSIX systems the cache file is mapped into memory, so the
+///             entries are only decoded on lookup. The file is written
+///             through a temporary file that replaces the old one, which keeps
+///             the mapping valid. Entries that were neither looked up nor
+///             stored during the run are dropped on writing.
+// *****************************************************************************
+
+class escrido::CParseCache
+{
+  private:
+
+    /// A cache entry.
+    struct SEntry
+    {
+      long long   nSize;          ///< Size of the file.
+      long long   nMTime;         ///< Modification time of the file.
+      uint64_t    nHash;          ///< Hash of the file content.
+      const char* pData;          ///< Serialized parse events (inside the file mapping or sData).
+      size_t      nDataLen;       ///< Length of the serialized parse events.
+      std::string sData;          ///< Serialized parse events stored during the run.
+      bool        fUsed;          ///< Flag whether the entry was looked up or stored during the run.
+    };
+
+    std::map <std::string, SEntry> oEntryMap; ///< Entries by file path.
+    std::string sFileData;                    ///< Content of the cache file (if it is not mapped).
+    void* pMapping;                           ///< Memory mapping of the cache file (NULL: not mapped).
+    size_t nMappingLen;                       ///< Length of the memory mapping.
+    bool fModified;                           ///< Flag whether entries were stored or updated.
+
+  public:
+
+    // Constructor, destructor:
+    CParseCache();
+    ~CParseCache();
+    CParseCache( const CParseCache& ) = delete;
+    CParseCache& operator=( const CParseCache& ) = delete;
+
+    // Cache file:
+    bool Load( const std::string& sFileName_i );
+    bool Write( const std::string& sFileName_i );
+
+    // Entries:
+    bool Lookup( const std::string& sPath_i,
+                 long long nSize_i,
+                 long long nMTime_i,
+                 uint64_t nHash_i,
+                 std::vector<SParseEvent>& oaParseRecord_o );
+    void Store( const std::string& sPath_i,
+                long long nSize_i,
+                long long nMTime_i,
+                uint64_t nHash_i,
+                const std::vector<SParseEvent>& oaParseRecord_i );
+
+    static uint64_t Hash( const std::string& sData_i );
+
+  private:
+
+    void Unmap();
+    bool ReadEntries( const char* pPos_i, const char* pEnd_i );
+    static void SerializeRecord( const std::vector<SParseEvent>& oaParseRecord_i, std::string& sBuffer_io );
+    static bool DeserializeRecord( const char* pPos_i, const char* pEnd_i, std::vector<SParseEvent>& oaParseRecord_o );
+};
+
+#endif /* PARSE_CACHE_ALLREADY_READ_IN */
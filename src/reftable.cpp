@@ -10,8 +10,21 @@
 // -----------------------------------------------------------------------------
 
 #include "reftable.h"
+#include "stats.h"      // oRunStats
 
 #include <iostream>     // std::cout, std::cin, std::cerr, std::endl
+#include <atomic>       // std::atomic
+
+// -----------------------------------------------------------------------------
+
+// LOCAL VARIABLES
+
+// -----------------------------------------------------------------------------
+
+namespace
+{
+  std::atomic <unsigned long> nNextStamp( 1 );   ///< Next reference table stamp.
+}
 
 // -----------------------------------------------------------------------------
 
@@ -33,7 +46,9 @@ escrido::CRef::CRef( const std::string& sIdent_i,
 
 // -----------------------------------------------------------------------------
 
-escrido::CRefTable::CRefTable()
+escrido::CRefTable::CRefTable( CSymbolTable& oSymbolTable_i ) :
+  oSymbolTable ( oSymbolTable_i ),
+  nStamp       ( nNextStamp++ )
 {}
 
 // .............................................................................
@@ -41,7 +56,9 @@ escrido::CRefTable::CRefTable()
 void escrido::CRefTable::AppendRef( const std::string& sIdent_i,
                                     const std::string& sLink_i )
 {
+  oRefIdxMap.insert( std::make_pair( oSymbolTable.Intern( sIdent_i ), oaRefList.size() ) );
   oaRefList.emplace_back( sIdent_i, sLink_i, sIdent_i );
+  nStamp = nNextStamp++;
 }
 
 // .............................................................................
@@ -50,7 +67,9 @@ void escrido::CRefTable::AppendRef( const std::string& sIdent_i,
                                     const std::string& sLink_i,
                                     const std::string& sText_i )
 {
+  oRefIdxMap.insert( std::make_pair( oSymbolTable.Intern( sIdent_i ), oaRefList.size() ) );
   oaRefList.emplace_back( sIdent_i, sLink_i, sText_i );
+  nStamp = nNextStamp++;
 }
 
 // .............................................................................
@@ -69,16 +88,44 @@ void escrido::CRefTable::AppendRef( const std::string& sIdent_i,
 
 bool escrido::CRefTable::GetRefIdx( const std::string& sIdent_i, size_t& nRefIdx_o ) const
 {
-  for( size_t r = 0; r < oaRefList.size(); r++ )
+  // Identifiers that are not interned cannot be in the table.
+  symbol_id nIdent;
+  if( !oSymbolTable.Find( sIdent_i, nIdent ) )
   {
-    if( oaRefList[r].sIdent == sIdent_i )
-    {
-      nRefIdx_o = r;
-      return true;
-    }
+    oRunStats.nRefLookups++;
+    return false;
   }
 
-  return false;
+  return this->GetRefIdx( nIdent, nRefIdx_o );
+}
+
+// .............................................................................
+
+/// Symbol version of GetRefIdx() (see CSymbolTable).
+bool escrido::CRefTable::GetRefIdx( symbol_id nIdent_i, size_t& nRefIdx_o ) const
+{
+  oRunStats.nRefLookups++;
+
+  std::unordered_map <symbol_id, size_t>::const_iterator iRef = oRefIdxMap.find( nIdent_i );
+  if( iRef == oRefIdxMap.end() )
+    return false;
+
+  nRefIdx_o = iRef->second;
+  return true;
+}
+
+// .............................................................................
+
+size_t escrido::CRefTable::GetRefN() const
+{
+  return oaRefList.size();
+}
+
+// .............................................................................
+
+const std::string& escrido::CRefTable::GetIdent( size_t nRefIdx_i ) const
+{
+  return oaRefList[nRefIdx_i].sIdent;
 }
 
 // .............................................................................
@@ -100,3 +147,17 @@ const std::string& escrido::CRefTable::GetText( size_t nRefIdx_i ) const
   else
     return std::string();
 }
+
+// .............................................................................
+
+// *****************************************************************************
+/// @brief      Returns the stamp of the table content. The stamp differs for
+///             every table and changes with every appended reference, so
+///             references resolved against the table can be checked for
+///             being up to date (copies of a table share the stamp).
+// *****************************************************************************
+
+unsigned long escrido::CRefTable::GetStamp() const
+{
+  return nStamp;
+}
@@ -19,6 +19,9 @@
 
 #include <string>
 #include <vector>
+#include <unordered_map>
+
+#include "symtable.h"
 
 // -----------------------------------------------------------------------------
 
@@ -75,12 +78,15 @@ class escrido::CRefTable
 {
   private:
 
+    CSymbolTable& oSymbolTable; ///< Symbol table of the identifiers (the one of the documentation).
     std::vector <CRef> oaRefList;
+    std::unordered_map <symbol_id, size_t> oRefIdxMap; ///< Index of the first reference of every identifier.
+    unsigned long nStamp;       ///< Stamp of the table content (unique for every table and modification).
 
   public:
 
     // Constructor, destructor:
-    CRefTable();
+    CRefTable( CSymbolTable& oSymbolTable_i );
 
     // Access methods:
     void AppendRef( const std::string& sIdent_i,
@@ -89,9 +95,13 @@ class escrido::CRefTable
                     const std::string& sLink_i,
                     const std::string& sText_i );
 
+    size_t GetRefN() const;
     bool GetRefIdx( const std::string& sIdent_i, size_t& nRefIdx_o ) const;
+    bool GetRefIdx( symbol_id nIdent_i, size_t& nRefIdx_o ) const;
+    const std::string& GetIdent( size_t nRefIdx_i ) const;
     std::string GetLink( size_t nRefIdx_i ) const;
     const std::string& GetText( size_t nRefIdx_i ) const;
+    unsigned long GetStamp() const;
 };
 
 #endif /* REFTABLE_ALLREADY_READ_IN */
@@ -0,0 +1,433 @@
+// -----------------------------------------------------------------------------
+/// \file       stats.cpp
+///
+/// \brief      Module implementation file for the run statistics of Escrido:
+///             phase timers, counters and the trace event recording.
+// -----------------------------------------------------------------------------
+
+#include "stats.h"
+
+#include <fstream>      // std::ofstream
+#include <iomanip>      // std::setw, std::setprecision
+
+#ifdef FILESYS_UNIX
+#include <sys/resource.h>   // getrusage
+#endif
+
+// -----------------------------------------------------------------------------
+
+// GLOBAL VARIABLES
+
+// -----------------------------------------------------------------------------
+
+namespace escrido
+{
+  SRunStats oRunStats;          ///< Statistics of the run (timers and counters).
+}
+
+// -----------------------------------------------------------------------------
+
+// STRUCT SRunStats
+
+// -----------------------------------------------------------------------------
+
+escrido::SRunStats::SRunStats() :
+  fEnabled      ( false ),
+  nDepth        ( 0 ),
+  nFilesScanned ( 0 ),
+  nFilesSkipped ( 0 ),
+  nFilesCached  ( 0 ),
+  nBytesRead    ( 0 ),
+  nTokens       ( 0 ),
+  nPages        ( 0 ),
+  nPagesDropped ( 0 ),
+  nBlocks       ( 0 ),
+  nChunks       ( 0 ),
+  nRefLookups   ( 0 ),
+  nBytesWritten ( 0 ),
+  fTrace        ( false )
+{}
+
+// .............................................................................
+
+escrido::SRunStats::~SRunStats()
+{
+  for( size_t b = 0; b < paTraceBufferList.size(); b++ )
+    delete paTraceBufferList[b];
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Enters a phase.
+///
+/// \details    A phase that is called repeatedly is listed only once. Its
+///             times are accumulated.
+///
+/// \param[in]  szName_i
+///             Name of the phase.
+///
+/// \return     The index of the phase in the phase list.
+// *****************************************************************************
+
+size_t escrido::SRunStats::BeginPhase( const char* szName_i )
+{
+  size_t nPhaseIdx;
+  for( nPhaseIdx = 0; nPhaseIdx < oaPhaseList.size(); nPhaseIdx++ )
+    if( oaPhaseList[nPhaseIdx].sName == szName_i )
+      break;
+
+  if( nPhaseIdx == oaPhaseList.size() )
+  {
+    SPhase oPhase;
+    oPhase.sName = szName_i;
+    oPhase.nDepth = nDepth;
+    oPhase.nCallN = 0;
+    oPhase.dSeconds = 0.0;
+    oaPhaseList.push_back( oPhase );
+  }
+
+  nDepth++;
+  return nPhaseIdx;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Leaves a phase.
+///
+/// \param[in]  nPhaseIdx_i
+///             The index of the phase as returned by BeginPhase().
+/// \param[in]  dSeconds_i
+///             Time spent in the phase in seconds.
+// *****************************************************************************
+
+void escrido::SRunStats::EndPhase( size_t nPhaseIdx_i, double dSeconds_i )
+{
+  oaPhaseList[nPhaseIdx_i].nCallN++;
+  oaPhaseList[nPhaseIdx_i].dSeconds += dSeconds_i;
+  nDepth--;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the peak resident set size of the process.
+///
+/// \return     The peak resident set size in kilobytes or -1 if not
+///             available.
+// *****************************************************************************
+
+long escrido::SRunStats::GetPeakRSS() const
+{
+#ifdef FILESYS_UNIX
+  struct rusage oUsage;
+  if( getrusage( RUSAGE_SELF, &oUsage ) != 0 )
+    return -1;
+#ifdef __APPLE__
+  // Mac OS reports bytes.
+  return oUsage.ru_maxrss / 1024;
+#else
+  return oUsage.ru_maxrss;
+#endif
+#else
+  return -1;
+#endif
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Writes the statistics as a human readable table.
+///
+/// \details    Nested phases are indented below the phase they were first
+///             called in. Their times are included in the time of that phase.
+// *****************************************************************************
+
+void escrido::SRunStats::WriteTable( std::ostream& oOutStrm_i ) const
+{
+  // Store the stream format in order to restore it afterwards.
+  const std::ios::fmtflags fFormat = oOutStrm_i.flags();
+  const std::streamsize nPrecision = oOutStrm_i.precision();
+
+  oOutStrm_i << "Statistics:" << std::endl
+             << std::endl
+             << std::left << std::setw( 36 ) << "Phase"
+             << std::right << std::setw( 8 ) << "Calls"
+             << std::setw( 14 ) << "Time [ms]" << std::endl;
+
+  for( size_t p = 0; p < oaPhaseList.size(); p++ )
+  {
+    const std::string sName = std::string( 2 * oaPhaseList[p].nDepth, ' ' ) + oaPhaseList[p].sName;
+    oOutStrm_i << std::left << std::setw( 36 ) << sName
+               << std::right << std::setw( 8 ) << oaPhaseList[p].nCallN
+               << std::setw( 14 ) << std::fixed << std::setprecision( 3 ) << oaPhaseList[p].dSeconds * 1000.0
+               << std::endl;
+  }
+
+  const long nPeakRSS = GetPeakRSS();
+
+  oOutStrm_i << std::endl
+             << std::left << std::setw( 36 ) << "Counter"
+             << std::right << std::setw( 22 ) << "Value" << std::endl
+             << std::left << std::setw( 36 ) << "files scanned" << std::right << std::setw( 22 ) << nFilesScanned << std::endl
+             << std::left << std::setw( 36 ) << "files skipped" << std::right << std::setw( 22 ) << nFilesSkipped << std::endl
+             << std::left << std::setw( 36 ) << "files from parse cache" << std::right << std::setw( 22 ) << nFilesCached << std::endl
+             << std::left << std::setw( 36 ) << "bytes read" << std::right << std::setw( 22 ) << nBytesRead << std::endl
+             << std::left << std::setw( 36 ) << "tokens" << std::right << std::setw( 22 ) << nTokens << std::endl
+             << std::left << std::setw( 36 ) << "pages" << std::right << std::setw( 22 ) << nPages << std::endl
+             << std::left << std::setw( 36 ) << "pages dropped" << std::right << std::setw( 22 ) << nPagesDropped << std::endl
+             << std::left << std::setw( 36 ) << "tag blocks" << std::right << std::setw( 22 ) << nBlocks << std::endl
+             << std::left << std::setw( 36 ) << "content chunks" << std::right << std::setw( 22 ) << nChunks << std::endl
+             << std::left << std::setw( 36 ) << "reference lookups" << std::right << std::setw( 22 ) << nRefLookups << std::endl
+             << std::left << std::setw( 36 ) << "bytes written" << std::right << std::setw( 22 ) << nBytesWritten << std::endl
+             << std::left << std::setw( 36 ) << "peak RSS [kB]" << std::right << std::setw( 22 );
+  if( nPeakRSS < 0 )
+    oOutStrm_i << "n/a";
+  else
+    oOutStrm_i << nPeakRSS;
+  oOutStrm_i << std::endl
+             << std::endl;
+
+  oOutStrm_i.flags( fFormat );
+  oOutStrm_i.precision( nPrecision );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Writes the statistics as a JSON object into a file.
+///
+/// \param[in]  sFileName_i
+///             Name of the output file.
+///
+/// \return     true on success, false if the file could not be written.
+// *****************************************************************************
+
+bool escrido::SRunStats::WriteJSON( const std::string& sFileName_i ) const
+{
+  std::ofstream oOutFile( sFileName_i.c_str(), std::ofstream::out );
+  if( !oOutFile.is_open() )
+    return false;
+
+  oOutFile << "{" << std::endl
+           << "   \"phases\":[" << std::endl;
+  for( size_t p = 0; p < oaPhaseList.size(); p++ )
+  {
+    // (Phase names are fixed literals without characters that need escaping.)
+    oOutFile << "      {\"name\":\"" << oaPhaseList[p].sName << "\","
+             << "\"depth\":" << oaPhaseList[p].nDepth << ","
+             << "\"calls\":" << oaPhaseList[p].nCallN << ","
+             << "\"seconds\":" << std::fixed << std::setprecision( 6 ) << oaPhaseList[p].dSeconds << "}";
+    if( p + 1 < oaPhaseList.size() )
+      oOutFile << ",";
+    oOutFile << std::endl;
+  }
+  oOutFile << "   ]," << std::endl
+           << "   \"counters\":{" << std::endl
+           << "      \"files_scanned\":" << nFilesScanned << "," << std::endl
+           << "      \"files_skipped\":" << nFilesSkipped << "," << std::endl
+           << "      \"files_cached\":" << nFilesCached << "," << std::endl
+           << "      \"bytes_read\":" << nBytesRead << "," << std::endl
+           << "      \"tokens\":" << nTokens << "," << std::endl
+           << "      \"pages\":" << nPages << "," << std::endl
+           << "      \"pages_dropped\":" << nPagesDropped << "," << std::endl
+           << "      \"tag_blocks\":" << nBlocks << "," << std::endl
+           << "      \"content_chunks\":" << nChunks << "," << std::endl
+           << "      \"reference_lookups\":" << nRefLookups << "," << std::endl
+           << "      \"bytes_written\":" << nBytesWritten << "," << std::endl
+           << "      \"peak_rss_kb\":" << GetPeakRSS() << std::endl
+           << "   }" << std::endl
+           << "}" << std::endl;
+
+  oOutFile.close();
+  return oOutFile.good();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Turns on the recording of trace events. The time stamps of the
+///             events are relative to the time of this call.
+// *****************************************************************************
+
+void escrido::SRunStats::StartTrace()
+{
+  fTrace = true;
+  oTraceStart = std::chrono::steady_clock::now();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Records a trace event into the buffer of the calling thread.
+///
+/// \details    The buffer of a thread is created on its first event. Only this
+///             step requires a lock; all further events of the thread are
+///             appended without synchronization.
+///
+/// \param[in]  szCategory_i
+///             Category of the event. Must be a string literal.
+/// \param[in]  sName_i
+///             Name of the event.
+/// \param[in]  oBegin_i
+///             Begin time of the event.
+/// \param[in]  oEnd_i
+///             End time of the event.
+// *****************************************************************************
+
+void escrido::SRunStats::AddTraceEvent( const char* szCategory_i,
+                                        const std::string& sName_i,
+                                        std::chrono::steady_clock::time_point oBegin_i,
+                                        std::chrono::steady_clock::time_point oEnd_i )
+{
+  static thread_local STraceBuffer* pTraceBuffer = NULL;
+  if( pTraceBuffer == NULL )
+  {
+    std::lock_guard<std::mutex> oLock( oTraceMutex );
+    pTraceBuffer = new STraceBuffer;
+    pTraceBuffer->nThreadID = paTraceBufferList.size() + 1;
+    paTraceBufferList.push_back( pTraceBuffer );
+  }
+
+  STraceEvent oEvent;
+  oEvent.szCategory = szCategory_i;
+  oEvent.sName = sName_i;
+  oEvent.dBeginUs = std::chrono::duration<double, std::micro>( oBegin_i - oTraceStart ).count();
+  oEvent.dDurationUs = std::chrono::duration<double, std::micro>( oEnd_i - oBegin_i ).count();
+  pTraceBuffer->oaEventList.push_back( oEvent );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Writes all recorded trace events into a file in the Chrome
+///             trace event format (JSON), e.g. for viewing in Perfetto.
+///
+/// \param[in]  sFileName_i
+///             Name of the output file.
+///
+/// \return     true on success, false if the file could not be written.
+// *****************************************************************************
+
+bool escrido::SRunStats::WriteTrace( const std::string& sFileName_i ) const
+{
+  std::ofstream oOutFile( sFileName_i.c_str(), std::ofstream::out );
+  if( !oOutFile.is_open() )
+    return false;
+
+  oOutFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << std::endl;
+
+  bool fFirst = true;
+  oOutFile << std::fixed << std::setprecision( 3 );
+  for( size_t b = 0; b < paTraceBufferList.size(); b++ )
+  {
+    const std::vector <STraceEvent>& oaEventList = paTraceBufferList[b]->oaEventList;
+    for( size_t e = 0; e < oaEventList.size(); e++ )
+    {
+      if( !fFirst )
+        oOutFile << "," << std::endl;
+      fFirst = false;
+
+      // Escape the name (e.g. file paths) for JSON.
+      std::string sName;
+      for( size_t c = 0; c < oaEventList[e].sName.size(); c++ )
+      {
+        const char cChar = oaEventList[e].sName[c];
+        if( cChar == '"' || cChar == '\\' )
+        {
+          sName += '\\';
+          sName += cChar;
+        }
+        else
+        if( static_cast<unsigned char>( cChar ) >= 0x20 )
+          sName += cChar;
+      }
+
+      oOutFile << "{\"name\":\"" << sName << "\","
+               << "\"cat\":\"" << oaEventList[e].szCategory << "\","
+               << "\"ph\":\"X\","
+               << "\"ts\":" << oaEventList[e].dBeginUs << ","
+               << "\"dur\":" << oaEventList[e].dDurationUs << ","
+               << "\"pid\":1,"
+               << "\"tid\":" << paTraceBufferList[b]->nThreadID << "}";
+    }
+  }
+
+  oOutFile << std::endl
+           << "]}" << std::endl;
+
+  oOutFile.close();
+  return oOutFile.good();
+}
+
+// -----------------------------------------------------------------------------
+
+// CLASS CPhaseTimer
+
+// -----------------------------------------------------------------------------
+
+escrido::CPhaseTimer::CPhaseTimer( const char* szName_i ) :
+  fActive    ( oRunStats.fEnabled ),
+  nPhaseIdx  ( 0 )
+{
+  if( fActive )
+  {
+    nPhaseIdx = oRunStats.BeginPhase( szName_i );
+    oStartTime = std::chrono::steady_clock::now();
+  }
+}
+
+// .............................................................................
+
+escrido::CPhaseTimer::~CPhaseTimer()
+{
+  if( !fActive )
+    return;
+
+  const std::chrono::steady_clock::time_point oEndTime = std::chrono::steady_clock::now();
+  const std::chrono::duration<double> oDuration = oEndTime - oStartTime;
+  oRunStats.EndPhase( nPhaseIdx, oDuration.count() );
+
+  // Phases appear in the trace as well.
+  if( oRunStats.fTrace )
+    oRunStats.AddTraceEvent( "phase", oRunStats.oaPhaseList[nPhaseIdx].sName, oStartTime, oEndTime );
+}
+
+// -----------------------------------------------------------------------------
+
+// CLASS CTraceSpan
+
+// -----------------------------------------------------------------------------
+
+escrido::CTraceSpan::CTraceSpan( const char* szCategory_i, const char* szName_i ) :
+  fActive    ( oRunStats.fTrace ),
+  szCategory ( szCategory_i )
+{
+  if( fActive )
+  {
+    sName = szName_i;
+    oStartTime = std::chrono::steady_clock::now();
+  }
+}
+
+// .............................................................................
+
+escrido::CTraceSpan::CTraceSpan( const char* szCategory_i, const std::string& sName_i ) :
+  fActive    ( oRunStats.fTrace ),
+  szCategory ( szCategory_i )
+{
+  if( fActive )
+  {
+    sName = sName_i;
+    oStartTime = std::chrono::steady_clock::now();
+  }
+}
+
+// .............................................................................
+
+escrido::CTraceSpan::~CTraceSpan()
+{
+  if( fActive )
+    oRunStats.AddTraceEvent( szCategory, sName, oStartTime, std::chrono::steady_clock::now() );
+}
@@ -0,0 +1,221 @@
+#ifndef STATS_ALLREADY_READ_IN
+#define STATS_ALLREADY_READ_IN
+
+// -----------------------------------------------------------------------------
+/// \file       stats.h
+///
+/// \brief      Module header for the run statistics of Escrido: phase timers,
+///             counters and the trace event recording.
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <chrono>
+#include <mutex>
+#include <atomic>
+
+// -----------------------------------------------------------------------------
+
+// CLASSES OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+// *********************
+// *                   *
+// *    SRunStats      *
+// *                   *
+// *********************
+
+// *********************
+// *                   *
+// *   CPhaseTimer     *
+// *                   *
+// *********************
+
+// *********************
+// *                   *
+// *    CTraceSpan     *
+// *                   *
+// *********************
+
+namespace escrido
+{
+  struct SRunStats;
+  struct STraceEvent;
+  struct STraceBuffer;
+  class CPhaseTimer;
+  class CTraceSpan;
+
+  extern SRunStats oRunStats;   // The statistics of the current run.
+}
+
+// -----------------------------------------------------------------------------
+
+// STRUCT STraceEvent
+
+// -----------------------------------------------------------------------------
+
+/// A recorded span of the trace (a "complete" event of the trace format).
+struct escrido::STraceEvent
+{
+  const char* szCategory;       ///< Category of the event (a string literal).
+  std::string sName;            ///< Name of the event, e.g. a file name.
+  double      dBeginUs;         ///< Begin time in microseconds since the start of the trace.
+  double      dDurationUs;      ///< Duration in microseconds.
+};
+
+// -----------------------------------------------------------------------------
+
+// STRUCT STraceBuffer
+
+// -----------------------------------------------------------------------------
+
+/// Event buffer of one thread. Each thread only writes into its own buffer.
+struct escrido::STraceBuffer
+{
+  unsigned int nThreadID;                 ///< Thread ID used in the trace output.
+  std::vector <STraceEvent> oaEventList;  ///< Recorded events.
+};
+
+// -----------------------------------------------------------------------------
+
+// STRUCT SRunStats
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Container of the statistics of a run.
+///
+/// \details    The phase list is filled by CPhaseTimer objects if fEnabled is
+///             set. The counters are incremented directly at the places where
+///             the counted events happen.
+///
+///             Library contexts (see CContext) can write output in parallel
+///             threads. Therefore phases are only timed on demand of the
+///             (single-threaded) command line program and the counters of the
+///             output are atomic. The counters of the input are only
+///             incremented by the command line program or while parsing,
+///             which is serialized.
+// *****************************************************************************
+
+struct escrido::SRunStats
+{
+  /// A phase of the run with its accumulated time.
+  struct SPhase
+  {
+    std::string  sName;         ///< Name of the phase.
+    unsigned int nDepth;        ///< Nesting depth of the phase on its first call.
+    size_t       nCallN;        ///< Number of calls.
+    double       dSeconds;      ///< Accumulated wall time in seconds.
+  };
+
+  bool fEnabled;                    ///< Flag whether phases are timed.
+  std::vector <SPhase> oaPhaseList; ///< List of phases in order of their first call.
+  unsigned int nDepth;              ///< Current nesting depth of phases.
+
+  // Counters:
+  size_t nFilesScanned;         ///< Number of input files scanned.
+  size_t nFilesSkipped;         ///< Number of input files skipped (no documentation markers).
+  size_t nFilesCached;          ///< Number of input files taken from the parse cache.
+  size_t nBytesRead;            ///< Number of bytes read from input files.
+  size_t nTokens;               ///< Number of scanner tokens inside of documentation units.
+  size_t nPages;                ///< Number of documentation pages.
+  size_t nPagesDropped;         ///< Number of pages dropped by the filters during parsing.
+  size_t nBlocks;               ///< Number of tag blocks of all pages.
+  size_t nChunks;               ///< Number of content chunks of all pages.
+  std::atomic <size_t> nRefLookups;   ///< Number of reference table lookups.
+  std::atomic <size_t> nBytesWritten; ///< Number of bytes written into output files.
+
+  // Trace recording:
+  bool fTrace;                                      ///< Flag whether trace events are recorded.
+  std::chrono::steady_clock::time_point oTraceStart;///< Start time of the trace.
+  std::vector <STraceBuffer*> paTraceBufferList;    ///< Event buffers of all threads.
+  std::mutex oTraceMutex;                           ///< Mutex for registering new thread buffers.
+
+  SRunStats();
+  ~SRunStats();
+
+  // Phase administration (used by CPhaseTimer):
+  size_t BeginPhase( const char* szName_i );
+  void EndPhase( size_t nPhaseIdx_i, double dSeconds_i );
+
+  // Resource usage:
+  long GetPeakRSS() const;
+
+  // Output methods:
+  void WriteTable( std::ostream& oOutStrm_i ) const;
+  bool WriteJSON( const std::string& sFileName_i ) const;
+
+  // Trace recording:
+  void StartTrace();
+  void AddTraceEvent( const char* szCategory_i,
+                      const std::string& sName_i,
+                      std::chrono::steady_clock::time_point oBegin_i,
+                      std::chrono::steady_clock::time_point oEnd_i );
+  bool WriteTrace( const std::string& sFileName_i ) const;
+};
+
+// -----------------------------------------------------------------------------
+
+// CLASS CPhaseTimer
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Scoped timer of a phase. If the statistics are enabled, the time
+///             between construction and destruction is added to the phase in
+///             escrido::oRunStats. Otherwise the timer does nothing.
+// *****************************************************************************
+
+class escrido::CPhaseTimer
+{
+  private:
+
+    bool fActive;                                       ///< Flag whether the phase is timed.
+    size_t nPhaseIdx;                                   ///< Index of the phase in the phase list.
+    std::chrono::steady_clock::time_point oStartTime;   ///< Point of time of the construction.
+
+  public:
+
+    // Constructor, destructor:
+    CPhaseTimer( const char* szName_i );
+    ~CPhaseTimer();
+};
+
+// -----------------------------------------------------------------------------
+
+// CLASS CTraceSpan
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      Scoped span of the trace. If tracing is turned on, the time
+///             between construction and destruction is recorded as a trace
+///             event. Otherwise the span does nothing.
+// *****************************************************************************
+
+class escrido::CTraceSpan
+{
+  private:
+
+    bool fActive;                                       ///< Flag whether the span is recorded.
+    const char* szCategory;                             ///< Category of the span.
+    std::string sName;                                  ///< Name of the span.
+    std::chrono::steady_clock::time_point oStartTime;   ///< Point of time of the construction.
+
+  public:
+
+    // Constructor, destructor:
+    CTraceSpan( const char* szCategory_i, const char* szName_i );
+    CTraceSpan( const char* szCategory_i, const std::string& sName_i );
+    ~CTraceSpan();
+};
+
+#endif /* STATS_ALLREADY_READ_IN */
@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------
+/// \file       symtable.cpp
+///
+/// \brief      Module implementation file for the symbol table of Escrido.
+// -----------------------------------------------------------------------------
+
+#include "symtable.h"
+
+// -----------------------------------------------------------------------------
+
+// CLASS CSymbolTable
+
+// -----------------------------------------------------------------------------
+
+escrido::CSymbolTable::CSymbolTable()
+{
+  this->Clear();
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Removes all symbols except for the fixed ones.
+// *****************************************************************************
+
+void escrido::CSymbolTable::Clear()
+{
+  asSymbolList.clear();
+  oSymbolMap.clear();
+
+  // Fixed symbols (in the order of their IDs, see namespace symbol).
+  this->Intern( "" );
+  this->Intern( "mainpage" );
+  this->Intern( "page" );
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Returns the symbol ID of a string, adding the string to the
+///             table if necessary.
+// *****************************************************************************
+
+escrido::symbol_id escrido::CSymbolTable::Intern( const std::string& sString_i )
+{
+  std::pair<std::unordered_map <std::string, symbol_id>::iterator, bool> oInsert =
+    oSymbolMap.insert( std::make_pair( sString_i, static_cast<symbol_id>( asSymbolList.size() ) ) );
+  if( oInsert.second )
+    asSymbolList.push_back( sString_i );
+
+  return oInsert.first->second;
+}
+
+// .............................................................................
+
+// *****************************************************************************
+/// \brief      Retrieves the symbol ID of a string without adding it.
+///
+/// \return     'true' if the string is interned, 'false' otherwise.
+// *****************************************************************************
+
+bool escrido::CSymbolTable::Find( const std::string& sString_i, symbol_id& nSymbol_o ) const
+{
+  std::unordered_map <std::string, symbol_id>::const_iterator iSymbol = oSymbolMap.find( sString_i );
+  if( iSymbol == oSymbolMap.end() )
+    return false;
+
+  nSymbol_o = iSymbol->second;
+  return true;
+}
+
+// .............................................................................
+
+/// Returns the string form of a symbol.
+const std::string& escrido::CSymbolTable::GetString( symbol_id nSymbol_i ) const
+{
+  return asSymbolList[nSymbol_i];
+}
+
+// .............................................................................
+
+size_t escrido::CSymbolTable::GetSymbolN() const
+{
+  return asSymbolList.size();
+}
@@ -0,0 +1,95 @@
+#ifndef SYMTABLE_ALLREADY_READ_IN
+#define SYMTABLE_ALLREADY_READ_IN
+
+// -----------------------------------------------------------------------------
+/// \file       symtable.h
+///
+/// \brief      Module header for the symbol table of Escrido, i.e. the
+///             interning of page types, identifiers and group names into
+///             small integer IDs.
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+
+// INCLUSIONS
+
+// -----------------------------------------------------------------------------
+
+#include <string>
+#include <deque>
+#include <unordered_map>
+#include <cstdint>          // uint32_t
+
+// -----------------------------------------------------------------------------
+
+// CLASSES OVERVIEW
+
+// -----------------------------------------------------------------------------
+
+// *********************
+// *                   *
+// *   CSymbolTable    *
+// *                   *
+// *********************
+
+namespace escrido
+{
+  /// Identifier of an interned string (see CSymbolTable).
+  typedef uint32_t symbol_id;
+
+  /// Symbols with fixed IDs (interned on construction of the table).
+  namespace symbol
+  {
+    const symbol_id EMPTY    = 0;   ///< The empty string.
+    const symbol_id MAINPAGE = 1;   ///< "mainpage" (page type and identifier of the main page).
+    const symbol_id PAGE     = 2;   ///< "page" (page type of general pages).
+    const symbol_id NONE     = 0xFFFFFFFF; ///< No symbol (e.g. not yet interned).
+  }
+
+  class CSymbolTable;
+}
+
+// -----------------------------------------------------------------------------
+
+// CLASS CSymbolTable
+
+// -----------------------------------------------------------------------------
+
+// *****************************************************************************
+/// \brief      A table of interned strings.
+///
+/// \details    Every distinct string gets a unique ID on interning, so strings
+///             can be compared and hashed as integers. The string form is only
+///             needed for output (GetString()). Symbols are only removed all
+///             at once by Clear(); until then the references returned by
+///             GetString() remain valid.
+///
+///             Every documentation has a table of its own (see
+///             CDocumentation::GetSymbolTable()), so the table is not locked:
+///             like the documentation it must not be used from several
+///             threads at the same time.
+// *****************************************************************************
+
+class escrido::CSymbolTable
+{
+  private:
+
+    std::deque <std::string> asSymbolList;                     ///< Strings by symbol ID.
+    std::unordered_map <std::string, symbol_id> oSymbolMap;    ///< Symbol IDs by string.
+
+  public:
+
+    // Constructor:
+    CSymbolTable();
+    CSymbolTable( const CSymbolTable& ) = delete;
+    CSymbolTable& operator=( const CSymbolTable& ) = delete;
+
+    // Access:
+    void Clear();
+    symbol_id Intern( const std::string& sString_i );
+    bool Find( const std::string& sString_i, symbol_id& nSymbol_o ) const;
+    const std::string& GetString( symbol_id nSymbol_i ) const;
+    size_t GetSymbolN() const;
+};
+
+#endif /* SYMTABLE_ALLREADY_READ_IN */
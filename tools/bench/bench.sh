@@ -0,0 +1,93 @@
+#!/bin/bash
+# *****************************************************************************
+# Escrido benchmark suite
+#
+# Generates synthetic corpora with tools/bench/gencorpus, runs Escrido on them
+# (HTML, search index and LaTeX output) and appends the phase timings reported
+# by "--stats-json" as CSV rows.
+#
+# Usage: tools/bench/bench.sh [escrido binary] [CSV file]
+#
+# Environment variables:
+#   SIZES    List of page numbers of the corpora.       (default "100 500 2000")
+#   UNITS    List of documentation unit styles.         (default "ml sl")
+#   REPEAT   Number of runs per corpus.                 (default 3)
+#   GENARGS  Further arguments of gencorpus, e.g. "--refs 10 --group-depth 3".
+#   WORKDIR  Directory for corpora and outputs.         (default: temporary)
+# *****************************************************************************
+
+ESCRIDO=${1:-./bin/escrido}
+CSVFILE=${2:-./bench.csv}
+SIZES=${SIZES:-"100 500 2000"}
+UNITS=${UNITS:-"ml sl"}
+REPEAT=${REPEAT:-3}
+GENCORPUS=$(dirname "$0")/gencorpus
+TEMPLATES=$(dirname "$0")/../../templates/manual/
+
+if [ ! -x "$ESCRIDO" ] || [ ! -x "$GENCORPUS" ]; then
+  echo "Error: '$ESCRIDO' or '$GENCORPUS' not found (run 'make bench')" >&2
+  exit 1
+fi
+
+WORKDIR=${WORKDIR:-$(mktemp -d)}
+mkdir -p "$WORKDIR"
+
+# Version label of the binary (second word of the first output line).
+VERSION=$("$ESCRIDO" -V | head -n 1 | cut -d ' ' -f 2)
+COMMIT=$(git rev-parse --short HEAD 2>/dev/null || echo "-")
+
+# Extracts the accumulated seconds of a phase from the statistics JSON file.
+phase_seconds()
+{
+  local VALUE
+  VALUE=$(grep "\"name\":\"$1\"" "$2" | sed 's/.*"seconds":\([0-9.]*\).*/\1/')
+  echo "${VALUE:-0}"
+}
+
+# Extracts a counter from the statistics JSON file.
+counter()
+{
+  grep "\"$1\":" "$2" | sed 's/[^0-9-]//g'
+}
+
+if [ ! -f "$CSVFILE" ]; then
+  echo "version,commit,units,pages,files,bytes_read,run,resolve_s,read_s,parse_s,reftable_s,html_s,grouptree_s,searchindex_s,latex_s,wall_s,tokens,chunks,ref_lookups,bytes_written,peak_rss_kb" > "$CSVFILE"
+fi
+
+for UNIT in $UNITS; do
+  for SIZE in $SIZES; do
+    CORPUS="$WORKDIR/corpus_${UNIT}_${SIZE}"
+    rm -rf "$CORPUS"; mkdir -p "$CORPUS"
+    "$GENCORPUS" --out "$CORPUS" --pages "$SIZE" --units "$UNIT" $GENARGS || exit 1
+
+    for RUN in $(seq 1 "$REPEAT"); do
+      OUT="$WORKDIR/out"
+      rm -rf "$OUT"; mkdir -p "$OUT/html" "$OUT/latex"
+      STATS="$WORKDIR/stats.json"
+
+      START=$(date +%s.%N)
+      "$ESCRIDO" -t "$TEMPLATES" -I "$CORPUS/*.txt" \
+                 -wd on -wdo "$OUT/html/" -si on \
+                 -ld on -ldo "$OUT/latex/" \
+                 --stats-json "$STATS" > /dev/null || exit 1
+      END=$(date +%s.%N)
+
+      echo "$VERSION,$COMMIT,$UNIT,$SIZE,$(counter files_scanned "$STATS"),$(counter bytes_read "$STATS"),$RUN,"\
+"$(phase_seconds "resolve include paths" "$STATS"),"\
+"$(phase_seconds "read files" "$STATS"),"\
+"$(phase_seconds "parse" "$STATS"),"\
+"$(phase_seconds "create reference table" "$STATS"),"\
+"$(phase_seconds "write HTML documents" "$STATS"),"\
+"$(phase_seconds "order group tree" "$STATS"),"\
+"$(phase_seconds "write search index" "$STATS"),"\
+"$(phase_seconds "write LaTeX document" "$STATS"),"\
+"$(awk "BEGIN { printf \"%.6f\", $END - $START }"),"\
+"$(counter tokens "$STATS"),$(counter content_chunks "$STATS"),$(counter reference_lookups "$STATS"),"\
+"$(counter bytes_written "$STATS"),$(counter peak_rss_kb "$STATS")" >> "$CSVFILE"
+
+      echo "units=$UNIT pages=$SIZE run=$RUN done"
+    done
+  done
+done
+
+echo "Results appended to '$CSVFILE'"
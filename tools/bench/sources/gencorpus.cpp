@@ -0,0 +1,318 @@
+// *****************************************************************************
+/// \file       gencorpus.cpp
+///
+/// \brief      Generator of synthetic Escrido input corpora for benchmarking.
+///
+/// \details    Creates a directory of text files with documentation units of
+///             configurable size and structure. The output only depends on the
+///             arguments (including the seed), so corpora can be recreated
+///             identically for comparing different versions of Escrido.
+// *****************************************************************************
+
+#include <cstdlib>      // atoi
+#include <cstring>      // strcmp
+#include <iostream>     // std::cout, std::cerr, std::endl
+#include <fstream>      // std::ofstream
+#include <sstream>      // std::stringstream
+#include <iomanip>      // std::setw, std::setfill
+#include <string>
+#include <vector>
+#include <random>       // std::mt19937
+
+// -----------------------------------------------------------------------------
+
+// GLOBAL SETTINGS
+
+// -----------------------------------------------------------------------------
+
+namespace gencorpus
+{
+  std::string sOutDir;          ///< Output directory (must exist).
+  int nPageN         = 1000;    ///< Number of documentation pages.
+  int nFileN         = 0;       ///< Number of files (0: one file per 20 pages).
+  int nGroupDepth    = 2;       ///< Depth of the group tree.
+  int nGroupFanout   = 4;       ///< Number of subgroups per group.
+  int nParagraphN    = 3;       ///< Number of detail paragraphs per page.
+  int nRefN          = 3;       ///< Number of references to other pages per page.
+  int nFeatureN      = 2;       ///< Number of features per reference page.
+  int nExampleN      = 1;       ///< Number of examples (with code) per page.
+  int nTableN        = 1;       ///< Number of tables per page.
+  int nVerbatimN     = 1;       ///< Number of verbatim blocks per page.
+  std::string sUnits = "mixed"; ///< Documentation unit style: "ml", "sl" or "mixed".
+  unsigned int nSeed = 1;       ///< Seed of the random generator.
+
+  std::mt19937 oRandom;         ///< Random generator.
+
+  const char* aszWords[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consetetur",
+                             "sadipscing", "elitr", "sed", "diam", "nonumy", "eirmod",
+                             "tempor", "invidunt", "ut", "labore", "et", "dolore",
+                             "magna", "aliquyam", "erat", "voluptua", "at", "vero",
+                             "eos", "accusam", "justo", "duo", "dolores", "ea",
+                             "rebum", "stet", "clita", "kasd", "gubergren", "no",
+                             "sea", "takimata", "sanctus", "est" };
+  const size_t nWordN = sizeof( aszWords ) / sizeof( aszWords[0] );
+}
+
+// -----------------------------------------------------------------------------
+
+// FUNCTIONS
+
+// -----------------------------------------------------------------------------
+
+namespace gencorpus
+{
+  // Returns a random number in [0,nMax_i).
+  size_t Random( size_t nMax_i )
+  {
+    return nMax_i == 0 ? 0 : oRandom() % nMax_i;
+  }
+
+  // Returns the identifier of a page.
+  std::string PageIdent( int nPage_i )
+  {
+    std::stringstream oIdent;
+    oIdent << "page_" << std::setw( 6 ) << std::setfill( '0' ) << nPage_i;
+    return oIdent.str();
+  }
+
+  // Appends a sentence of random words.
+  void AppendSentence( std::vector<std::string>& asLines_io, size_t nWordN_i )
+  {
+    std::string sLine;
+    for( size_t w = 0; w < nWordN_i; w++ )
+    {
+      if( !sLine.empty() )
+        sLine += ' ';
+      sLine += aszWords[Random( nWordN )];
+      if( sLine.length() > 70 )
+      {
+        asLines_io.push_back( sLine );
+        sLine.clear();
+      }
+    }
+    if( !sLine.empty() )
+      asLines_io.push_back( sLine );
+    asLines_io.back() += '.';
+  }
+
+  // Creates the content lines of one documentation page.
+  void CreatePage( int nPage_i, std::vector<std::string>& asLines_o )
+  {
+    asLines_o.clear();
+
+    const std::string sIdent = PageIdent( nPage_i );
+    const bool fRefPage = ( nPage_i % 2 == 1 );
+
+    // Headline
+    if( nPage_i == 0 )
+      asLines_o.push_back( "@_mainpage_ Synthetic Benchmark Corpus" );
+    else
+    if( fRefPage )
+      asLines_o.push_back( "@_refpage_ function " + sIdent + " Function " + std::to_string( nPage_i ) );
+    else
+      asLines_o.push_back( "@_page_ " + sIdent + " Page " + std::to_string( nPage_i ) );
+
+    // Brief
+    asLines_o.push_back( "" );
+    asLines_o.push_back( "@brief" );
+    AppendSentence( asLines_o, 8 + Random( 8 ) );
+
+    // Groups
+    if( nPage_i != 0 )
+    {
+      size_t nGroupIdx = nPage_i;
+      for( int g = 0; g < nGroupDepth; g++ )
+      {
+        asLines_o.push_back( "@ingroup Group_" + std::to_string( g ) + "_" + std::to_string( nGroupIdx % nGroupFanout ) );
+        nGroupIdx /= nGroupFanout;
+      }
+    }
+
+    // Signatures, parameters and return value of reference pages.
+    if( fRefPage )
+    {
+      asLines_o.push_back( "" );
+      asLines_o.push_back( "@signature " + sIdent + "( int nValue, const char* szText )" );
+      asLines_o.push_back( "" );
+      asLines_o.push_back( "@param nValue" );
+      AppendSentence( asLines_o, 6 + Random( 6 ) );
+      asLines_o.push_back( "@param szText" );
+      AppendSentence( asLines_o, 6 + Random( 6 ) );
+      asLines_o.push_back( "@return" );
+      AppendSentence( asLines_o, 6 + Random( 6 ) );
+
+      for( int f = 0; f < nFeatureN; f++ )
+      {
+        asLines_o.push_back( "@feature option Option " + std::to_string( f ) );
+        AppendSentence( asLines_o, 6 + Random( 10 ) );
+      }
+    }
+
+    // Details: paragraphs with references and inline formatting.
+    asLines_o.push_back( "" );
+    asLines_o.push_back( "@details" );
+    for( int p = 0; p < nParagraphN; p++ )
+    {
+      AppendSentence( asLines_o, 30 + Random( 40 ) );
+      if( p == 0 )
+        for( int r = 0; r < nRefN; r++ )
+          asLines_o.push_back( "See also @ref " + PageIdent( Random( nPageN ) ) + " and <b>bold</b> text." );
+      asLines_o.push_back( "" );
+    }
+
+    // Examples with code.
+    for( int e = 0; e < nExampleN; e++ )
+    {
+      asLines_o.push_back( "@example" );
+      AppendSentence( asLines_o, 10 );
+      asLines_o.push_back( "@code" );
+      asLines_o.push_back( "int nResult = " + sIdent + "( 42, \"text\" );" );
+      asLines_o.push_back( "if( nResult < 0 && nResult > -10 )" );
+      asLines_o.push_back( "  return nResult;" );
+      asLines_o.push_back( "@endcode" );
+      asLines_o.push_back( "@par" );
+      asLines_o.push_back( "" );
+    }
+
+    // Tables.
+    for( int t = 0; t < nTableN; t++ )
+    {
+      asLines_o.push_back( "@table" );
+      asLines_o.push_back( "  <b>Name</b> | <b>Description</b> @lb" );
+      for( int r = 0; r < 4; r++ )
+        asLines_o.push_back( std::string( "  " ) + aszWords[Random( nWordN )] + " | " +
+                             aszWords[Random( nWordN )] + " " + aszWords[Random( nWordN )] + ( r < 3 ? " @lb" : "" ) );
+      asLines_o.push_back( "@endtable" );
+      asLines_o.push_back( "" );
+    }
+
+    // Verbatim blocks.
+    for( int v = 0; v < nVerbatimN; v++ )
+    {
+      asLines_o.push_back( "@verbatim" );
+      asLines_o.push_back( "  <tag attribute=\"value\"> & special $ characters { }" );
+      asLines_o.push_back( "  second line of verbatim text" );
+      asLines_o.push_back( "@endverbatim" );
+      asLines_o.push_back( "" );
+    }
+  }
+
+  // Writes the lines of a page as a documentation unit.
+  void WriteUnit( std::ostream& oOut_i, const std::vector<std::string>& asLines_i, bool fSingleLine_i )
+  {
+    // Some code between the units.
+    oOut_i << "int nDummy = 0;" << std::endl
+           << std::endl;
+
+    if( fSingleLine_i )
+    {
+      // (Empty lines would end a single line unit.)
+      for( size_t l = 0; l < asLines_i.size(); l++ )
+        oOut_i << "//# " << asLines_i[l] << std::endl;
+    }
+    else
+    {
+      oOut_i << "/*# ";
+      for( size_t l = 0; l < asLines_i.size(); l++ )
+        oOut_i << asLines_i[l] << std::endl;
+      oOut_i << "#*/" << std::endl;
+    }
+
+    oOut_i << std::endl;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+// MAIN
+
+// -----------------------------------------------------------------------------
+
+int main( int argc, char* argv[] )
+{
+  using namespace gencorpus;
+
+  // Interprete the command line arguments.
+  for( int a = 1; a < argc; a++ )
+  {
+    const char* szArg = argv[a];
+    if( a + 1 >= argc )
+    {
+      std::cerr << "Error: missing value of argument '" << szArg << "'" << std::endl;
+      return 1;
+    }
+    const char* szValue = argv[++a];
+
+    if( strcmp( szArg, "--out" ) == 0 )                sOutDir = szValue;
+    else if( strcmp( szArg, "--pages" ) == 0 )         nPageN = atoi( szValue );
+    else if( strcmp( szArg, "--files" ) == 0 )         nFileN = atoi( szValue );
+    else if( strcmp( szArg, "--group-depth" ) == 0 )   nGroupDepth = atoi( szValue );
+    else if( strcmp( szArg, "--group-fanout" ) == 0 )  nGroupFanout = atoi( szValue );
+    else if( strcmp( szArg, "--paragraphs" ) == 0 )    nParagraphN = atoi( szValue );
+    else if( strcmp( szArg, "--refs" ) == 0 )          nRefN = atoi( szValue );
+    else if( strcmp( szArg, "--features" ) == 0 )      nFeatureN = atoi( szValue );
+    else if( strcmp( szArg, "--examples" ) == 0 )      nExampleN = atoi( szValue );
+    else if( strcmp( szArg, "--tables" ) == 0 )        nTableN = atoi( szValue );
+    else if( strcmp( szArg, "--verbatim" ) == 0 )      nVerbatimN = atoi( szValue );
+    else if( strcmp( szArg, "--units" ) == 0 )         sUnits = szValue;
+    else if( strcmp( szArg, "--seed" ) == 0 )          nSeed = atoi( szValue );
+    else
+    {
+      std::cerr << "Error: unknown argument '" << szArg << "'" << std::endl;
+      return 1;
+    }
+  }
+
+  if( sOutDir.empty() ||
+      nPageN < 1 ||
+      nGroupFanout < 1 ||
+      ( sUnits != "ml" && sUnits != "sl" && sUnits != "mixed" ) )
+  {
+    std::cerr << "Usage: gencorpus --out DIR [--pages N] [--files N] [--group-depth N]" << std::endl
+              << "                 [--group-fanout N] [--paragraphs N] [--refs N]" << std::endl
+              << "                 [--features N] [--examples N] [--tables N]" << std::endl
+              << "                 [--verbatim N] [--units ml|sl|mixed] [--seed N]" << std::endl;
+    return 1;
+  }
+
+  if( nFileN <= 0 )
+    nFileN = ( nPageN + 19 ) / 20;
+  if( nFileN > nPageN )
+    nFileN = nPageN;
+  if( sOutDir.back() != '/' )
+    sOutDir += '/';
+
+  oRandom.seed( nSeed );
+
+  // Distribute the pages evenly over the files.
+  size_t nByteN = 0;
+  int nPage = 0;
+  std::vector<std::string> asLines;
+  for( int f = 0; f < nFileN; f++ )
+  {
+    std::stringstream oFileName;
+    oFileName << sOutDir << "corpus_" << std::setw( 5 ) << std::setfill( '0' ) << f << ".txt";
+
+    std::ofstream oOutFile( oFileName.str().c_str(), std::ofstream::out | std::ofstream::binary );
+    if( !oOutFile.is_open() )
+    {
+      std::cerr << "Error: file \"" << oFileName.str() << "\" cannot be created" << std::endl;
+      return 1;
+    }
+
+    const int nPageEnd = static_cast<int>( static_cast<long long>( nPageN ) * ( f + 1 ) / nFileN );
+    for( ; nPage < nPageEnd; nPage++ )
+    {
+      CreatePage( nPage, asLines );
+      const bool fSingleLine = ( sUnits == "sl" ) || ( sUnits == "mixed" && nPage % 3 == 2 );
+      WriteUnit( oOutFile, asLines, fSingleLine );
+    }
+
+    nByteN += oOutFile.tellp();
+    oOutFile.close();
+  }
+
+  std::cout << nPageN << " page(s) in " << nFileN << " file(s), " << nByteN << " byte(s) written into '" << sOutDir << "'" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,536 @@
+// *****************************************************************************
+/// \file       microbench.cpp
+///
+/// \brief      Microbenchmarks of the text kernels of Escrido.
+///
+/// \details    Runs the string utilities of content-unit.cpp in isolation over
+///             generated text samples of different character (prose, HTML
+///             markup, LaTeX special characters, identifiers and titles) and
+///             reports the time per call, the time per input byte and the
+///             number of heap allocations per call.
+///
+///             The same samples (with an inline reference every few words)
+///             are also parsed into tag blocks. The traversal methods of the
+///             blocks (plain text access and reference resolution) are timed
+///             like the text kernels, and the heap memory that the parsed
+///             blocks keep alive is reported per block and per source byte.
+///
+///             Usage: microbench [--csv] [--time SECONDS] [--filter NAME]
+// *****************************************************************************
+
+#include <cstdlib>      // malloc, free, atof
+#include <cstring>      // strcmp, strstr
+#include <iostream>     // std::cout, std::cerr, std::endl
+#include <iomanip>      // std::setw, std::setprecision
+#include <string>
+#include <vector>
+#include <chrono>       // std::chrono::steady_clock
+#include <new>          // std::bad_alloc
+#include <random>       // std::mt19937
+
+#include "content-unit.h"
+#include "reftable.h"
+#include "symtable.h"
+#include "stats.h"
+
+// -----------------------------------------------------------------------------
+
+// ALLOCATION COUNTING
+
+// -----------------------------------------------------------------------------
+
+namespace microbench
+{
+  size_t nAllocN = 0;     ///< Number of calls of operator new.
+  size_t nLiveByteN = 0;  ///< Number of bytes currently allocated by operator new.
+
+  // Every allocation is preceded by a header that stores its size (the header
+  // size keeps the alignment of malloc).
+  const size_t nAllocHeader = 16;
+}
+
+void* operator new( size_t nSize_i )
+{
+  microbench::nAllocN++;
+  char* pMem = static_cast<char*>( malloc( microbench::nAllocHeader + nSize_i ) );
+  if( pMem == NULL )
+    throw std::bad_alloc();
+  *reinterpret_cast<size_t*>( pMem ) = nSize_i;
+  microbench::nLiveByteN += nSize_i;
+  return pMem + microbench::nAllocHeader;
+}
+
+void operator delete( void* pMem_i ) noexcept
+{
+  if( pMem_i == NULL )
+    return;
+  char* pMem = static_cast<char*>( pMem_i ) - microbench::nAllocHeader;
+  microbench::nLiveByteN -= *reinterpret_cast<size_t*>( pMem );
+  free( pMem );
+}
+
+void operator delete( void* pMem_i, size_t ) noexcept
+{
+  operator delete( pMem_i );
+}
+
+// -----------------------------------------------------------------------------
+
+// TEXT SAMPLES
+
+// -----------------------------------------------------------------------------
+
+namespace microbench
+{
+  std::mt19937 oRandom( 1 );
+
+  const char* aszWords[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consetetur",
+                             "sadipscing", "elitr", "sed", "diam", "nonumy", "eirmod",
+                             "tempor", "invidunt", "ut", "labore", "et", "dolore",
+                             "magna", "aliquyam", "erat", "voluptua", "at", "vero" };
+  const size_t nWordN = sizeof( aszWords ) / sizeof( aszWords[0] );
+
+  const char* aszMarkup[] = { "<b>", "</b>", "<em>", "</em>", "<code>", "</code>",
+                              "<br>", "&lt;", "&gt;", "&amp;", "&nbsp;", "<p>", "</p>" };
+  const size_t nMarkupN = sizeof( aszMarkup ) / sizeof( aszMarkup[0] );
+
+  const char* aszSpecial[] = { "$", "%", "&", "_", "#", "{", "}", "~", "^", "\\", "<", ">" };
+  const size_t nSpecialN = sizeof( aszSpecial ) / sizeof( aszSpecial[0] );
+
+  /// A text sample.
+  struct SSample
+  {
+    const char* szName;
+    std::vector <std::string> asText;
+    size_t nByteN;
+  };
+
+  // Creates a text of approximately nLen_i characters. Every nMarkupRate_i-th
+  // word is followed by a markup element and every nSpecialRate_i-th word by a
+  // LaTeX special character (0: never).
+  std::string CreateText( size_t nLen_i, size_t nMarkupRate_i, size_t nSpecialRate_i )
+  {
+    std::string sText;
+    size_t w = 0;
+    while( sText.length() < nLen_i )
+    {
+      if( !sText.empty() )
+        sText += ' ';
+      sText += aszWords[oRandom() % nWordN];
+      w++;
+      if( nMarkupRate_i > 0 && w % nMarkupRate_i == 0 )
+        sText += aszMarkup[oRandom() % nMarkupN];
+      if( nSpecialRate_i > 0 && w % nSpecialRate_i == 0 )
+        sText += aszSpecial[oRandom() % nSpecialN];
+    }
+    return sText;
+  }
+
+  // Creates the list of samples.
+  void CreateSamples( std::vector<SSample>& oaSamples_o )
+  {
+    oaSamples_o.resize( 5 );
+
+    oaSamples_o[0].szName = "prose";
+    for( size_t t = 0; t < 64; t++ )
+      oaSamples_o[0].asText.push_back( CreateText( 200 + oRandom() % 400, 0, 0 ) );
+
+    oaSamples_o[1].szName = "html";
+    for( size_t t = 0; t < 64; t++ )
+      oaSamples_o[1].asText.push_back( CreateText( 200 + oRandom() % 400, 3, 0 ) );
+
+    oaSamples_o[2].szName = "latex-special";
+    for( size_t t = 0; t < 64; t++ )
+      oaSamples_o[2].asText.push_back( CreateText( 200 + oRandom() % 400, 0, 3 ) );
+
+    oaSamples_o[3].szName = "title";
+    for( size_t t = 0; t < 64; t++ )
+      oaSamples_o[3].asText.push_back( CreateText( 10 + oRandom() % 30, 0, 0 ) );
+
+    oaSamples_o[4].szName = "quoted";
+    for( size_t t = 0; t < 64; t++ )
+      oaSamples_o[4].asText.push_back( "\"" + CreateText( 5 + oRandom() % 20, 0, 0 ) + "\" " + CreateText( 30 + oRandom() % 60, 0, 0 ) );
+
+    for( size_t s = 0; s < oaSamples_o.size(); s++ )
+    {
+      oaSamples_o[s].nByteN = 0;
+      for( size_t t = 0; t < oaSamples_o[s].asText.size(); t++ )
+        oaSamples_o[s].nByteN += oaSamples_o[s].asText[t].size();
+    }
+  }
+
+  /// A sample of parsed tag blocks.
+  struct SBlockSample
+  {
+    const char* szName;
+    std::vector <escrido::CContentUnit> oaUnits;
+    size_t nByteN;          ///< Number of source bytes.
+    size_t nChunkN;         ///< Number of content chunks of all blocks.
+    size_t nLiveByteN;      ///< Heap bytes kept alive by the units.
+  };
+
+  // Feeds a text into a content unit as a '@details' block of a multi line
+  // unit with a line break every 80 characters. Every nRefRate_i-th word is
+  // preceded by an inline '@ref' tag.
+  void ParseBlock( const std::string& sText_i, size_t nRefRate_i, escrido::CContentUnit& oContUnit_o )
+  {
+    oContUnit_o.ResetParseState( cont_unit_type::MULTI_LINE );
+    oContUnit_o.AppendTag( "details" );
+    oContUnit_o.AppendBlank();
+
+    size_t w = 0;
+    size_t nLineLen = 0;
+    bool fWordStart = true;
+    for( size_t c = 0; c < sText_i.size(); c++ )
+    {
+      if( sText_i[c] == ' ' )
+      {
+        fWordStart = true;
+        if( nLineLen > 80 )
+        {
+          oContUnit_o.AppendLineBreak();
+          nLineLen = 0;
+        }
+        else
+          oContUnit_o.AppendBlank();
+        continue;
+      }
+      if( fWordStart && ++w % nRefRate_i == 0 )
+      {
+        oContUnit_o.AppendTag( "ref" );
+        oContUnit_o.AppendBlank();
+      }
+      fWordStart = false;
+      oContUnit_o.AppendChar( sText_i[c] );
+      nLineLen++;
+    }
+
+    oContUnit_o.CloseWrite();
+  }
+
+  // Parses the prose and HTML samples into tag blocks.
+  void CreateBlockSamples( const std::vector<SSample>& oaSamples_i, std::vector<SBlockSample>& oaBlockSamples_o )
+  {
+    for( size_t s = 0; s < oaSamples_i.size(); s++ )
+    {
+      if( strcmp( oaSamples_i[s].szName, "prose" ) != 0 &&
+          strcmp( oaSamples_i[s].szName, "html" ) != 0 )
+        continue;
+
+      oaBlockSamples_o.emplace_back();
+      SBlockSample& oBlockSample = oaBlockSamples_o.back();
+      oBlockSample.szName = oaSamples_i[s].szName;
+      oBlockSample.nByteN = oaSamples_i[s].nByteN;
+      oBlockSample.oaUnits.resize( oaSamples_i[s].asText.size() );
+
+      const size_t nLiveByteStart = nLiveByteN;
+      for( size_t t = 0; t < oaSamples_i[s].asText.size(); t++ )
+        ParseBlock( oaSamples_i[s].asText[t], 8, oBlockSample.oaUnits[t] );
+      oBlockSample.nLiveByteN = nLiveByteN - nLiveByteStart;
+
+      oBlockSample.nChunkN = 0;
+      for( size_t t = 0; t < oBlockSample.oaUnits.size(); t++ )
+        for( size_t b = 0; b < oBlockSample.oaUnits[t].GetTagBlockN(); b++ )
+          oBlockSample.nChunkN += oBlockSample.oaUnits[t].GetTagBlock( b ).GetChunkN();
+    }
+  }
+
+  // Fills a reference table with every other sample word (so that half of
+  // the references stay unresolved).
+  void CreateRefTable( escrido::CRefTable& oRefTable_o )
+  {
+    for( size_t w = 0; w < nWordN; w += 2 )
+      oRefTable_o.AppendRef( aszWords[w], std::string( "page.html#" ) + aszWords[w], aszWords[w] );
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+// KERNELS
+
+// -----------------------------------------------------------------------------
+
+namespace microbench
+{
+  // Sink that keeps the compiler from optimizing the calls away.
+  volatile size_t nSink = 0;
+
+  size_t RunHTMLEscape( const std::string& sText_i )            { return escrido::HTMLEscape( sText_i ).size(); }
+  size_t RunLaTeXEscape( const std::string& sText_i )           { return escrido::LaTeXEscape( sText_i ).size(); }
+  size_t RunConvertHTML2LaTeX( const std::string& sText_i )     { return escrido::ConvertHTML2LaTeX( sText_i ).size(); }
+  size_t RunConvertHTML2ClearText( const std::string& sText_i ) { return escrido::ConvertHTML2ClearText( sText_i ).size(); }
+  size_t RunMakeIdentifier( const std::string& sText_i )        { return escrido::MakeIdentifier( sText_i ).size(); }
+  size_t RunGetCamelCase( const std::string& sText_i )          { return escrido::GetCamelCase( sText_i ).size(); }
+  size_t RunGetSnakeCase( const std::string& sText_i )          { return escrido::GetSnakeCase( sText_i ).size(); }
+  size_t RunTokenize( const std::string& sText_i )
+  {
+    std::vector<std::string> asTokens;
+    escrido::Tokenize( sText_i, " ", asTokens );
+    return asTokens.size();
+  }
+  size_t RunFirstWord( const std::string& sText_i )
+  {
+    std::string sWord;
+    escrido::FirstWord( sText_i, sWord );
+    return sWord.size();
+  }
+  size_t RunFirstQuote( const std::string& sText_i )
+  {
+    std::string sQuote;
+    escrido::FirstQuote( sText_i, sQuote );
+    return sQuote.size();
+  }
+
+  /// A kernel together with the samples it is measured on.
+  struct SKernel
+  {
+    const char* szName;
+    size_t (*Run)( const std::string& );
+    const char* szSamples;    ///< Names of the samples (blank separated).
+  };
+
+  const SKernel aoKernels[] =
+  {
+    { "HTMLEscape",            &RunHTMLEscape,            "prose html latex-special" },
+    { "LaTeXEscape",           &RunLaTeXEscape,           "prose latex-special" },
+    { "ConvertHTML2LaTeX",     &RunConvertHTML2LaTeX,     "prose html" },
+    { "ConvertHTML2ClearText", &RunConvertHTML2ClearText, "prose html" },
+    { "MakeIdentifier",        &RunMakeIdentifier,        "title" },
+    { "GetCamelCase",          &RunGetCamelCase,          "title" },
+    { "GetSnakeCase",          &RunGetSnakeCase,          "title" },
+    { "Tokenize",              &RunTokenize,              "prose title" },
+    { "FirstWord",             &RunFirstWord,             "prose title" },
+    { "FirstQuote",            &RunFirstQuote,            "quoted" }
+  };
+  const size_t nKernelN = sizeof( aoKernels ) / sizeof( aoKernels[0] );
+
+  // Buffers of the block kernels (reused so that only the kernels allocate).
+  std::string sBlockText;
+  std::vector<std::string> asUnresolved;
+
+  size_t RunGetPlainText( const escrido::CTagBlock& oTagBlock_i, const escrido::CRefTable& )
+  {
+    oTagBlock_i.GetPlainText( sBlockText );
+    return sBlockText.size();
+  }
+  size_t RunGetPlainTitleLine( const escrido::CTagBlock& oTagBlock_i, const escrido::CRefTable& )
+  {
+    oTagBlock_i.GetPlainTitleLine( sBlockText );
+    return sBlockText.size();
+  }
+  size_t RunGetPlainFirstWordView( const escrido::CTagBlock& oTagBlock_i, const escrido::CRefTable& )
+  {
+    return oTagBlock_i.GetPlainFirstWordView().size();
+  }
+  size_t RunResolveRefs( const escrido::CTagBlock& oTagBlock_i, const escrido::CRefTable& oRefTable_i )
+  {
+    asUnresolved.clear();
+    oTagBlock_i.ResolveRefs( oRefTable_i, asUnresolved );
+    return asUnresolved.size();
+  }
+
+  /// A traversal kernel of tag blocks (measured on all block samples).
+  struct SBlockKernel
+  {
+    const char* szName;
+    size_t (*Run)( const escrido::CTagBlock&, const escrido::CRefTable& );
+  };
+
+  const SBlockKernel aoBlockKernels[] =
+  {
+    { "Block::GetPlainText",          &RunGetPlainText },
+    { "Block::GetPlainTitleLine",     &RunGetPlainTitleLine },
+    { "Block::GetPlainFirstWordView", &RunGetPlainFirstWordView },
+    { "Block::ResolveRefs",           &RunResolveRefs }
+  };
+  const size_t nBlockKernelN = sizeof( aoBlockKernels ) / sizeof( aoBlockKernels[0] );
+
+  // Runs a block kernel once over all blocks of a sample.
+  void RunBlockPass( const SBlockKernel& oKernel_i, const SBlockSample& oSample_i, const escrido::CRefTable& oRefTable_i )
+  {
+    for( size_t t = 0; t < oSample_i.oaUnits.size(); t++ )
+      for( size_t b = 0; b < oSample_i.oaUnits[t].GetTagBlockN(); b++ )
+        nSink += oKernel_i.Run( oSample_i.oaUnits[t].GetTagBlock( b ), oRefTable_i );
+  }
+
+  // Prints one result line of a kernel.
+  void PrintResult( bool fCSV_i, const char* szKernel_i, const char* szSample_i,
+                    size_t nCallN_i, size_t nByteN_i, size_t nAllocN_i, double dSeconds_i )
+  {
+    const double dNsPerCall = dSeconds_i * 1e9 / nCallN_i;
+    const double dNsPerByte = dSeconds_i * 1e9 / nByteN_i;
+    const double dAllocPerCall = static_cast<double>( nAllocN_i ) / nCallN_i;
+
+    if( fCSV_i )
+      std::cout << szKernel_i << "," << szSample_i << "," << nCallN_i << ","
+                << std::fixed << std::setprecision( 2 ) << dNsPerCall << ","
+                << std::setprecision( 3 ) << dNsPerByte << ","
+                << std::setprecision( 2 ) << dAllocPerCall << std::endl;
+    else
+      std::cout << std::left << std::setw( 30 ) << szKernel_i
+                << std::setw( 16 ) << szSample_i
+                << std::right << std::fixed << std::setprecision( 1 ) << std::setw( 14 ) << dNsPerCall
+                << std::setprecision( 3 ) << std::setw( 12 ) << dNsPerByte
+                << std::setprecision( 2 ) << std::setw( 14 ) << dAllocPerCall << std::endl;
+  }
+
+  // Checks whether a name is contained in a blank separated list.
+  bool InList( const char* szList_i, const char* szName_i )
+  {
+    const size_t nLen = strlen( szName_i );
+    for( const char* pPos = strstr( szList_i, szName_i ); pPos != NULL; pPos = strstr( pPos + 1, szName_i ) )
+      if( ( pPos == szList_i || pPos[-1] == ' ' ) &&
+          ( pPos[nLen] == '\0' || pPos[nLen] == ' ' ) )
+        return true;
+    return false;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+// MAIN
+
+// -----------------------------------------------------------------------------
+
+int main( int argc, char* argv[] )
+{
+  using namespace microbench;
+
+  bool fCSV = false;
+  double dMinSeconds = 0.2;
+  const char* szFilter = NULL;
+  for( int a = 1; a < argc; a++ )
+  {
+    if( strcmp( argv[a], "--csv" ) == 0 )
+      fCSV = true;
+    else
+    if( strcmp( argv[a], "--time" ) == 0 && a + 1 < argc )
+      dMinSeconds = atof( argv[++a] );
+    else
+    if( strcmp( argv[a], "--filter" ) == 0 && a + 1 < argc )
+      szFilter = argv[++a];
+    else
+    {
+      std::cerr << "Usage: microbench [--csv] [--time SECONDS] [--filter NAME]" << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<SSample> oaSamples;
+  CreateSamples( oaSamples );
+
+  if( fCSV )
+    std::cout << "kernel,sample,calls,ns_per_call,ns_per_byte,allocs_per_call" << std::endl;
+  else
+    std::cout << std::left << std::setw( 30 ) << "Kernel"
+              << std::setw( 16 ) << "Sample"
+              << std::right << std::setw( 14 ) << "ns/call"
+              << std::setw( 12 ) << "ns/byte"
+              << std::setw( 14 ) << "allocs/call" << std::endl;
+
+  for( size_t k = 0; k < nKernelN; k++ )
+  {
+    if( szFilter != NULL && strstr( aoKernels[k].szName, szFilter ) == NULL )
+      continue;
+
+    for( size_t s = 0; s < oaSamples.size(); s++ )
+    {
+      if( !InList( aoKernels[k].szSamples, oaSamples[s].szName ) )
+        continue;
+
+      const std::vector<std::string>& asText = oaSamples[s].asText;
+
+      // Warm up.
+      for( size_t t = 0; t < asText.size(); t++ )
+        nSink += aoKernels[k].Run( asText[t] );
+
+      // Repeat passes over the sample until the minimum time is reached.
+      size_t nPassN = 0;
+      size_t nAllocStart = nAllocN;
+      const std::chrono::steady_clock::time_point oStart = std::chrono::steady_clock::now();
+      double dSeconds = 0.0;
+      do
+      {
+        for( size_t t = 0; t < asText.size(); t++ )
+          nSink += aoKernels[k].Run( asText[t] );
+        nPassN++;
+        dSeconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - oStart ).count();
+      }
+      while( dSeconds < dMinSeconds );
+      const size_t nAllocCount = nAllocN - nAllocStart;
+
+      PrintResult( fCSV, aoKernels[k].szName, oaSamples[s].szName,
+                   nPassN * asText.size(), nPassN * oaSamples[s].nByteN, nAllocCount, dSeconds );
+    }
+  }
+
+  // Tag block traversal.
+  std::vector<SBlockSample> oaBlockSamples;
+  CreateBlockSamples( oaSamples, oaBlockSamples );
+  escrido::CSymbolTable oSymbolTable;
+  escrido::CRefTable oRefTable( oSymbolTable );
+  CreateRefTable( oRefTable );
+
+  for( size_t k = 0; k < nBlockKernelN; k++ )
+  {
+    if( szFilter != NULL && strstr( aoBlockKernels[k].szName, szFilter ) == NULL )
+      continue;
+
+    for( size_t s = 0; s < oaBlockSamples.size(); s++ )
+    {
+      // Warm up.
+      RunBlockPass( aoBlockKernels[k], oaBlockSamples[s], oRefTable );
+
+      // Repeat passes over the sample until the minimum time is reached.
+      size_t nPassN = 0;
+      size_t nAllocStart = nAllocN;
+      const std::chrono::steady_clock::time_point oStart = std::chrono::steady_clock::now();
+      double dSeconds = 0.0;
+      do
+      {
+        RunBlockPass( aoBlockKernels[k], oaBlockSamples[s], oRefTable );
+        nPassN++;
+        dSeconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - oStart ).count();
+      }
+      while( dSeconds < dMinSeconds );
+      const size_t nAllocCount = nAllocN - nAllocStart;
+
+      PrintResult( fCSV, aoBlockKernels[k].szName, oaBlockSamples[s].szName,
+                   nPassN * oaBlockSamples[s].oaUnits.size(), nPassN * oaBlockSamples[s].nByteN, nAllocCount, dSeconds );
+    }
+  }
+
+  // Heap memory of the parsed tag blocks.
+  if( fCSV )
+    std::cout << std::endl << "sample,blocks,chunks_per_block,bytes_per_block,bytes_per_source_byte,sizeof_chunk" << std::endl;
+  else
+    std::cout << std::endl << std::left << std::setw( 16 ) << "Block memory"
+              << std::right << std::setw( 10 ) << "blocks"
+              << std::setw( 14 ) << "chunks/block"
+              << std::setw( 14 ) << "bytes/block"
+              << std::setw( 14 ) << "bytes/byte"
+              << "   (sizeof( CContentChunk ) = " << sizeof( escrido::CContentChunk ) << ")" << std::endl;
+
+  for( size_t s = 0; s < oaBlockSamples.size(); s++ )
+  {
+    const size_t nBlockN = oaBlockSamples[s].oaUnits.size();
+    const double dChunkPerBlock = static_cast<double>( oaBlockSamples[s].nChunkN ) / nBlockN;
+    const double dBytePerBlock = static_cast<double>( oaBlockSamples[s].nLiveByteN ) / nBlockN;
+    const double dBytePerByte = static_cast<double>( oaBlockSamples[s].nLiveByteN ) / oaBlockSamples[s].nByteN;
+
+    if( fCSV )
+      std::cout << oaBlockSamples[s].szName << "," << nBlockN << ","
+                << std::fixed << std::setprecision( 1 ) << dChunkPerBlock << ","
+                << dBytePerBlock << ","
+                << std::setprecision( 2 ) << dBytePerByte << ","
+                << sizeof( escrido::CContentChunk ) << std::endl;
+    else
+      std::cout << std::left << std::setw( 16 ) << oaBlockSamples[s].szName
+                << std::right << std::setw( 10 ) << nBlockN
+                << std::fixed << std::setprecision( 1 ) << std::setw( 14 ) << dChunkPerBlock
+                << std::setw( 14 ) << dBytePerBlock
+                << std::setprecision( 2 ) << std::setw( 14 ) << dBytePerByte << std::endl;
+  }
+
+  return 0;
+}